@@ -19,6 +19,7 @@
 #define ASTARSEARCH_H
 
 #include <DataTypes.h>
+#include <FixPoint.h>
 
 #include <list>
 #include <vector>
@@ -26,50 +27,82 @@
 class UnitClass;
 class MapClass;
 
-class AStarSearch {
+/**
+    This class holds the per tile data needed by AStarSearch. It is owned by the map and reused by every search
+    instead of allocating and clearing a new array for every search. Every search gets a new generation number and
+    the data of a tile is only valid if its generation matches the current one. Thus only one AStarSearch may use
+    the workspace at a time.
+*/
+class AStarSearchWorkspace {
 public:
-    AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord destination);
-    ~AStarSearch();
+    static const Uint8 TILEFLAG_CLOSED = 0x01;
+    static const Uint8 TILEFLAG_INOPENLIST = 0x02;
 
-    std::list<Coord> getFoundPath() {
-        std::list<Coord> path;
+    static const Uint8 NO_PARENT = 0xFF;
+
+    struct TileData {
+        Uint16  generation;     ///< the search generation this data belongs to
+        Uint8   flags;          ///< combination of TILEFLAG_CLOSED and TILEFLAG_INOPENLIST
+        Uint8   parentAngle;    ///< the direction to the parent tile or NO_PARENT
+        Uint32  openListIndex;
+        FixPoint g;
+        FixPoint f;
+    };
 
-        if(bestCoord.x == INVALID_POS || bestCoord.y == INVALID_POS) {
-            return path;
+    AStarSearchWorkspace(int sizeX, int sizeY);
+    ~AStarSearchWorkspace();
+
+    /**
+        Starts a new search. All tile data from previous searches gets invalid.
+    */
+    void beginSearch();
+
+    inline TileData& getTileData(const Coord& coord) {
+        TileData& tileData = mapData[coord.y * sizeX + coord.x];
+        if(tileData.generation != generation) {
+            tileData.generation = generation;
+            tileData.flags = 0;
+            tileData.parentAngle = NO_PARENT;
+            tileData.openListIndex = 0;
+            tileData.g = 0;
+            tileData.f = 0;
         }
+        return tileData;
+    };
 
-        Coord currentCoord = bestCoord;
-        while(true) {
-            Coord nextCoord = MapData(currentCoord).parentCoord;
+    inline int getSizeX() const { return sizeX; };
+    inline int getSizeY() const { return sizeY; };
 
-            if(nextCoord.x == INVALID_POS || nextCoord.y == INVALID_POS) {
-                break;
-            }
+    std::vector<Coord> openList;    ///< the open list (a binary heap); it is kept to reuse its memory
 
-            path.push_front(currentCoord);
-            currentCoord = nextCoord;
-        }
+private:
+    int         sizeX;
+    int         sizeY;
+    Uint16      generation;
+    TileData*   mapData;
+};
 
-        return path;
-    };
+class AStarSearch {
+public:
+    AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord destination);
+    ~AStarSearch();
+
+    std::list<Coord> getFoundPath();
 
 private:
-    struct TileData {
-        bool    bClosed;
-        bool    bInOpenList;
-        size_t  openListIndex;
-        Coord   parentCoord;
-        float   g;
-        float   h;
-        float   f;
-    };
+    typedef AStarSearchWorkspace::TileData TileData;
 
+    inline TileData& MapData(const Coord& coord) const { return pWorkspace->getTileData(coord); };
 
-    inline TileData& MapData(const Coord& coord) const { return mapData[coord.y * sizeX + coord.x]; };
+    /**
+        Returns the parent of the tile at coord or Coord(INVALID_POS,INVALID_POS) if there is none
+    */
+    Coord getParentCoord(const Coord& coord) const;
 
     void trickleUp(int openListIndex) {
+        std::vector<Coord>& openList = pWorkspace->openList;
         Coord bottom = openList[openListIndex];
-        float newf = MapData(bottom).f;
+        FixPoint newf = MapData(bottom).f;
 
         size_t current = openListIndex;
         size_t parent = (openListIndex - 1)/2;
@@ -88,39 +121,40 @@ private:
         MapData(openList[current]).openListIndex = current;
     };
 
-    void putOnOpenListIfBetter(const Coord& coord, const Coord& parentCoord, float g, float h) {
-        float f = g + h;
+    void putOnOpenListIfBetter(const Coord& coord, Uint8 parentAngle, FixPoint g, FixPoint h) {
+        std::vector<Coord>& openList = pWorkspace->openList;
+        FixPoint f = g + h;
 
-        if(MapData(coord).bInOpenList == false) {
+        TileData& tileData = MapData(coord);
+        if((tileData.flags & AStarSearchWorkspace::TILEFLAG_INOPENLIST) == 0) {
             // not yet in openlist => add at the end of the open list
-            MapData(coord).g = g;
-            MapData(coord).h = h;
-            MapData(coord).f = f;
-            MapData(coord).parentCoord = parentCoord;
-            MapData(coord).bInOpenList = true;
+            tileData.g = g;
+            tileData.f = f;
+            tileData.parentAngle = parentAngle;
+            tileData.flags |= AStarSearchWorkspace::TILEFLAG_INOPENLIST;
             openList.push_back(coord);
-            MapData(coord).openListIndex = openList.size() - 1;
+            tileData.openListIndex = openList.size() - 1;
 
             trickleUp(openList.size() - 1);
         } else {
             // already on openlist
-            if(f >= MapData(coord).f) {
+            if(f >= tileData.f) {
                 // new item is worse => don't change anything
                 return;
             } else {
                 // new item is better => replace
-                MapData(coord).g = g;
-                MapData(coord).h = h;
-                MapData(coord).f = f;
-                MapData(coord).parentCoord = parentCoord;
-                trickleUp(MapData(coord).openListIndex);
+                tileData.g = g;
+                tileData.f = f;
+                tileData.parentAngle = parentAngle;
+                trickleUp(tileData.openListIndex);
             }
         }
     };
 
     Coord extractMin() {
+        std::vector<Coord>& openList = pWorkspace->openList;
         Coord ret = openList[0];
-        MapData(ret).bInOpenList = false;
+        MapData(ret).flags &= ~AStarSearchWorkspace::TILEFLAG_INOPENLIST;
 
         openList[0] = openList.back();
         MapData(openList[0]).openListIndex = 0;
@@ -128,7 +162,7 @@ private:
 
         size_t current = 0;
         Coord top = openList[current];  // save root
-        float topf = MapData(top).f;
+        FixPoint topf = MapData(top).f;
         while(current < openList.size()/2) {
 
             size_t leftChild = 2*current+1;
@@ -138,10 +172,10 @@ private:
 
             // find smaller child
             size_t smallerChild;
-            float smallerChildf;
+            FixPoint smallerChildf;
             if(rightChild < openList.size()) {
-                float leftf = MapData(openList[leftChild]).f;
-                float rightf = MapData(openList[rightChild]).f;
+                FixPoint leftf = MapData(openList[leftChild]).f;
+                FixPoint rightf = MapData(openList[rightChild]).f;
 
                 if(leftf < rightf) {
                     smallerChild = leftChild;
@@ -174,11 +208,9 @@ private:
         return ret;
     };
 
-    int sizeX;
-    int sizeY;
+    MapClass* pMap;
+    AStarSearchWorkspace* pWorkspace;
     Coord bestCoord;
-    TileData* mapData;
-    std::vector<Coord> openList;
 };
 
 #endif //ASTARSEARCH_H
@@ -23,12 +23,14 @@
 #include <DataTypes.h>
 #include <ScreenBorder.h>
 #include <misc/Stream.h>
+#include <misc/IntrusiveList.h>
+#include <misc/MemoryPool.h>
 
 // forward declarations
 class House;
 
 
-class BulletClass
+class BulletClass : public IntrusiveListHook
 {
 public:
 	BulletClass(Uint32 shooterID, Coord* newLocation, Coord* newDestination, Uint32 bulletID, int damage, bool air);
@@ -36,6 +38,14 @@ public:
 	int init();
 	~BulletClass();
 
+	/**
+		Objects of this class are allocated from a MemoryPool to avoid a heap allocation for every shot.
+	*/
+	static void* operator new(size_t size) { return memoryPool.allocate(size); }
+	static void operator delete(void* p, size_t size) { memoryPool.deallocate(p, size); }
+
+	static inline MemoryPool& getMemoryPool() { return memoryPool; }
+
 	void save(Stream& stream) const;
 
 	void blitToScreen();
@@ -44,20 +54,22 @@ public:
 	void destroy();
 
 	inline bool isDirectShot() const { return ((source.x == destination.x) && (source.y == destination.y)); }
-	inline int getDrawnX() const { return screenborder->world2screenX(realX - imageW/2); }
-	inline int getDrawnY() const { return screenborder->world2screenY(realY - imageH/2); }
+	inline int getDrawnX() const { return screenborder->world2screenX((realX - imageW/2).toInt()); }
+	inline int getDrawnY() const { return screenborder->world2screenY((realY - imageH/2).toInt()); }
 	inline int getBulletID() const { return bulletID; }
 	inline int getImageW() const { return imageW; }
 	inline int getImageH() const { return imageH; }
 	inline Coord getImageSize() const { return Coord(imageW, imageH); }
-	inline double getRealX() const { return realX; }
-	inline double getRealY() const { return realY; }
+	inline FixPoint getRealX() const { return realX; }
+	inline FixPoint getRealY() const { return realY; }
 
 private:
+    static MemoryPool memoryPool;   ///< The pool all bullets are allocated from
+
     // constants for each bullet type
     int     damageRadius;       ///< The radius of the bullet
     bool    groundBlocked;      ///< false = bullet goes through objects, true = bullet explodes at ground objects
-    double  speed;              ///< The speed of this bullet
+    FixPoint speed;             ///< The speed of this bullet
 
     // bullet state
     Uint32  bulletID;           ///< The ID of the bullet
@@ -71,14 +83,14 @@ private:
 	Coord   source;             ///< the source location (in world coordinates) of this bullet
 	Coord	destination;        ///< the destination (in world coordinates) of this bullet
 	Coord   location;           ///< the current location of this bullet (in map coordinates)
-	double  realX;              ///< the x-coordinate of the current position (in world coordinates)
-	double  realY;              ///< the y-coordinate of the current position (in world coordinates)
+	FixPoint realX;             ///< the x-coordinate of the current position (in world coordinates)
+	FixPoint realY;             ///< the y-coordinate of the current position (in world coordinates)
 
-	double  xSpeed;             ///< Speed in x direction
-	double	ySpeed;             ///< Speed in x direction
+	FixPoint xSpeed;            ///< Speed in x direction
+	FixPoint ySpeed;            ///< Speed in y direction
 
 	Sint8   drawnAngle;         ///< the drawn angle of the bullet
-	double	angle;              ///< the angle of the bullet
+	FixPoint angle;             ///< the angle of the bullet
 
 	// drawing information
 	SDL_Surface*    graphic;    ///< The graphic of the bullet
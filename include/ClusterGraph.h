@@ -0,0 +1,179 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CLUSTERGRAPH_H
+#define CLUSTERGRAPH_H
+
+#include <DataTypes.h>
+#include <FixPoint.h>
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+class MapClass;
+
+/**
+    The ClusterGraph is an abstraction of the map used for hierarchical path finding (HPA*). The map is divided
+    into clusters of CLUSTERSIZE x CLUSTERSIZE tiles. Neighbouring clusters are connected through entrances on
+    their common border and the distances between all entrances of one cluster are precalculated. A long path is
+    first searched on this small graph and only the first leg (up to the next cluster) is searched with AStarSearch.
+    Only the terrain and structures are considered; units are ignored.
+
+    There is one graph for every movement class. Each graph is built on first use and only the clusters around
+    changed tiles are rebuilt afterwards (see tileChanged()). The search nodes and the open list are reused by every
+    query (like AStarSearchWorkspace), so a query does not allocate memory once they have grown to their final size.
+*/
+class ClusterGraph {
+public:
+    static const int CLUSTERSIZE = 16;
+
+    ClusterGraph(MapClass* pMap);
+    ~ClusterGraph();
+
+    /**
+        Informs the graph that the terrain type of the tile at pos changed or that a structure was placed on it or removed from it.
+        The affected clusters are rebuilt on the next query.
+        \param  pos the position of the changed tile
+    */
+    void tileChanged(const Coord& pos);
+
+    /**
+        Marks all clusters of all movement classes as changed. This is needed after the whole map was loaded.
+    */
+    void invalidateAll();
+
+    /**
+        Checks if a tile can be passed by units of the specified movement class. Only terrain and structures are considered.
+        \param  movementClass   the movement class to check
+        \param  x               the x coordinate of the tile
+        \param  y               the y coordinate of the tile
+        \return true if passable, false otherwise
+    */
+    bool isPassable(MOVEMENTCLASS movementClass, int x, int y) const;
+
+    /**
+        Searches an abstract path from start to destination and returns the first waypoint on it that lies outside the cluster
+        of start. If start and destination are in the same or in neighbouring clusters or if no abstract path is found
+        destination is returned.
+        \param  movementClass   the movement class of the unit to move
+        \param  start           the start tile
+        \param  destination     the destination tile
+        \return the tile the unit should move to next
+    */
+    Coord getNextWaypoint(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination);
+
+private:
+    /// One entrance tile of a cluster
+    struct ClusterNode {
+        Coord               pos;        ///< the position of this entrance tile
+        std::vector<Coord>  partners;   ///< the entrance tiles in the neighbouring clusters directly reachable from here
+    };
+
+    struct Cluster {
+        bool                        bDirty;     ///< must this cluster be rebuilt before the next query
+        std::vector<ClusterNode>    nodes;      ///< all entrance tiles of this cluster
+        std::vector<FixPoint>       distances;  ///< the distances between all nodes (nodes.size() x nodes.size()); negative if not reachable
+    };
+
+    struct Graph {
+        bool                    bBuilt;     ///< has this graph been built yet
+        bool                    bDirty;     ///< is at least one cluster dirty
+        std::vector<Cluster>    clusters;   ///< all clusters stored row by row
+    };
+
+    /**
+        One node of the abstract search in getNextWaypoint(). The nodes are kept in searchNodes and reused by every search;
+        a node is only valid if its generation matches searchGeneration.
+    */
+    struct SearchNode {
+        Uint16  generation; ///< the search generation this node belongs to
+        bool    bClosed;    ///< has this node already been expanded
+        int     parent;     ///< the key of the parent node
+        FixPoint g;         ///< the cost from the start
+    };
+
+    /// An entry of the open list: the (estimated) cost and the key of the node
+    typedef std::pair<FixPoint, int> OpenListEntry;
+
+    /// The key of the start node; all other nodes have the key y*sizeX+x of their tile
+    static const int START_KEY = -1;
+    /// The key of the goal node
+    static const int GOAL_KEY = -2;
+
+    Graph& getGraph(MOVEMENTCLASS movementClass);
+
+    void update(MOVEMENTCLASS movementClass);
+    void rebuildCluster(MOVEMENTCLASS movementClass, int clusterX, int clusterY);
+    void addEntrances(MOVEMENTCLASS movementClass, Cluster& cluster, int x, int y, int dx, int dy, int partnerDx, int partnerDy, int length);
+    void addNode(Cluster& cluster, const Coord& pos, const Coord& partner);
+
+    /**
+        Calculates the distances from the tile start to all tiles of its cluster. start itself need not be passable.
+        \param  movementClass   the movement class to use
+        \param  start           the start tile
+        \param  distances       is filled with the distances to all tiles of the cluster (negative if not reachable)
+    */
+    void calculateDistances(MOVEMENTCLASS movementClass, const Coord& start, std::vector<FixPoint>& distances);
+
+    /**
+        Starts a new search in getNextWaypoint(). All search nodes from previous searches get invalid.
+    */
+    void beginSearch();
+
+    inline SearchNode& getSearchNode(int key) {
+        SearchNode& node = searchNodes[key - GOAL_KEY];
+        if(node.generation != searchGeneration) {
+            node.generation = searchGeneration;
+            node.bClosed = false;
+            node.parent = START_KEY;
+            node.g = 0;
+        }
+        return node;
+    };
+
+    void pushOpenList(FixPoint cost, int key) {
+        openList.push_back(OpenListEntry(cost, key));
+        std::push_heap(openList.begin(), openList.end(), std::greater<OpenListEntry>());
+    };
+
+    OpenListEntry popOpenList() {
+        std::pop_heap(openList.begin(), openList.end(), std::greater<OpenListEntry>());
+        OpenListEntry entry = openList.back();
+        openList.pop_back();
+        return entry;
+    };
+
+    inline int getClusterIndex(const Coord& pos) const { return (pos.y/CLUSTERSIZE)*numClustersX + (pos.x/CLUSTERSIZE); };
+    inline int getLocalIndex(const Coord& pos) const { return (pos.y % CLUSTERSIZE)*CLUSTERSIZE + (pos.x % CLUSTERSIZE); };
+
+    MapClass*   pMap;
+    int         numClustersX;
+    int         numClustersY;
+    Graph       graphs[NUM_MOVEMENTCLASSES];
+
+    // the search workspace; it is reused by every query so that a query does not allocate memory
+    Uint16                              searchGeneration;   ///< the generation of the current search
+    std::vector<SearchNode>             searchNodes;        ///< the search nodes indexed by key - GOAL_KEY
+    std::vector<OpenListEntry>          openList;           ///< the open list (a binary heap)
+    std::vector<std::pair<int, FixPoint> > successors;      ///< the successors of the node currently expanded
+    std::vector<int>                    path;               ///< the found abstract path (from the goal backwards)
+    std::vector<FixPoint>               startDistances;     ///< the distances from the start to the tiles of its cluster
+    std::vector<FixPoint>               destDistances;      ///< the distances from the destination to the tiles of its cluster
+};
+
+#endif // CLUSTERGRAPH_H
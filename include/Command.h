@@ -20,7 +20,6 @@
 
 #include <misc/Stream.h>
 
-#include <vector>
 #include <SDL.h>
 
 typedef enum {
@@ -52,10 +51,12 @@ typedef enum {
 
 /**
     This class represents one command with all its parameters. The command is specified by CommandID (see CMDTYPE)
-    and Parameter holds all its parameters (see the documentation for every CMDTYPE). There can be up to 4 parameters
+    and Parameter holds all its parameters (see the documentation for every CMDTYPE). There can be up to 4 parameters.
+    The parameters are stored inside the command, so creating and copying commands needs no memory allocation.
 */
 class Command {
 public:
+    static const Uint32 MAX_PARAMETERS = 4;     ///< the maximum number of parameters of one command
 
     /**
         Construct a command with CMDTYPE id and no parameter.
@@ -97,6 +98,14 @@ public:
     */
 	Command(CMDTYPE id, Uint32 parameter1, Uint32 parameter2, Uint32 parameter3, Uint32 parameter4);
 
+    /**
+        Construct a command with CMDTYPE id and numParameters parameters.
+        \param  id              the id of the command
+        \param  numParameters   the number of parameters (at most MAX_PARAMETERS)
+        \param  parameters      the parameters
+    */
+	Command(CMDTYPE id, Uint32 numParameters, const Uint32* parameters);
+
     /**
         Construct a command from raw memory.
         \param  data        pointer to the data
@@ -119,6 +128,25 @@ public:
     */
 	void save(Stream& stream) const;
 
+    /**
+        Returns the type of this command.
+        \return the id of this command
+    */
+	CMDTYPE getCommandID() const { return CommandID; };
+
+    /**
+        Returns the number of parameters of this command.
+        \return the number of parameters
+    */
+	Uint32 getNumParameters() const { return numParameters; };
+
+    /**
+        Returns the i-th parameter of this command.
+        \param  i   the index of the parameter (0 <= i < getNumParameters())
+        \return the parameter
+    */
+	Uint32 getParameter(Uint32 i) const { return Parameter[i]; };
+
     /**
         Executes this command. This takes the appropriate actions to run this command.
     */
@@ -126,7 +154,8 @@ public:
 
 private:
 	CMDTYPE CommandID;                  ///< the type of command
-	std::vector<Uint32> Parameter;      ///< the parameters for this command
+	Uint32  numParameters;              ///< the number of parameters for this command
+	Uint32  Parameter[MAX_PARAMETERS];  ///< the parameters for this command
 };
 
 #endif // COMMAND_H
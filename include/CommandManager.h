@@ -23,10 +23,13 @@
 #include <misc/Stream.h>
 
 #include <vector>
-#include <list>
 
 /**
     The command manager collects all the given user commands (e.g. move unit u to position (x,y)) . These commands might be transfered over a network.
+
+    All commands are kept in a compact binary encoding sorted by the game cycle they are scheduled for. Every command takes
+    only a few bytes (see encodeCommand()), so even the commands of very long games need little memory. The same encoding
+    is used for replays and savegames. executeCommands() decodes the commands of the current game cycle without allocating any memory.
 */
 class CommandManager {
 public:
@@ -66,9 +69,11 @@ public:
 
     /**
         Save all commands to stream. The read-only status is not saved.
-        \param  stream  the stream to write to
+        \param  stream          the stream to write to
+        \param  bStoreLength    true if the length of the commands shall be stored, so that more data can follow in the stream;
+                                false if the commands are at the very end of the stream
     */
-	void save(Stream& stream) const;
+	void save(Stream& stream, bool bStoreLength = false) const;
 
     /**
         Load commands from stream
@@ -83,22 +88,44 @@ public:
 	void addCommand(Command cmd);
 
     /**
-        Adds a command at the game cycle CycleNumber
+        Adds a command at the game cycle CycleNumber. CycleNumber must not be before the game cycle of the last added command.
+        A command for a game cycle that was already executed is recorded but never executed.
         \param  cmd         the command to add
         \param  CycleNumber the game cycle this command shall take effect
     */
 	void addCommand(Command cmd, Uint32 CycleNumber);
 
     /**
-        Runs all commands scheduled for game cycle CycleNumber
+        Runs all commands scheduled for game cycle CycleNumber. This method must be called with increasing game cycles.
         \param  CycleNumber the current game cycle
     */
-	void executeCommands(Uint32 CycleNumber) const;
+	void executeCommands(Uint32 CycleNumber);
 
 private:
-	std::vector< std::list<Command> > timeslot;     ///< a vector of lists containing the scheduled commands. At index x is a list of all commands scheduled for game cycle x.
-	Stream* pStream;                                ///< a stream all added commands will be written to. May be NULL
-	bool bReadOnly;                                 ///< true = addCommand() is a NO-OP, false = addCommand() has normal behaviour
+    /**
+        Appends cmd to commandData. A command is encoded as the number of game cycles since the previous command, the command id,
+        the number of parameters and the parameters. All numbers except the command id and the number of parameters are stored with 7 bits
+        per byte, the highest bit marking that another byte follows.
+        \param  cmd         the command to encode
+        \param  CycleNumber the game cycle of the command
+    */
+	void encodeCommand(const Command& cmd, Uint32 CycleNumber);
+
+    /**
+        Decodes the command at position pos of data.
+        \param  data        the encoded commands
+        \param  pos         the position of the command to decode; it is set to the position of the next command
+        \param  cycleDelta  the number of game cycles since the previous command is stored here
+        \return the decoded command
+    */
+	static Command decodeCommand(const std::vector<Uint8>& data, size_t& pos, Uint32& cycleDelta);
+
+	std::vector<Uint8> commandData;     ///< all commands in the compact encoding (see encodeCommand()) sorted by game cycle
+	Uint32 lastCycle;                   ///< the game cycle of the last command in commandData
+	size_t executePos;                  ///< the position in commandData of the first command that executeCommands() has not looked at yet
+	Uint32 executeCycle;                ///< the game cycle of the command before executePos
+	Stream* pStream;                    ///< a stream all added commands will be written to. May be NULL
+	bool bReadOnly;                     ///< true = addCommand() is a NO-OP, false = addCommand() has normal behaviour
 };
 
 #endif // COMMANDMANAGER_H
@@ -20,10 +20,9 @@
 
 #include <list>
 
-template <class T> class ConcatIterator {
+template <class T, class TList = std::list<T> > class ConcatIterator {
 
 private:
-	typedef std::list<T> TList;
 	typedef TList* TListPointer;
 	typedef typename TList::iterator TList_Iter;
 	typedef std::list< TListPointer> TListOfList;
@@ -37,7 +36,7 @@ public:
 	ConcatIterator() { };
 	~ConcatIterator() { };
 
-	void addList(std::list<T>& _List) {
+	void addList(TList& _List) {
 		if(_List.empty()) {
 			// ignore this list
 			return;
@@ -207,4 +207,14 @@ typedef enum {
     NUM_ANGLES
 } ANGLETYPE;
 
+/// The movement classes decide which tiles a unit can pass
+typedef enum {
+    MOVEMENTCLASS_TRACKED,      ///< tracked vehicles; can pass everything except mountains and structures
+    MOVEMENTCLASS_WHEELED,      ///< wheeled vehicles; same terrain as tracked vehicles but cannot squash infantry
+    MOVEMENTCLASS_INFANTRY,     ///< infantry; can also climb mountains
+    MOVEMENTCLASS_SANDWORM,     ///< sandworms; cannot leave the sand
+    MOVEMENTCLASS_AIR,          ///< air units; can pass every tile
+    NUM_MOVEMENTCLASSES
+} MOVEMENTCLASS;
+
 #endif //DATATYPES_H
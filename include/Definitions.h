@@ -29,7 +29,7 @@
 
 
 #define SAVEMAGIC           8675309
-#define SAVEGAMEVERSION     9600
+#define SAVEGAMEVERSION     9604
 
 #ifndef M_PI
     #define M_PI 3.1415926535897932384626433832795
@@ -38,6 +38,10 @@
 #define DIAGONALSPEEDCONST 0.70710678118654752440084436210485
 #define DIAGONALCOST 1.4142135623730950488016887242097
 
+// the same constants as FixPoint (see FixPoint.h) for the simulation
+#define FIX_DIAGONALSPEEDCONST FixPoint::fromRaw(46341)
+#define FIX_DIAGONALCOST FixPoint::fromRaw(92682)
+
 
 #define GAMESPEED_MAX 32
 #define GAMESPEED_MIN 8
@@ -69,16 +73,17 @@
 #define INVALID (-1)
 
 #define DEVIATIONTIME MILLI2CYCLES(120*1000)
+#define FOGTIMEOUT MILLI2CYCLES(10*1000)    // a tile not seen for this long is fogged again
 #define HARVESTERMAXSPICE 700
-#define HARVESTSPEED 0.1
-#define HEAVILYDAMAGEDRATIO 0.3	//if health/getMaxHealth() < this, when damaged will become heavily damage- smoke and shit
-#define HEAVILYDAMAGEDSPEEDMULTIPLIER 0.75	// 0.666666666666
+#define HARVESTSPEED FixPoint::fromFraction(1, 10)
+#define HEAVILYDAMAGEDRATIO FixPoint::fromFraction(3, 10)	//if health/getMaxHealth() < this, when damaged will become heavily damage- smoke and shit
+#define HEAVILYDAMAGEDSPEEDMULTIPLIER FixPoint::fromRaw(49152)	// 0.75 (0.666666666666)
 #define RANDOMTURNTIMER 2000	//less of this makes units randomly turn more
 #define NUMSELECTEDLISTS 9
 #define NUM_INFANTRY_PER_CELL 5		//how many infantry can fit in a cell
 #define LASTSANDFRAME 2	//is number spice output frames - 1
 
-#define UNIT_REPAIRCOST 0.1
+#define UNIT_REPAIRCOST FixPoint::fromFraction(1, 10)
 #define DEFAULT_GUARDRANGE 10			//0 - 10, how far unit will search for enemy when guarding
 #define DEFAULT_STARTINGCREDITS 3000
 
@@ -20,10 +20,12 @@
 
 #include <DataTypes.h>
 #include <misc/Stream.h>
+#include <misc/IntrusiveList.h>
+#include <misc/MemoryPool.h>
 
 #include <SDL.h>
 
-class Explosion
+class Explosion : public IntrusiveListHook
 {
 public:
     Explosion();
@@ -31,6 +33,14 @@ public:
     Explosion(Stream& stream);
     ~Explosion();
 
+    /**
+    	Objects of this class are allocated from a MemoryPool to avoid a heap allocation for every explosion.
+    */
+    static void* operator new(size_t size) { return memoryPool.allocate(size); }
+    static void operator delete(void* p, size_t size) { memoryPool.deallocate(p, size); }
+
+    static inline MemoryPool& getMemoryPool() { return memoryPool; }
+
     void init();
 
     void save(Stream& stream) const;
@@ -40,6 +50,8 @@ public:
     void update();
 
 private:
+    static MemoryPool memoryPool;   ///< The pool all explosions are allocated from
+
     Uint32 explosionID;
     Coord position;
     int house;
@@ -39,6 +39,14 @@ public:
 		}
 	}
 
+	Uint32 getFrameDurationTime() const { return FrameDurationTime; }
+
+	void setFrameDurationTime(Uint32 frameDurationTime) { FrameDurationTime = frameDurationTime; }
+
+	unsigned int getNumFrames() const { return Frames.size(); }
+
+	SDL_Surface* getFrameSurface(unsigned int index) const { return Frames[index]; }
+
 	void addFrame(SDL_Surface* newFrame, bool DoublePic = false,bool SetColorKey = false);
 
 	void setPalette(const Palette& newPalette);
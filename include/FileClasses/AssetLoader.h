@@ -0,0 +1,152 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASSETLOADER_H
+#define ASSETLOADER_H
+
+#include <SDL.h>
+#include <SDL_thread.h>
+#include <SDL_mutex.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <deque>
+
+/// A class for decoding many assets in parallel.
+/**
+	Every asset is decoded by a Task. The tasks are decoded on a pool of worker threads (one per processor) and the
+	decoded assets are handed over on the thread that called run(), so the owners of the assets (e.g. the GFXManager)
+	never see a half decoded asset and SDL video functions are only called on the main thread.
+
+	A task can depend on other tasks, e.g. a concatenated voice depends on its parts. It is not decoded before all
+	its dependencies were decoded and handed over.
+*/
+class AssetLoader
+{
+public:
+	/// One asset to decode
+	class Task {
+	public:
+		Task(const std::string& name) : name(name) {
+		}
+
+		virtual ~Task() {
+		}
+
+		/**
+			Decodes the asset. This method is called on a worker thread, so it must only touch its own data,
+			the results of its dependencies and other thread-safe things like pFileManager. Surfaces must be created
+			with SDL_SWSURFACE, as hardware surfaces are allocated by the video driver. Errors are reported by
+			throwing an exception.
+		*/
+		virtual void decode() = 0;
+
+		/**
+			Hands the decoded asset over to its owner. This method is called on the thread that called run().
+		*/
+		virtual void finish() = 0;
+
+		const std::string& getName() const { return name; }
+
+	private:
+		std::string name;	///< the name of the asset (e.g. the filename)
+	};
+
+	/**
+		The progress callback is called on the thread that called run() after each finished task.
+		\param	stage		the name of the loader (e.g. "graphics")
+		\param	numFinished	the number of finished tasks
+		\param	numTasks	the number of all tasks
+	*/
+	typedef void (*ProgressCallback)(const std::string& stage, int numFinished, int numTasks);
+
+	/**
+		Constructor.
+		\param	stage	the name of this loader used for the progress callback and the statistics
+	*/
+	AssetLoader(const std::string& stage);
+	~AssetLoader();
+
+	/**
+		Adds a new task without dependencies. The loader takes ownership of pTask.
+		\param	pTask	the task to add
+		\return	the id of the task
+	*/
+	int addTask(Task* pTask);
+
+	/**
+		Adds a new task that is decoded after the given tasks. The loader takes ownership of pTask.
+		\param	pTask			the task to add
+		\param	dependencies	the ids of the tasks that have to be finished first
+		\return	the id of the task
+	*/
+	int addTask(Task* pTask, const std::vector<int>& dependencies);
+
+	/**
+		Decodes all tasks and hands them over. This method returns after all tasks are finished. If a task
+		fails all other tasks are stopped and a std::runtime_error is thrown.
+	*/
+	void run();
+
+	/**
+		Prints the decode time of every task and the speedup by the worker threads.
+		\param	pFile	the file to print to
+	*/
+	void printStatistics(FILE* pFile) const;
+
+	static void setProgressCallback(ProgressCallback pCallback) { pProgressCallback = pCallback; }
+
+	/**
+		Enables the startup benchmark. Every loader prints its statistics to stdout after run().
+		\param	bEnable	true for enabling the benchmark
+	*/
+	static void setBenchmark(bool bEnable) { bBenchmark = bEnable; }
+	static bool isBenchmark() { return bBenchmark; }
+
+private:
+	/// The state of one task
+	struct TaskEntry {
+		Task*				pTask;
+		std::vector<int>	dependents;					///< the tasks that depend on this task
+		int					numOpenDependencies;		///< the number of dependencies that are not finished yet
+		Uint32				decodeTime;					///< the time decode() took in ms
+		std::string			error;						///< the error message if decode() failed
+	};
+
+	void decodeTask(int id);
+
+	static int workerMain(void* pData);
+
+	static int getNumProcessors();
+
+	std::string				stage;
+	std::vector<TaskEntry>	tasks;
+	Uint32					wallTime;					///< the time run() took in ms
+	int						numThreads;					///< the number of worker threads used by run()
+
+	SDL_mutex*				pMutex;						///< protects everything below
+	SDL_cond*				pWorkAvailable;				///< signaled when readyTasks gets a new task or bQuit is set
+	SDL_cond*				pTaskDecoded;				///< signaled when decodedTasks gets a new task
+	std::deque<int>			readyTasks;					///< the tasks that can be decoded now
+	std::deque<int>			decodedTasks;				///< the tasks that wait for being finished
+	bool					bQuit;						///< tells the worker threads to stop
+
+	static ProgressCallback	pProgressCallback;
+	static bool				bBenchmark;
+};
+
+#endif // ASSETLOADER_H
@@ -20,6 +20,8 @@
 
 #include "Pakfile.h"
 
+#include <misc/unordered_map.h>
+
 #include <SDL_rwops.h>
 #include <SDL.h>
 #include <string>
@@ -28,6 +30,8 @@
 /// A class for loading all the PAK-Files.
 /**
 	This class manages all the PAK-Files and provides access to the contained files through SDL_RWops.
+	When constructed it builds one index of all files in the search paths and in the PAK-Files. Files in the search
+	paths take precedence over files in PAK-Files. All lookups are case insensitive and need no directory scanning.
 */
 class FileManager {
 public:
@@ -45,10 +49,32 @@ public:
 	SDL_RWops* OpenFile(std::string Filename);
 
 	bool exists(std::string Filename);
+
+	/**
+		Returns the checksums of all loaded PAK-Files. This can be used to check if something derived from the
+		data files (e.g. a cache) is still up to date.
+		\return	the MD5 checksums and names of all PAK-Files
+	*/
+	std::string getDataChecksum() const { return dataChecksum; }
 private:
+	/// The location of one file in the index
+	struct FileLocation {
+		std::string		externalPath;	///< the path of the file in a search path (only if pPakfile is NULL)
+		Pakfile*		pPakfile;		///< the PAK-File containing this file or NULL if it is an external file
+		unsigned int	pakIndex;		///< the index of the file inside pPakfile
+	};
+
     std::string md5FromFilename(std::string filename);
 
+    void buildIndex();
+
+    bool findFile(const std::string& Filename, FileLocation& location) const;
+
+    static std::string getIndexKey(std::string Filename);
+
 	std::vector<Pakfile*> PakFiles;
+	std::string dataChecksum;									///< the MD5 checksums and names of all PAK-Files
+	std::unordered_map<std::string, FileLocation> fileIndex;	///< all files in the search paths and the PAK-Files by their upper case name
 };
 
 #endif // FILEMANAGER_H
@@ -23,6 +23,8 @@
 
 #include <misc/memory.h>
 #include <string>
+#include <list>
+#include <map>
 
 typedef enum {
 	FONT_STD10,
@@ -34,6 +36,10 @@ typedef enum {
 /// A class for managing fonts.
 /**
 	This class manages all fonts used in Dune Legacy and provides methods for rendering texts with a specific font.
+
+	For every font and color that is used all characters are drawn once onto a glyph atlas. Texts are then drawn by
+	blitting the characters from the atlas. Texts that are drawn every frame should either be drawn with drawText()
+	or be taken from the cache of rendered texts (see getCachedSurfaceWithText()), so no surface is created per frame.
 */
 class FontManager
 {
@@ -46,9 +52,86 @@ public:
 	int getTextHeight(unsigned int FontNum);
 	SDL_Surface* createSurfaceWithText(std::string text, unsigned char color, unsigned int FontNum);
 	SDL_Surface* createSurfaceWithMultilineText(std::string text, unsigned char color, unsigned int FontNum, bool bCentered = false);
+
+	/**
+		Draws text directly onto pSurface by blitting the characters from the glyph atlas. No surface is created, so this is
+		the method to use for texts that change every frame.
+		\param	pSurface	the surface to draw on
+		\param	text		the text to draw
+		\param	color		the color of the text
+		\param	FontNum		the font to use
+		\param	x			the x coordinate of the top left corner of the text on pSurface
+		\param	y			the y coordinate of the top left corner of the text on pSurface
+	*/
+	void drawText(SDL_Surface* pSurface, const std::string& text, unsigned char color, unsigned int FontNum, int x, int y);
+
+	/**
+		Returns a surface with text on it like createSurfaceWithText(). The surface is taken from a cache of the last
+		TEXTCACHESIZE rendered texts and is only created if text was not rendered recently with this font and color.
+		The surface belongs to the cache: It must not be freed and must not be kept after other texts are requested.
+		\param	text	the text to render
+		\param	color	the color of the text
+		\param	FontNum	the font to use
+		\return	the cached surface (NULL on error)
+	*/
+	SDL_Surface* getCachedSurfaceWithText(const std::string& text, unsigned char color, unsigned int FontNum);
+
+	/**
+		Returns a surface with multiline text on it like createSurfaceWithMultilineText(). The surface is cached like the
+		ones returned by getCachedSurfaceWithText().
+		\param	text		the text to render (one line per line break)
+		\param	color		the color of the text
+		\param	FontNum		the font to use
+		\param	bCentered	true for centering every line, false for aligning them to the left
+		\return	the cached surface (NULL on error)
+	*/
+	SDL_Surface* getCachedSurfaceWithMultilineText(const std::string& text, unsigned char color, unsigned int FontNum, bool bCentered = false);
+
 private:
+	static const unsigned int TEXTCACHESIZE = 64;	///< the number of rendered texts kept in the cache
+
+	/// All characters of one font in one color drawn in a row
+	struct GlyphAtlas {
+		SDL_Surface* pSurface;	///< the surface with all characters
+		int glyphX[257];		///< the x position of every character on pSurface; character c ends at glyphX[c+1]
+	};
+
+	/// The key of a rendered text in the cache
+	struct TextKey {
+		std::string		text;
+		unsigned int	FontNum;
+		unsigned char	color;
+		bool			bMultiline;
+		bool			bCentered;
+
+		bool operator<(const TextKey& other) const;
+	};
+
+	typedef std::list< std::pair<TextKey, SDL_Surface*> > TextCacheList;
+
+	/**
+		Returns the glyph atlas for this font and color. It is created on first use.
+		\param	color	the color of the characters
+		\param	FontNum	the font (must be valid)
+		\return	the glyph atlas
+	*/
+	const GlyphAtlas& getGlyphAtlas(unsigned char color, unsigned int FontNum);
+
+	/**
+		Looks up key in the cache of rendered texts and renders the text if it is not cached yet. The least recently used
+		text is removed if the cache is full.
+		\param	key	the text to look up
+		\return	the cached surface (NULL on error)
+	*/
+	SDL_Surface* getCachedSurface(const TextKey& key);
+
 	std::shared_ptr<Font> Fonts[NUM_FONTS];
 
+	std::map<int, GlyphAtlas> glyphAtlases;		///< the glyph atlases of every font and color used so far (the key is FontNum*256 + color)
+
+	TextCacheList textCache;									///< the rendered texts; the most recently used first
+	std::map<TextKey, TextCacheList::iterator> textCacheIndex;	///< where every key is stored in textCache
+
 };
 
 #endif // FONTMANAGER_H
@@ -0,0 +1,121 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GFXCACHE_H
+#define GFXCACHE_H
+
+#include <FileClasses/Animation.h>
+
+#include <SDL.h>
+#include <SDL_rwops.h>
+#include <string>
+
+/// A class for storing decoded graphics in one cache file.
+/**
+	The GFXManager stores all its graphics in this cache file once they were decoded from the data files, so later
+	starts only have to read this file. The file starts with a version number and a key (e.g. the checksums of the
+	data files); if one of them differs the cache is outdated and not used.
+
+	Surfaces and animations are written and read in the same order one after another. For reading the cache file is
+	mapped into memory and the pixels of the read surfaces point directly into this mapping, so the GFXCache has to
+	live longer than the surfaces read from it. Only 8-bit surfaces can be stored.
+*/
+class GFXCache
+{
+public:
+	/**
+		Constructor.
+		\param	filename	the path of the cache file
+		\param	key			the key the cache file has to match (e.g. the checksums of the data files)
+	*/
+	GFXCache(std::string filename, std::string key);
+	~GFXCache();
+
+	/**
+		Opens the cache file for reading.
+		\return	true if the cache file exists and matches the version and key, false otherwise
+	*/
+	bool openForReading();
+
+	/**
+		Reads the next surface.
+		\return	the read surface or NULL if NULL was written
+	*/
+	SDL_Surface* readSurface();
+
+	/**
+		Reads the next animation.
+		\return	the read animation or NULL if NULL was written
+	*/
+	Animation* readAnimation();
+
+	/**
+		Reads the next number.
+		\return	the read number
+	*/
+	Uint32 readUint32();
+
+	/**
+		Creates a new cache file. The new file replaces the old one not until finishWriting() is called.
+		\return	true on success, false otherwise
+	*/
+	bool openForWriting();
+
+	/**
+		Writes a surface.
+		\param	pSurface	the surface to write (may be NULL)
+		\return	true on success, false if the surface could not be written
+	*/
+	bool writeSurface(SDL_Surface* pSurface);
+
+	/**
+		Writes an animation.
+		\param	pAnimation	the animation to write (may be NULL)
+		\return	true on success, false if the animation could not be written
+	*/
+	bool writeAnimation(Animation* pAnimation);
+
+	/**
+		Writes a number.
+		\param	value	the number to write
+		\return	true on success, false otherwise
+	*/
+	bool writeUint32(Uint32 value);
+
+	/**
+		Closes the new cache file and replaces the old one.
+		\param	bSuccess	false if writing failed and the new file shall be deleted
+		\return	true if the cache file was written, false otherwise
+	*/
+	bool finishWriting(bool bSuccess);
+
+private:
+	const char* readBytes(Uint32 size);
+	bool writeBytes(const void* pData, Uint32 size);
+
+	std::string	filename;		///< the path of the cache file
+	std::string	key;			///< the key the cache file has to match
+
+	char*		pData;			///< the content of the cache file when opened for reading
+	Uint32		dataSize;		///< the size of pData
+	Uint32		readPos;		///< the current read position in pData
+	bool		bMapped;		///< is pData mapped into memory (or allocated with malloc)?
+
+	SDL_RWops*	pWriteFile;		///< the new cache file when opened for writing
+};
+
+#endif // GFXCACHE_H
@@ -24,6 +24,7 @@
 #include "Wsafile.h"
 #include <DataTypes.h>
 #include "PictureFactory.h"
+#include "GFXCache.h"
 
 #include <string>
 #include <misc/memory.h>
@@ -311,7 +312,34 @@ public:
 	void			DoWindTrapPalatteAnimation();
 
 private:
-	Animation* LoadAnimationFromWsa(std::string filename);
+	/**
+		Decodes all graphics from the data files.
+	*/
+	void loadFromDataFiles();
+
+	/**
+		Frees all graphics except the alpha blending surfaces.
+	*/
+	void freeGraphics();
+
+	/**
+		Returns the path of the graphics cache file.
+		\return	the path of the cache file
+	*/
+	static std::string getCacheFilename();
+
+	/**
+		Reads all graphics from pCache.
+		\return	true on success, false if the cache is missing, outdated or corrupt
+	*/
+	bool loadFromCache();
+
+	/**
+		Remaps all house colored pictures and writes all graphics to cache.
+		\param	cache	the cache to write
+		\return	true on success, false otherwise
+	*/
+	bool saveToCache(GFXCache& cache);
 
     std::shared_ptr<Shpfile>  LoadShpfile(std::string filename);
     std::shared_ptr<Wsafile>  LoadWsafile(std::string filename);
@@ -328,6 +356,8 @@ private:
 	SDL_Surface*    Transparent40Surface;
 	SDL_Surface*    Transparent150Surface;
 
+	GFXCache*		pCache;			///< the cache the graphics were read from or NULL if they were decoded from the data files
+
 	int WindTrapColorTimer;
 };
 
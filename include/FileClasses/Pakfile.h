@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <SDL_rwops.h>
+#include <SDL_mutex.h>
 #include <string>
 #include <vector>
 #include <inttypes.h>
@@ -29,7 +30,8 @@
 ///	A class for reading PAK-Files.
 /**
 	This class can be used to read PAK-Files. PAK-Files are archive files used by Dune2.
-	The files inside the PAK-File can an be read through SDL_RWops.
+	The files inside the PAK-File can an be read through SDL_RWops. Where possible a PAK-File opened for reading
+	is mapped into memory and the SDL_RWops read directly from this mapping without any copying or seeking.
 */
 class Pakfile
 {
@@ -64,6 +66,8 @@ public:
 
 	SDL_RWops* OpenFile(std::string filename);
 
+	SDL_RWops* OpenFile(unsigned int index);
+
 	bool exists(std::string filename);
 
 	void AddFile(SDL_RWops* rwop, std::string filename);
@@ -76,12 +80,21 @@ private:
 
 	void ReadIndex();
 
+	int FindFile(const std::string& filename) const;
+
+	void MapFile();
+	void UnmapFile();
+
 	bool write;
 	SDL_RWops * fPakFile;
 	std::string Filename;
 
 	char* WriteOutData;
 	int	NumWriteOutData;
+
+	const char* pMappedData;	///< the whole PAK-File mapped into memory or NULL if it is not mapped
+	size_t MappedSize;			///< the size of the mapping
+	SDL_mutex* pReadMutex;		///< protects fPakFile when reading from it
 	std::vector<PakFileEntry> FileEntries;
 };
 
@@ -113,6 +113,9 @@ private:
 	Uint16 m_format;
 
 	bool bJustStartedPlaying;
+
+	static const int RENDER_BUFFER_SIZE = 4096;		///< initial size of renderBuffer (in samples)
+	std::vector<int16_t> renderBuffer;				///< the mono samples rendered in callback(); kept to avoid an allocation per callback
 };
 
 #endif
@@ -20,13 +20,11 @@
 #define ADLPLAYER_H
 
 #include <FileClasses/music/MusicPlayer.h>
+#include <FileClasses/music/ADLTrackCache.h>
 
 #include <vector>
 #include <SDL_mixer.h>
 
-// Forward declarations
-class SoundAdlibPC;
-
 class ADLPlayer : public MusicPlayer {
 public:
     ADLPlayer();
@@ -55,10 +53,17 @@ public:
 	*/
 	void setMusic(bool value);
 
+    /*!
+        returns the number of bytes used by rendered music
+    */
+	size_t getMemoryUsage();
+
 private:
+	static const size_t MAX_MUSIC_MEMORY = 32*1024*1024;	///< the number of bytes of rendered music that may be kept
+
 	int currentMusicNum;
 
-	SoundAdlibPC* pSoundAdlibPC;
+	ADLTrackCache trackCache;
 };
 
 #endif // ADLPLAYER_H
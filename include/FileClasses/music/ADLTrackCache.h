@@ -0,0 +1,137 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADLTRACKCACHE_H
+#define ADLTRACKCACHE_H
+
+#include <SDL.h>
+
+#include <string>
+#include <vector>
+#include <list>
+
+// Forward declarations
+class SoundAdlibPC;
+
+/**
+	The ADLTrackCache streams AdLib tracks to the audio device. A track is rendered on demand in the format of the audio device,
+	only as far as it is played, and stored in blocks of BLOCK_SIZE bytes. The rendered blocks are kept, so playing the same
+	track again only copies the kept blocks instead of synthesizing it again.
+
+	Only one track can be rendered at a time because the OPL emulator supports only one instance. Starting another track
+	throws away the blocks of a track that is not completely rendered yet. Tracks longer than the memory limit are not kept;
+	their blocks are freed as soon as they have been played. When a new track is started the least recently played tracks
+	are dropped until the kept tracks fit into the memory limit again.
+
+	read() is called from the audio thread. All other methods must only be called while the audio thread is not inside read()
+	(e.g. while the music hook is removed or the audio device is locked).
+*/
+class ADLTrackCache {
+public:
+	static const int BLOCK_SIZE = 64*1024;		///< the size of one rendered block in bytes
+	static const int RENDER_CHUNK_SIZE = 4096;	///< the number of bytes rendered at once (BLOCK_SIZE must be a multiple of it); the end of a track is detected with this granularity
+
+	/**
+		Constructor
+		\param	maxMemory	the number of bytes of rendered music that may be kept
+	*/
+	ADLTrackCache(size_t maxMemory);
+	~ADLTrackCache();
+
+	/**
+		Starts playing a track from the beginning.
+		\param	filename	the ADL file to play
+		\param	trackNum	the track inside the ADL file
+		\return	true on success, false if the file cannot be opened
+	*/
+	bool play(const std::string& filename, int trackNum);
+
+	/**
+		Stops playing the current track. The rendered blocks are kept.
+	*/
+	void stop();
+
+	/**
+		Checks if the current track has more samples to play.
+		\return	true if there is a current track and its end is not yet reached
+	*/
+	bool isPlaying() const;
+
+	/**
+		Copies the next len bytes of the current track to buffer. Bytes that are not rendered yet are rendered first, but not
+		more than needed for this call. After the end of the track the buffer is filled with silence.
+		\param	buffer	the buffer to fill
+		\param	len		the number of bytes to fill
+	*/
+	void read(Uint8* buffer, int len);
+
+	/**
+		Returns the number of bytes used by all rendered blocks.
+		\return	the memory used by rendered music
+	*/
+	size_t getMemoryUsage() const { return memoryUsage; };
+
+	/**
+		Callback for Mix_HookMusic(). userdata must point to an ADLTrackCache.
+	*/
+	static void callback(void* userdata, Uint8* audiobuf, int len);
+
+private:
+	struct Track {
+		std::string				filename;		///< the ADL file of this track
+		int						trackNum;		///< the track number inside the ADL file
+		std::vector<Uint8*>		blocks;			///< the rendered blocks (NULL for blocks already freed)
+		size_t					length;			///< the number of rendered bytes
+		bool					bFinished;		///< true if the whole track is rendered
+		bool					bKeep;			///< false if the track is too long to be kept
+	};
+
+	/**
+		Renders the next RENDER_CHUNK_SIZE bytes of pRenderTrack and appends them to the track. A new block is allocated when
+		the last block of the track is full.
+	*/
+	void renderChunk();
+
+	/**
+		Removes a track from the cache and frees its blocks. If it is currently rendered the renderer is deleted as well.
+		\param	pTrack	the track to remove
+	*/
+	void removeTrack(Track* pTrack);
+
+	/**
+		Drops the least recently played tracks except the current one until the memory limit is kept.
+	*/
+	void shrink();
+
+	/**
+		Fills buffer with silence in the format of the audio device.
+	*/
+	void fillSilence(Uint8* buffer, int len) const;
+
+	std::list<Track*>	tracks;				///< all tracks in the cache, the most recently played one first
+	Track*				pCurrentTrack;		///< the track that is played or NULL
+	size_t				position;			///< the position inside pCurrentTrack in bytes
+
+	Track*				pRenderTrack;		///< the track that is rendered by pRenderer or NULL
+	SoundAdlibPC*		pRenderer;			///< the renderer of pRenderTrack or NULL
+
+	size_t				memoryUsage;		///< the number of bytes of all rendered blocks
+	size_t				maxMemory;			///< the number of bytes that may be kept
+	Uint16				format;				///< the format of the audio device
+};
+
+#endif // ADLTRACKCACHE_H
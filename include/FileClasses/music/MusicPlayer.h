@@ -76,6 +76,11 @@ public:
 	*/
 	virtual void setMusic(bool value) = 0;
 
+    /*!
+        returns the number of bytes used by rendered or decoded music
+    */
+	virtual size_t getMemoryUsage() { return 0; };
+
 protected:
     //! whether music should be played
 	bool	musicOn;
@@ -0,0 +1,170 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FIXPOINT_H
+#define FIXPOINT_H
+
+#include <SDL.h>
+
+/**
+	A signed fixed-point number with 16 integer and 16 fractional bits. All operations only use integer arithmetic, so
+	the results are the same with every compiler, on every platform and at every optimization level. This is needed for
+	the game simulation, which has to run exactly the same on all computers of a network game and when a replay is
+	played back.
+	The conversion from and to double is only meant for loading data files and for drawing.
+*/
+class FixPoint {
+public:
+	static const int FRACTION_BITS = 16;
+	static const Sint32 ONE = 1 << FRACTION_BITS;
+
+	FixPoint() : value(0) {
+	}
+
+	FixPoint(int x) : value(x * ONE) {
+	}
+
+	/**
+		Creates a fixed-point number from its internal representation.
+		\param	raw	the number multiplied by ONE
+		\return	the fixed-point number
+	*/
+	static inline FixPoint fromRaw(Sint32 raw) {
+		FixPoint x;
+		x.value = raw;
+		return x;
+	}
+
+	/**
+		Creates the fixed-point number numerator/denominator.
+		\param	numerator	the numerator
+		\param	denominator	the denominator (must not be 0)
+		\return	the fixed-point number (rounded towards zero)
+	*/
+	static inline FixPoint fromFraction(int numerator, int denominator) {
+		return fromRaw((Sint32) (((Sint64) numerator * ONE) / denominator));
+	}
+
+	/**
+		Creates a fixed-point number from a double. This should only be used for values read from data files.
+		\param	x	the number to convert
+		\return	the nearest fixed-point number
+	*/
+	static FixPoint fromDouble(double x);
+
+	inline Sint32 getRaw() const { return value; }
+
+	/**
+		Converts this number to int like a cast of a double would do.
+		\return	this number rounded towards zero
+	*/
+	inline int toInt() const {
+		return (value >= 0) ? (value >> FRACTION_BITS) : -((-value) >> FRACTION_BITS);
+	}
+
+	/**
+		Converts this number to int like lround() would do.
+		\return	this number rounded to the nearest integer (halfway cases away from zero)
+	*/
+	inline int roundToInt() const {
+		return (value >= 0) ? ((value + ONE/2) >> FRACTION_BITS) : -((-value + ONE/2) >> FRACTION_BITS);
+	}
+
+	inline double toDouble() const { return ((double) value) / ONE; }
+
+	inline FixPoint operator-() const { return fromRaw(-value); }
+
+	inline FixPoint& operator+=(const FixPoint& x) { value += x.value; return *this; }
+	inline FixPoint& operator-=(const FixPoint& x) { value -= x.value; return *this; }
+	inline FixPoint& operator*=(const FixPoint& x) { *this = *this * x; return *this; }
+	inline FixPoint& operator/=(const FixPoint& x) { *this = *this / x; return *this; }
+
+	friend inline FixPoint operator+(const FixPoint& x, const FixPoint& y) { return fromRaw(x.value + y.value); }
+	friend inline FixPoint operator-(const FixPoint& x, const FixPoint& y) { return fromRaw(x.value - y.value); }
+
+	friend inline FixPoint operator*(const FixPoint& x, const FixPoint& y) {
+		// >> is an arithmetic shift for negative numbers on all supported compilers
+		return fromRaw((Sint32) (((Sint64) x.value * y.value) >> FRACTION_BITS));
+	}
+
+	friend inline FixPoint operator/(const FixPoint& x, const FixPoint& y) {
+		return fromRaw((Sint32) (((Sint64) x.value * ONE) / y.value));
+	}
+
+	friend inline FixPoint operator*(const FixPoint& x, int y) { return fromRaw(x.value * y); }
+	friend inline FixPoint operator*(int x, const FixPoint& y) { return fromRaw(x * y.value); }
+	friend inline FixPoint operator/(const FixPoint& x, int y) { return fromRaw(x.value / y); }
+
+	friend inline bool operator==(const FixPoint& x, const FixPoint& y) { return (x.value == y.value); }
+	friend inline bool operator!=(const FixPoint& x, const FixPoint& y) { return (x.value != y.value); }
+	friend inline bool operator<(const FixPoint& x, const FixPoint& y) { return (x.value < y.value); }
+	friend inline bool operator<=(const FixPoint& x, const FixPoint& y) { return (x.value <= y.value); }
+	friend inline bool operator>(const FixPoint& x, const FixPoint& y) { return (x.value > y.value); }
+	friend inline bool operator>=(const FixPoint& x, const FixPoint& y) { return (x.value >= y.value); }
+
+	static inline FixPoint abs(const FixPoint& x) { return (x.value < 0) ? -x : x; }
+
+	/**
+		Calculates the square root of x with integer arithmetic.
+		\param	x	the number to calculate the square root of (negative numbers are treated as 0)
+		\return	the square root rounded down to the next fixed-point number
+	*/
+	static FixPoint sqrt(const FixPoint& x);
+
+	/**
+		Calculates sqrt(x*x + y*y) without overflowing for large x and y.
+		\param	x	the first leg
+		\param	y	the second leg
+		\return	the length of the hypotenuse
+	*/
+	static FixPoint hypot(const FixPoint& x, const FixPoint& y);
+
+	/**
+		Calculates the sine of angle from a table. The angle is measured like all angles in the game: A full circle is
+		256 and the angle increases counter-clockwise.
+		\param	angle	the angle (0 to 256)
+		\return	the sine of angle
+	*/
+	static FixPoint sin(const FixPoint& angle);
+
+	/**
+		Calculates the cosine of angle from a table. The angle is measured like all angles in the game: A full circle is
+		256 and the angle increases counter-clockwise.
+		\param	angle	the angle (0 to 256)
+		\return	the cosine of angle
+	*/
+	static FixPoint cos(const FixPoint& angle);
+
+	/**
+		Calculates the angle of the vector (x,y) from a table. The angle is measured like all angles in the game: A full
+		circle is 256 and the angle increases counter-clockwise, starting at the positive x-axis.
+		\param	y	the y-component of the vector
+		\param	x	the x-component of the vector
+		\return	the angle in [0;256)
+	*/
+	static FixPoint atan2(const FixPoint& y, const FixPoint& x);
+
+private:
+	/**
+		Not implemented. Prevents that a double is silently converted to int and then to FixPoint.
+	*/
+	FixPoint(double x);
+
+	Sint32 value;	///< the number multiplied by ONE
+};
+
+#endif // FIXPOINT_H
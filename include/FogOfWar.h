@@ -0,0 +1,109 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FOGOFWAR_H
+#define FOGOFWAR_H
+
+#include <DataTypes.h>
+#include <Definitions.h>
+#include <misc/Stream.h>
+
+#include <SDL.h>
+#include <vector>
+#include <deque>
+
+class MapClass;
+
+/**
+    The FogOfWar keeps track of which tiles every house has explored and which tiles it currently sees. Both are stored
+    as bit planes with one bit per tile, packed into 32 bit words row by row, so isExplored() and isVisible() are a single
+    lookup and revealing a circle sets whole words at once.
+
+    The houses of a team always see the same tiles. A tile stays visible for FOGTIMEOUT cycles after it was seen last.
+    Every reveal() is remembered until then, so update() only has to look at the tiles of reveals that are just timing
+    out instead of the whole map.
+
+    Whenever a tile gets explored, visible or fogged again it is reported to MapClass::journalRadarChange().
+*/
+class FogOfWar {
+public:
+    FogOfWar(MapClass* pMap);
+    ~FogOfWar();
+
+    void load(Stream& stream);
+    void save(Stream& stream) const;
+
+    /**
+        Makes all tiles within radius of location explored and visible for all houses in houseMask.
+        \param  houseMask   bit i is set if house i shall see the tiles
+        \param  location    the center of the circle
+        \param  radius      the radius of the circle in tiles
+        \param  cycle       the current game cycle
+    */
+    void reveal(Uint32 houseMask, const Coord& location, int radius, Uint32 cycle);
+
+    /**
+        Fogs all tiles that have not been seen for FOGTIMEOUT cycles. This must be called once every game cycle.
+        \param  cycle   the current game cycle
+    */
+    void update(Uint32 cycle);
+
+    inline bool isExplored(int houseID, int x, int y) const {
+        return (exploredBits[getWordIndex(houseID, x, y)] & getBit(x)) != 0;
+    }
+
+    inline bool isVisible(int houseID, int x, int y) const {
+        return (visibleBits[getWordIndex(houseID, x, y)] & getBit(x)) != 0;
+    }
+
+private:
+    /// A call of reveal() that has not timed out yet
+    struct Reveal {
+        Uint32  cycle;      ///< the game cycle of the reveal
+        Uint32  houseMask;  ///< the houses that saw the tiles
+        Sint32  x;          ///< the x coordinate of the center
+        Sint32  y;          ///< the y coordinate of the center
+        Sint32  radius;     ///< the radius in tiles
+    };
+
+    inline int getWordIndex(int houseID, int x, int y) const {
+        return (houseID*sizeY + y)*wordsPerRow + (x >> 5);
+    }
+
+    static inline Uint32 getBit(int x) {
+        return ((Uint32) 1) << (x & 31);
+    }
+
+    /**
+        Fogs all tiles of r that were not seen again since r.
+        \param  r       the timed out reveal
+        \param  cycle   the current game cycle
+    */
+    void expire(const Reveal& r, Uint32 cycle);
+
+    MapClass*   pMap;
+    int         sizeX;
+    int         sizeY;
+    int         wordsPerRow;                ///< the number of words used for one row of tiles
+
+    std::vector<Uint32> exploredBits;       ///< the explored tiles (stored house by house and row by row)
+    std::vector<Uint32> visibleBits;        ///< the tiles seen within the last FOGTIMEOUT cycles (stored house by house and row by row)
+    std::vector<Uint32> lastSeen;           ///< the game cycle every tile was seen last (stored house by house and row by row)
+    std::deque<Reveal>  pendingReveals;     ///< all reveals of the last FOGTIMEOUT cycles ordered by their cycle
+};
+
+#endif // FOGOFWAR_H
@@ -93,11 +93,9 @@ protected:
 
                 if(arrivalTimer > 0) {
                     int seconds = ((arrivalTimer*10)/(MILLI2CYCLES(30*1000))) + 1;
-                    SDL_Surface* pText = pFontManager->createSurfaceWithText(stringify<int>(seconds), COLOR_WHITE, FONT_STD24);
-
-                    SDL_Rect dest = { (pSurface->w - pText->w)/2,(pSurface->h - pText->h)/2 + 5, pText->w, pText->h };
-                    SDL_BlitSurface(pText, NULL, pSurface, &dest);
-                    SDL_FreeSurface(pText);
+                    std::string text = stringify<int>(seconds);
+                    pFontManager->drawText(pSurface, text, COLOR_WHITE, FONT_STD24, (pSurface->w - pFontManager->getTextWidth(text, FONT_STD24))/2,
+                                           (pSurface->h - pFontManager->getTextHeight(FONT_STD24))/2 + 5);
                 }
 
                 ObjPicture.SetSurface(pSurface, true);
@@ -107,7 +105,7 @@ protected:
 			Button_Upgrade.SetVisible(!pBuilder->IsUpgrading());
 
 			if(pBuilder->AllowedToUpgrade() == true) {
-				ProgressBar_Upgrade.SetProgress((pBuilder->GetUpgradeProgress() * 100)/pBuilder->GetUpgradeCost());
+				ProgressBar_Upgrade.SetProgress((pBuilder->GetUpgradeProgress().toDouble() * 100)/pBuilder->GetUpgradeCost());
 			}
 
 			if(pBuilder->getHealth() >= pBuilder->getMaxHealth()) {
@@ -60,7 +60,7 @@ protected:
 			if(pUnit != NULL) {
 				RepairUnit.SetVisible(true);
 				RepairUnit.SetSurface(resolveItemPicture(pUnit->getItemID()),false);
-				RepairUnit.SetProgress((pUnit->getHealth()*100)/pUnit->getMaxHealth());
+				RepairUnit.SetProgress((pUnit->getHealth().toDouble()*100)/pUnit->getMaxHealth());
 			} else {
 				RepairUnit.SetVisible(false);
 			}
@@ -21,9 +21,10 @@
 #include <GUI/CallbackTarget.h>
 
 #include <misc/Random.h>
-#include <misc/RobustList.h>
+#include <misc/IntrusiveList.h>
 #include <ObjectData.h>
 #include <ObjectManager.h>
+#include <RenderList.h>
 #include <CommandManager.h>
 #include <GameInterface.h>
 #include <GameINILoader.h>
@@ -34,7 +35,9 @@
 
 #include <SDL.h>
 #include <stdarg.h>
+#include <time.h>
 #include <string>
+#include <vector>
 #include <map>
 
 // forward declarations
@@ -49,12 +52,15 @@ class Explosion;
 
 #define END_WAIT_TIME				(6*1000)
 
+#define REPLAY_SNAPSHOT_INTERVAL	((120*1000)/GAMESPEED_DEFAULT)	///< the number of game cycles between two snapshots in a replay
+
 #define GAME_NOTHING			-1
 #define	GAME_RETURN_TO_MENU		0
 #define GAME_NEXTMISSION		1
 #define	GAME_LOAD				2
 #define GAME_DEBRIEFING_WIN		3
 #define	GAME_DEBRIEFING_LOST	4
+#define GAME_REPLAY_SEEK		5
 
 
 class Game : public CallbackTarget
@@ -74,14 +80,18 @@ public:
     /**
         Initializes a game with the specified settings
         \param  newGameInitSettings the game init settings to initialize the game
+        \param  bShowBriefing       show the mentat briefing for campaign and skirmish missions
     */
-	void initGame(const GameInitSettings& newGameInitSettings);
+	void initGame(const GameInitSettings& newGameInitSettings, bool bShowBriefing = true);
 
 	/**
-        Initializes a replay from the specified filename
+        Initializes a replay from the specified filename. If the replay contains a snapshot at or before startCycle the
+        game is restored from the last such snapshot, otherwise it starts at the beginning. The replay is then fast-forwarded
+        to startCycle.
         \param  filename    the file containing the replay
+        \param  startCycle  the game cycle to start watching the replay at
 	*/
-	void initReplay(const std::string& filename);
+	void initReplay(const std::string& filename, Uint32 startCycle = 0);
 
 
 
@@ -121,7 +131,19 @@ public:
         Get the explosion list.
         \return the explosion list
 	*/
-	RobustList<Explosion*>& getExplosionList() { return explosionList; };
+	IntrusiveList<Explosion>& getExplosionList() { return explosionList; };
+
+	/**
+        Is the game finished (won or lost)?
+        \return true if finished, false otherwise
+	*/
+	bool isFinished() const { return finished; };
+
+	/**
+        If the game is finished, is it won or lost?
+        \return true if won, false if lost
+	*/
+	bool isWon() const { return won; };
 
 	/**
         The current game is finished and the local house has won
@@ -147,6 +169,16 @@ public:
 	bool loadSaveGame(std::string filename);
 	bool saveGame(std::string filename);
 	void runMainLoop();
+
+	/**
+        Runs the game without drawing anything and without processing any input. The game cycles are simulated as fast as
+        possible until the game is won or lost or maxCycles game cycles were simulated. No replay file is written.
+        \param  maxCycles       the maximum number of game cycles to simulate
+        \param  pSubsystemTimes the time spent in every subsystem is added to this array (NUM_SUBSYSTEMS entries in clock() ticks)
+        \return the number of simulated game cycles
+	*/
+	Uint32 runHeadless(Uint32 maxCycles, clock_t* pSubsystemTimes);
+
 	inline void quit_Game() { bQuitGame = true;};
 	void ResumeGame();
 
@@ -160,6 +192,12 @@ public:
 	GameInitSettings getNextGameInitSettings();
 	int whatNext();
 
+	/**
+        Returns the game cycle the replay shall be restarted at. Only valid if whatNext() returned GAME_REPLAY_SEEK.
+        \return the game cycle to pass to initReplay()
+	*/
+	Uint32 getReplaySeekCycle() const { return replaySeekCycle; };
+
 	void OnOptions();
 	void OnMentat();
 
@@ -214,6 +252,15 @@ public:
         CursorMode_Placing
     };
 
+    /// The parts of a game cycle whose processing time is measured by runHeadless()
+    enum {
+        Subsystem_Commands,
+        Subsystem_Houses,
+        Subsystem_Triggers,
+        Subsystem_Objects,
+        NUM_SUBSYSTEMS
+    };
+
     int         currentCursorMode;
 
 	GAMETYPE	gameType;
@@ -232,6 +279,47 @@ public:
 	GAMESTATETYPE gameState;
 
 private:
+    static const int DRAWTIME_FRAMES = 32;  ///< the number of frames the drawing time is averaged over
+
+    /**
+        Simulates one game cycle: The commands for this cycle are executed and all houses, triggers and objects are updated.
+        \param  pSubsystemTimes if not NULL the time spent in every subsystem is added to this array (see runHeadless())
+    */
+	void processGameCycle(clock_t* pSubsystemTimes);
+
+    /**
+        Saves the state of the game without the file header. This is used for save games and replay snapshots.
+        \param  stream          the stream to write to
+        \param  bSaveCommands   true if the commands shall be saved at the end of the stream
+    */
+	void saveGameState(Stream& stream, bool bSaveCommands);
+
+    /**
+        Loads the state of the game saved by saveGameState().
+        \param  stream          the stream to read from
+        \param  bLoadCommands   true if the commands shall be loaded from the end of the stream
+    */
+	void loadGameState(Stream& stream, bool bLoadCommands);
+
+    /**
+        Saves the current game state as a compressed snapshot that is added to the replay.
+    */
+	void takeReplaySnapshot();
+
+    /**
+        Writes all snapshots taken by takeReplaySnapshot() to a replay file. The index of all snapshots comes first so a
+        snapshot can be found without decompressing the others.
+        \param  stream  the replay file, positioned after the commands
+    */
+	void saveReplaySnapshots(Stream& stream);
+
+    /**
+        Jumps to another game cycle of the replay. Seeking forward is done by fast-forwarding, unless there is a snapshot
+        in between. Seeking backward or to a snapshot quits this game and whatNext() returns GAME_REPLAY_SEEK.
+        \param  cycle   the game cycle to seek to
+    */
+	void seekReplay(Uint32 cycle);
+
 	bool	    chatMode;           ///< chat mode on?
     std::string typingChatMessage;  ///< currently typed chat message
 
@@ -252,12 +340,25 @@ private:
 	Coord       indicatorPosition;
 
 	double      fps;
+	double      drawTime;           ///< the average time in ms drawScreen() needed over the last DRAWTIME_FRAMES frames
+	Uint32      drawTimeSum;        ///< the summed up drawing time of the current averaging period
+	int         numDrawTimeFrames;  ///< the number of frames in the current averaging period
 	int         frameTimer;
 
 	Uint32      GameCycleCount;
 
 	Uint32      SkipToGameCycle;    ///< skip to this game cycle
 
+	struct ReplaySnapshot {
+        Uint32              cycle;      ///< the game cycle this snapshot was taken at (before the commands of this cycle are executed)
+        Uint32              length;     ///< the uncompressed length of the snapshot
+        std::vector<Uint8>  data;       ///< the compressed snapshot (empty while watching a replay)
+	};
+
+	std::vector<ReplaySnapshot> replaySnapshots;    ///< the snapshots of the recorded game or the index of the snapshots of the watched replay
+	bool        bTakeReplaySnapshots;               ///< take snapshots for the replay?
+	Uint32      replaySeekCycle;                    ///< the game cycle the replay shall be restarted at (see whatNext())
+
 	SDL_Rect	powerIndicatorPos;  ///< position of the power indicator in the right game bar
 	SDL_Rect	spiceIndicatorPos;  ///< position of the spice indicator in the right game bar
 	SDL_Rect	topBarPos;          ///< position of the top game bar
@@ -274,6 +375,8 @@ private:
 
 	TriggerManager      triggerManager;         ///< This is the manager for all the triggers the scenario has (e.g. reinforcements)
 
+	RenderList          renderList;             ///< the layers of the visible tiles that are drawn every frame
+
 	bool	bQuitGame;					///< Should the game be quited after this game tick
 	bool	bPause;						///< Is the game currently halted
 	bool	bReplay;					///< Is this game actually a replay
@@ -295,7 +398,7 @@ private:
 
 	std::set<Uint32> selectedList;                      ///< A set of all selected units/structures
     std::set<Uint32> selectedLists[NUMSELECTEDLISTS];   ///< Sets of all the different groups on key 1 to 9
-    RobustList<Explosion*> explosionList;               ///< A list containing all the explosions that must be drawn
+    IntrusiveList<Explosion> explosionList;               ///< A list containing all the explosions that must be drawn
 
 	///////////////////////
 
@@ -91,9 +91,9 @@ public:
     inline double getStartingCredits() const { return startingCredits; }
 	inline double getStoredCredits() const { return storedCredits; }
     inline int getCredits() const { return lround(storedCredits+startingCredits); }
-	void addCredits(double newCredits, bool wasRefined = false);
-    void returnCredits(double newCredits);
-	double takeCredits(double amount);
+	void addCredits(FixPoint newCredits, bool wasRefined = false);
+    void returnCredits(FixPoint newCredits);
+	FixPoint takeCredits(FixPoint amount);
 
 	void printStat() const;
 
@@ -103,8 +103,8 @@ public:
 
 	void incrementUnits(int itemID);
 	void decrementUnits(int itemID);
-	void incrementStructures(int itemID);
-	void decrementStructures(int itemID, const Coord& location);
+	void incrementStructures(int itemID, StructureClass* pStructure);
+	void decrementStructures(int itemID, const Coord& location, StructureClass* pStructure);
     void noteDamageLocation(ObjectClass* pObject, const Coord& location);
 	void informHasKilled(Uint32 itemID);
 
@@ -139,6 +139,7 @@ protected:
     int producedPower;      ///< Power prodoced by this player
     int powerRequirement;   ///< How much power does this player use?
 
+	// the credits can exceed the range of FixPoint, but as only FixPoint amounts are added or taken, every sum is exact
 	double storedCredits;   ///< current number of credits that are stored in refineries/silos
     double startingCredits; ///< number of starting credits this player still has
     int oldCredits;         ///< amount of credits in the last game cycle (used for playing the credits tick sound)
@@ -20,6 +20,13 @@
 
 #include <TerrainClass.h>
 
+class AStarSearchWorkspace;
+class ClusterGraph;
+class FogOfWar;
+class ReachabilityIndex;
+class ObjectGrid;
+class TerrainCache;
+
 class MapClass
 {
 public:
@@ -38,9 +45,25 @@ public:
 	void removeObjectFromMap(Uint32 ObjectID);
 	void removeSpice(const Coord& coord);
 	void selectObjects(int houseID, int x1, int y1, int x2, int y2, int realX, int realY, bool objectARGMode);
+
+	/**
+        Makes all tiles within maxViewRange of location explored and visible for all houses of playerTeam.
+        \param playerTeam      the team that sees the tiles
+        \param location        the center of the viewed circle
+        \param maxViewRange    the radius of the viewed circle in tiles
+	*/
 	void viewMap(int playerTeam, const Coord& location, int maxViewRange);
 	void viewMap(int playerTeam, int x, int y, int maxViewRange);
 
+	/**
+        Returns the shape of a circle of tiles. For every distance from the center row (0 to radius) the returned vector contains
+        how far the circle reaches to the left and to the right in that row. A tile belongs to the circle if its distance to the center
+        is at most radius. The shapes are computed on first use and kept for the lifetime of the map.
+        \param radius  the radius of the circle in tiles (must not be negative)
+        \return the half widths of the circle for every row
+	*/
+	const std::vector<int>& getCircleStamp(int radius);
+
 	bool findSpice(Coord* destination, Coord* origin);
 	bool perfectlyInACell(ObjectClass* thing);
 	bool okayToPlaceStructure(int x, int y, int buildingSizeX, int buildingSizeY, bool tilesRequired, House* pHouse);
@@ -52,6 +75,47 @@ public:
 	Coord findDeploySpot(UnitClass* pUnit, const Coord origin, const Coord gatherPoint = Coord(INVALID_POS,INVALID_POS), const Coord buildingSize = Coord(0,0)) const;//building size is num squares
 	ObjectClass* findObjectWidthID(int objectID, int lx, int ly);
 
+	/**
+        This method must be called when the terrain type of a tile changes or a structure is placed on or removed from it.
+        It keeps all the path finding data up to date.
+        \param pos the position of the changed tile
+	*/
+	void onTileChanged(const Coord& pos);
+
+	/**
+        This method must be called when the owner of a tile changes. It keeps the build range of all houses up to date,
+        so isWithinBuildRange() does not have to search the surrounding tiles.
+        \param pos      the position of the changed tile
+        \param oldOwner the house id of the previous owner (or a value outside of 0 to MAX_PLAYERS-1 for none)
+        \param newOwner the house id of the new owner (or a value outside of 0 to MAX_PLAYERS-1 for none)
+	*/
+	void onOwnerChanged(const Coord& pos, int oldOwner, int newOwner);
+
+	/**
+        Adds the tile at pos to the tiles that are updated every game cycle. This method must be called when tracks
+        or dead units are added to a tile. The tile is removed again when it has nothing left to update.
+        \param pos the position of the tile
+	*/
+	void activateTile(const Coord& pos);
+
+	/**
+        Updates all active tiles (see activateTile()). This is called once every game cycle.
+	*/
+	void updateActiveTiles();
+
+	/**
+        Records that the color of the tile at pos on the radar might have changed. This method must be called when
+        the type of a tile, the objects on it, their owner or whether the tile is explored or fogged changes.
+        \param pos the position of the changed tile
+	*/
+	void journalRadarChange(const Coord& pos);
+
+	/**
+        Returns all tiles recorded by journalRadarChange() since the last call and clears the journal.
+        \param changedTiles the changed tiles are stored here
+	*/
+	void takeRadarJournal(std::vector<Coord>& changedTiles);
+
 
 	inline bool cellExists(int xPos, int yPos) const {
 		return ((xPos >= 0) && (xPos < sizeX) && (yPos >= 0) && (yPos < sizeY));
@@ -63,7 +127,7 @@ public:
 
 	inline TerrainClass* getCell(int xPos, int yPos) const {
 		if(cellExists(xPos,yPos))
-			return &cell[xPos][yPos];
+			return &tiles[yPos*sizeX + xPos];
 		else {
 			fprintf(stderr,"getCell (%s - %d): cell[%d][%d] does not exist\n",__FILE__,__LINE__,xPos,yPos);
 			fflush(stderr);
@@ -75,12 +139,85 @@ public:
 		return getCell(location.x, location.y);
 	}
 
+	/**
+        Returns the workspace that is shared by all path searches on this map.
+        \return the workspace for AStarSearch
+	*/
+	inline AStarSearchWorkspace* getAStarSearchWorkspace() const {
+        return pAStarSearchWorkspace;
+	}
+
+	/**
+        Returns the cluster graph used for hierarchical path finding on this map.
+        \return the cluster graph
+	*/
+	inline ClusterGraph* getClusterGraph() const {
+        return pClusterGraph;
+	}
+
+	/**
+        Returns the index of the connected components of this map. It is used to reject unreachable destinations before searching a path.
+        \return the reachability index
+	*/
+	inline ReachabilityIndex* getReachabilityIndex() const {
+        return pReachabilityIndex;
+	}
+
+	/**
+        Returns the spatial index of all units and structures on this map.
+        \return the object grid
+	*/
+	inline ObjectGrid* getObjectGrid() const {
+        return pObjectGrid;
+	}
+
+	/**
+        Returns the cache of the drawn ground of this map.
+        \return the terrain cache
+	*/
+	inline TerrainCache* getTerrainCache() const {
+        return pTerrainCache;
+	}
+
+	/**
+        Returns the explored and visible tiles of all houses.
+        \return the fog of war
+	*/
+	inline FogOfWar* getFogOfWar() const {
+        return pFogOfWar;
+	}
+
 	Sint32	sizeX;          ///< number of tiles this map is wide
 	Sint32  sizeY;          ///< number of tiles this map is high
 
-	TerrainClass **cell;    ///< the 2d-array containing all the cells of the map
+	TerrainClass *tiles;    ///< all the tiles of the map stored row by row in one block (use getCell() to access them)
 private:
+    /**
+        Adds delta to the build range count of houseID for all tiles within BUILDRANGE of pos.
+        \param pos      the position of the owned tile
+        \param houseID  the owner of the tile; nothing is done for values outside of 0 to MAX_PLAYERS-1
+        \param delta    +1 if the tile is now owned by houseID, -1 if not anymore
+    */
+	void addToBuildRange(const Coord& pos, int houseID, int delta);
+
 	ObjectClass* lastSinglySelectedObject;      ///< The last selected object. If selected again all units of the same time are selected
+
+	AStarSearchWorkspace* pAStarSearchWorkspace;    ///< The tile data used by every path search on this map
+	ClusterGraph* pClusterGraph;                    ///< The abstract graph for long distance path searches
+	ReachabilityIndex* pReachabilityIndex;          ///< The connected components of this map for every movement class
+	ObjectGrid* pObjectGrid;                        ///< The units and structures on this map bucketed by house and position
+	TerrainCache* pTerrainCache;                    ///< The drawn ground of this map
+	FogOfWar* pFogOfWar;                            ///< The explored and visible tiles of all houses
+
+	std::vector<TerrainClass*> activeTiles;         ///< All tiles with tracks or dead units that have to be updated
+	std::vector<bool> tileActive;                   ///< Is the tile (stored row by row) in activeTiles?
+
+	std::vector<Coord> radarJournal;                ///< All tiles whose radar color might have changed since the last takeRadarJournal()
+	std::vector<bool> tileJournaled;                ///< Is the tile (stored row by row) in radarJournal?
+
+	std::vector<Uint8> buildRange;                  ///< The number of tiles within BUILDRANGE owned by a house (stored house by house and row by row)
+
+	std::vector< std::vector<int> > circleStamps;   ///< The circle shapes for every radius computed so far (see getCircleStamp())
 };
 
 
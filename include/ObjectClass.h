@@ -19,6 +19,8 @@
 #define OBJECTCLASS_H
 
 #include <ObjectPointer.h>
+#include <misc/IntrusiveList.h>
+#include <misc/MemoryPool.h>
 
 #include <Definitions.h>
 #include <DataTypes.h>
@@ -40,8 +42,10 @@ template<class WidgetData> class Container;
 /*!
 	Class from which all structure and unit classes are derived
 */
-class ObjectClass
+class ObjectClass : public IntrusiveListHook
 {
+    friend class ObjectGrid;
+
 public:
 
 	ObjectClass(House* newOwner);
@@ -49,6 +53,14 @@ public:
 	void init();
 	virtual ~ObjectClass();
 
+	/**
+		Objects of this class are allocated from a MemoryPool to avoid a heap allocation for every unit and structure.
+	*/
+	static void* operator new(size_t size) { return memoryPool.allocate(size); }
+	static void operator delete(void* p, size_t size) { memoryPool.deallocate(p, size); }
+
+	static inline MemoryPool& getMemoryPool() { return memoryPool; }
+
 	virtual void save(Stream& stream) const;
 
 	virtual ObjectInterface* GetInterfaceContainer();
@@ -87,7 +99,7 @@ public:
 	void removeFromSelectionLists();
 
 	virtual void setDestination(int newX, int newY);
-	virtual void setHealth(double newHealth);
+	virtual void setHealth(FixPoint newHealth);
 
 	virtual void setLocation(int xPos, int yPos);
 
@@ -122,7 +134,7 @@ public:
 
 	virtual ObjectClass* findTarget();
 
-	inline void addHealth() { if (health < getMaxHealth()) setHealth(health + 1.0); }
+	inline void addHealth() { if (health < getMaxHealth()) setHealth(health + 1); }
 	inline void setActive(bool status) { active = status; }
 	inline void setForced(bool status) { forced = status; }
 	inline void setRespondable(bool status) { respondable = status; }
@@ -147,7 +159,7 @@ public:
 	inline int getX() const { return location.x; }
 	inline int getY() const { return location.y; }
 
-	inline double getHealth() const { return health; }
+	inline FixPoint getHealth() const { return health; }
 	inline int getImageW() const { return imageW; }
 	inline int getImageH() const { return imageH; }
 	int getMaxHealth() const;
@@ -159,8 +171,8 @@ public:
 	int getGuardRange() const;
     int getWeaponRange() const;
 
-	inline double getRealX() const { return realX; }
-	inline double getRealY() const { return realY; }
+	inline FixPoint getRealX() const { return realX; }
+	inline FixPoint getRealY() const { return realY; }
 	inline const Coord& getLocation() const { return location; }
 	inline const Coord& getDestination() const { return destination; }
 	inline ObjectClass* getTarget() { return target.getObjPointer(); }
@@ -197,10 +209,10 @@ protected:
     Coord   location;               ///< The current position of this object in tile coordinates
     Coord   oldLocation;            ///< The previous position of this object in tile coordinates (used when moving from one tile to the next tile)
     Coord   destination;            ///< The destination tile
-    double  realX;                  ///< The x-coordinate of this object in world coordinates
-    double  realY;                  ///< The y-coordinate of this object in world coordinates
+    FixPoint realX;                 ///< The x-coordinate of this object in world coordinates
+    FixPoint realY;                 ///< The y-coordinate of this object in world coordinates
 
-    double  angle;                  ///< The current angle of this unit/structure
+    FixPoint angle;                 ///< The current angle of this unit/structure
     Sint8   drawnAngle;             ///< The angle this unit/structure is drawn with. (e.g. 0 to 7)
 
 	bool	active;                 ///< Is this unit/structure active?
@@ -223,7 +235,10 @@ protected:
     bool	badlyDamaged;           ///< Is the health below 50%?
 
 private:
-    double  health;                 ///< The health of this object
+    static MemoryPool memoryPool;   ///< The pool all units and structures are allocated from
+
+    FixPoint health;                ///< The health of this object
+    int     gridBucket;             ///< The bucket of the ObjectGrid this object is stored in (INVALID if it is not stored)
 };
 
 
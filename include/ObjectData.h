@@ -85,8 +85,8 @@ public:
         Sint32 capacity;     ///< how much spice can this structure contain?
         Sint32 weapondamage; ///< how much damage does the weapon of this unit/structure have?
         Sint32 weaponrange;  ///< how far can this unit/structure shoot?
-        double maxspeed;     ///< how fast can this unit move?
-        double turnspeed;    ///< how fast can this unit turn around?
+        FixPoint maxspeed;   ///< how fast can this unit move?
+        FixPoint turnspeed;  ///< how fast can this unit turn around?
         Sint32 radius;       ///< how big is this unit?
         Sint32 buildtime;    ///< how much time does the production of this structure/unit take?
     };
@@ -0,0 +1,79 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OBJECTGRID_H
+#define OBJECTGRID_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+class MapClass;
+class ObjectClass;
+
+/**
+    The ObjectGrid is a spatial index of all units and structures on the map. The objects are kept in buckets by their
+    house and by coarse cells of CELLSIZE x CELLSIZE tiles (sandworms get a bucket of their own as every house can attack them).
+    It is used to find the closest target of an object without looking at all the units and structures of the game.
+
+    Every object is stored in the bucket of its current location. Objects must call update() whenever their location or
+    their owner changes.
+*/
+class ObjectGrid {
+public:
+    static const int CELLSIZE = 8;
+
+    ObjectGrid(MapClass* pMap);
+    ~ObjectGrid();
+
+    /**
+        Moves pObject to the bucket for its current location and owner. Objects outside the map are removed from the grid.
+        \param  pObject the object to update
+    */
+    void update(ObjectClass* pObject);
+
+    /**
+        Removes pObject from the grid.
+        \param  pObject the object to remove
+    */
+    void remove(ObjectClass* pObject);
+
+    /**
+        Searches the closest unit or structure that pAttacker can attack. The cells are searched in growing rings around
+        pAttacker and the search stops as soon as no closer object can be found. If two objects have the same distance the
+        one with the lower object id is returned.
+        \param  pAttacker   the object that is looking for a target
+        \param  bStructures true for searching structures, false for searching units
+        \param  bWalls      if searching structures: true for searching only walls, false for searching everything except walls
+        \return the closest target or NULL if there is none
+    */
+    ObjectClass* findClosestTarget(const ObjectClass* pAttacker, bool bStructures, bool bWalls) const;
+
+private:
+    static const int NUM_SLOTS = NUM_HOUSES + 1;    ///< one slot per house plus one for sandworms
+
+    inline int getBucketIndex(bool bStructure, int slot, int cellX, int cellY) const {
+        return (((bStructure ? 1 : 0)*NUM_SLOTS + slot)*numCellsY + cellY)*numCellsX + cellX;
+    };
+
+    MapClass*   pMap;
+    int         numCellsX;
+    int         numCellsY;
+    std::vector< std::vector<ObjectClass*> > buckets;    ///< all buckets for units and structures of every slot, each stored row by row
+};
+
+#endif // OBJECTGRID_H
@@ -20,22 +20,29 @@
 
 #include <misc/Stream.h>
 
-#include <map>
+#include <vector>
+#include <deque>
 #include <SDL.h>
 
 // forward declarations
 class ObjectClass;
 
-typedef std::map<Uint32,ObjectClass*> ObjectMap;
+/**
+	This class holds all objects (structures and units) in the game.
 
-/// This class holds all objects (structures and units) in the game.
+	The objects are stored in a slot map: The lower INDEX_BITS bits of an ObjectID are the index of the slot the object is
+	stored in and the upper bits are the generation of this slot. Every time an object is removed the generation of its slot
+	is increased, so an ObjectID of a removed object never resolves to the object that reuses its slot later. Freed slots are
+	only reused when there are more than MIN_FREE_SLOTS of them, which keeps the generations from wrapping around too early.
+*/
 class ObjectManager{
 public:
 	/**
 		Default constructor
 	*/
-    ObjectManager() : nextFreeObjectID(1)
+    ObjectManager() : nextSerial(0)
     {
+        clear();
     }
 
     /**
@@ -59,22 +66,22 @@ public:
     /**
 		This method adds one object. The ObjectID is choosen automatically.
 		\param	pObject	A pointer to the object.
-		\return ObjectID of the added object.
+		\return ObjectID of the added object (NONE if there is no free slot).
 	*/
     Uint32 AddObject(ObjectClass* pObject);
 
     /**
 		This method searches for the object with ObjectID.
 		\param	ObjectID		ID of the object to search for
-		\return Pointer to this object (NULL if not found)
+		\return Pointer to this object (NULL if not found or if the object was already removed)
 	*/
 	inline ObjectClass* getObject(Uint32 ObjectID) const {
-	    ObjectMap::const_iterator iter = objectMap.find(ObjectID);
+	    Uint32 index = ObjectID & INDEX_MASK;
 
-	    if(iter == objectMap.end()) {
+	    if((index >= slots.size()) || (slots[index].generation != (ObjectID >> INDEX_BITS))) {
             return NULL;
 	    } else {
-            return iter->second;
+            return slots[index].pObject;
 	    }
 	}
 
@@ -83,13 +90,25 @@ public:
 		\param	ObjectID		ID of the object to remove
 		\return false if there was no object with this ObjectID, true if it could be removed
 	*/
-	bool RemoveObject(Uint32 ObjectID) {
-	    return (bool) objectMap.erase(ObjectID);
-	}
+	bool RemoveObject(Uint32 ObjectID);
 
 private:
-    Uint32 nextFreeObjectID;
-    ObjectMap objectMap;
+	static const int INDEX_BITS = 16;
+	static const Uint32 INDEX_MASK = (1 << INDEX_BITS) - 1;
+	static const Uint32 MAX_GENERATION = (1 << 15) - 1;        ///< the generation is limited to 15 bits to keep the ObjectIDs positive if stored in an int
+	static const Uint32 MIN_FREE_SLOTS = 1024;
+
+	struct Slot {
+		ObjectClass*	pObject;		///< the object stored in this slot or NULL if this slot is free
+		Uint32			generation;		///< the generation of this slot; increased every time the object is removed
+		Uint32			serial;			///< the number of objects added before this one; used to save the objects in the order they were created
+	};
+
+	void clear();
+
+	std::vector<Slot>	slots;			///< all slots; slot 0 is never used so that 0 is no valid ObjectID
+	std::deque<Uint32>	freeSlots;		///< the indices of all free slots in the order they were freed
+	Uint32				nextSerial;		///< the serial of the next added object
 };
 
 #endif //OBJECTMANAGER_H
@@ -21,6 +21,9 @@
 #include <DataTypes.h>
 
 #include <SDL.h>
+#include <vector>
+
+class MapClass;
 
 extern SDL_Rect RadarPosition;
 
@@ -31,7 +34,11 @@ typedef enum {
 	Mode_AnimationRadarOn
 } RadarViewMode;
 
-/// This class manages the mini map at the top right corner of the screen
+/**
+    This class manages the mini map at the top right corner of the screen. The mini map is kept on a surface of its own
+    and only the tiles that were recorded by MapClass::journalRadarChange() are drawn again. This includes tiles that get
+    fogged again, as the FogOfWar journals them when they time out.
+*/
 class RadarView
 {
 public:
@@ -50,7 +57,7 @@ public:
 	/**
         Draws the radar
 	*/
-	void draw() const;
+	void draw();
 
 	/**
         This method updates the radar. It should be called every game tick
@@ -131,6 +138,18 @@ public:
 	}
 
 private:
+	/**
+        Updates all changed tiles on radarSurface. Everything is drawn again if the map, the radar status or the debug mode changed.
+	*/
+	void updateRadarSurface();
+
+	/**
+        Draws the tile at x,y on radarSurface.
+        \param x   the x coordinate of the tile
+        \param y   the y coordinate of the tile
+	*/
+	void updateTile(int x, int y);
+
 	RadarViewMode currentRadarMode;         ///< the current mode of the radar
 
 	int animFrame;                          ///< the current animation frame
@@ -140,6 +159,16 @@ private:
 	SDL_Surface* radarStaticAnimation;      ///< holds the animation graphic for radar static
 
 	SDL_Rect radarPosition;                 ///< the position of the radar on the screen
+
+	SDL_Surface* radarSurface;              ///< the mini map as shown on the screen; NULL until first drawn
+	MapClass* pRadarMap;                    ///< the map radarSurface shows
+	bool bRadarOn;                          ///< did the local house have the radar on when radarSurface was drawn?
+	bool bDebug;                            ///< was the debug mode on when radarSurface was drawn?
+	int scale;                              ///< the size of one tile on the radar in pixels
+	int offsetX;                            ///< the offset of the map inside the radar in x direction
+	int offsetY;                            ///< the offset of the map inside the radar in y direction
+
+	std::vector<Coord> changedTiles;        ///< the tiles taken from the radar journal; kept to avoid reallocations
 };
 
 #endif // RADARVIEW_H
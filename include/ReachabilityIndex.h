@@ -0,0 +1,101 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REACHABILITYINDEX_H
+#define REACHABILITYINDEX_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+class MapClass;
+
+/**
+    The ReachabilityIndex labels the connected components of the map for every movement class. Two tiles with the
+    same label are connected by passable tiles (diagonal moves included), so whether a tile can be reached at all
+    is answered without any path search. Like the ClusterGraph only terrain and structures are considered.
+
+    The labelling of a movement class is built on first use. Afterwards every changed tile is handled locally: a tile
+    becoming passable merges the components around it and a tile becoming impassable only causes a flood fill if its
+    passable neighbours are not connected around it anyway.
+*/
+class ReachabilityIndex {
+public:
+    ReachabilityIndex(MapClass* pMap);
+    ~ReachabilityIndex();
+
+    /**
+        Informs the index that the terrain type of the tile at pos changed or that a structure was placed on it or removed from it.
+        \param  pos the position of the changed tile
+    */
+    void tileChanged(const Coord& pos);
+
+    /**
+        Throws away the labelling of all movement classes. This is needed after the whole map was loaded.
+    */
+    void invalidateAll();
+
+    /**
+        Checks if destination can be reached from start. If destination itself is impassable (e.g. a structure) it is
+        considered reachable if one of its neighbour tiles can be reached. If start is impassable nothing is known and true is returned.
+        \param  movementClass   the movement class of the unit to move
+        \param  start           the start tile
+        \param  destination     the destination tile
+        \return true if destination is reachable, false otherwise
+    */
+    bool isReachable(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination);
+
+    /**
+        Searches the tile that is closest to destination and can be reached from start.
+        \param  movementClass   the movement class of the unit to move
+        \param  start           the start tile
+        \param  destination     the destination tile
+        \return the closest reachable tile (start if there is no closer one)
+    */
+    Coord findClosestReachableTile(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination);
+
+private:
+    struct Labelling {
+        bool                bBuilt;             ///< has this labelling been built yet
+        std::vector<int>    labels;             ///< the component label of every tile stored row by row (NO_COMPONENT if impassable)
+        std::vector<int>    componentSizes;     ///< the number of tiles of every component
+    };
+
+    Labelling& getLabelling(MOVEMENTCLASS movementClass);
+
+    void build(MOVEMENTCLASS movementClass);
+
+    /**
+        Assigns newLabel to all tiles that are labelled oldLabel and connected to the tile with index startIndex.
+        \param  labelling   the labelling to modify
+        \param  startIndex  the index of the tile to start at
+        \param  oldLabel    the label to replace
+        \param  newLabel    the new label
+        \return the number of relabelled tiles
+    */
+    int relabel(Labelling& labelling, int startIndex, int oldLabel, int newLabel);
+
+    inline int getIndex(int x, int y) const { return y*sizeX + x; };
+
+    MapClass*           pMap;
+    int                 sizeX;
+    int                 sizeY;
+    Labelling           labellings[NUM_MOVEMENTCLASSES];
+    std::vector<int>    stack;                  ///< the stack used by relabel(); kept to avoid reallocations
+};
+
+#endif // REACHABILITYINDEX_H
@@ -0,0 +1,82 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RENDERLIST_H
+#define RENDERLIST_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+class TerrainClass;
+
+/**
+    The RenderList collects what has to be drawn for the visible tiles of the map. build() visits every visible tile
+    only once and adds the tile to every layer it has something to draw for. The layers are then drawn one after another
+    with draw(). Inside a layer the tiles are drawn row by row, so the result is the same as drawing every layer by
+    looping over all visible tiles. The ground below all layers is drawn by the TerrainCache.
+*/
+class RenderList {
+public:
+    /// The layers in the order they have to be drawn
+    enum Layer {
+        Layer_Structures,
+        Layer_UndergroundUnits,
+        Layer_DeadUnits,
+        Layer_Infantry,
+        Layer_NonInfantryGroundUnits,
+        Layer_AirUnits,
+        Layer_SelectionRects,
+        Layer_Shade,
+        NUM_LAYERS
+    };
+
+    RenderList();
+    ~RenderList();
+
+    /**
+        Builds the render list for all tiles between topLeftTile and bottomRightTile. Tiles outside the map are only
+        added to the shade layer.
+        \param  topLeftTile     the top left tile to draw
+        \param  bottomRightTile the bottom right tile to draw
+    */
+    void build(const Coord& topLeftTile, const Coord& bottomRightTile);
+
+    /**
+        Draws all tiles of one layer to the screen.
+        \param  layer   the layer to draw
+    */
+    void draw(Layer layer) const;
+
+private:
+    /// One tile to draw in a layer
+    struct TileCommand {
+        TerrainClass*   pCell;      ///< the tile to draw or NULL if the tile is outside the map
+        int             screenX;    ///< the x position of the left top corner of this tile on the screen
+        int             screenY;    ///< the y position of the left top corner of this tile on the screen
+    };
+
+    /**
+        Draws the unexplored and fogged part of one tile.
+        \param  tileCommand the tile to draw
+    */
+    void drawShade(const TileCommand& tileCommand) const;
+
+    std::vector<TileCommand>    layers[NUM_LAYERS];     ///< the tiles to draw for every layer
+};
+
+#endif // RENDERLIST_H
@@ -0,0 +1,88 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TERRAINCACHE_H
+#define TERRAINCACHE_H
+
+#include <DataTypes.h>
+
+#include <SDL.h>
+#include <vector>
+
+class MapClass;
+
+/**
+    The TerrainCache keeps the ground of the whole map (terrain, destroyed structures, tracks and damage) drawn on
+    one off-screen surface. Every frame only the tiles that changed since they were drawn last are redrawn and the
+    visible part of the map is copied to the screen with one blit.
+
+    A tile has to be invalidated whenever anything that TerrainClass::blitGround() draws for it changes. The terrain tile
+    depends on the neighbour tiles and damage is stored in the tiles up to two tiles right and below of where it hit, so
+    invalidating a tile also invalidates the tiles its ground might reach into. Changes of the fog are detected by draw() itself.
+
+    The surface is created on first use, so the cache costs nothing if the map is never drawn (e.g. in headless mode).
+*/
+class TerrainCache {
+public:
+    TerrainCache(MapClass* pMap);
+    ~TerrainCache();
+
+    /**
+        Marks the tile at pos and all tiles its ground might reach into to be redrawn.
+        \param  pos the position of the changed tile
+    */
+    void invalidate(const Coord& pos);
+
+    /**
+        Marks all tiles to be redrawn. This is needed after the whole map was loaded.
+    */
+    void invalidateAll();
+
+    /**
+        Redraws all changed tiles between topLeftTile and bottomRightTile and copies them to the screen.
+        \param  topLeftTile     the top left tile to draw
+        \param  bottomRightTile the bottom right tile to draw
+    */
+    void draw(const Coord& topLeftTile, const Coord& bottomRightTile);
+
+private:
+    static const int REACH_LEFT_UP = 3;     ///< the ground of a tile might reach this many tiles to the left and up
+    static const int REACH_RIGHT_DOWN = 1;  ///< the ground of a tile might reach this many tiles to the right and down
+
+    /// The bits of the state of every tile
+    enum {
+        TileState_Dirty = 0x01,     ///< the tile has to be redrawn
+        TileState_Fogged = 0x02     ///< the tile was fogged when the last time checked
+    };
+
+    /**
+        Redraws the tile at x,y. The ground of all tiles that might reach into this tile is drawn again clipped to this tile.
+        \param  x   the x coordinate of the tile
+        \param  y   the y coordinate of the tile
+    */
+    void redrawTile(int x, int y);
+
+    inline int getIndex(int x, int y) const { return y*sizeX + x; };
+
+    MapClass*           pMap;
+    int                 sizeX;
+    int                 sizeY;
+    SDL_Surface*        pSurface;       ///< the ground of the whole map; NULL until first drawn
+    std::vector<Uint8>  tileStates;     ///< the state of every tile stored row by row (see TileState_Dirty and TileState_Fogged)
+};
+
+#endif // TERRAINCACHE_H
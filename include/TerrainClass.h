@@ -24,6 +24,7 @@
 #include <time.h>
 
 #include <misc/FileStream.h>
+#include <misc/InlineList.h>
 
 #include <list>
 #include <vector>
@@ -92,6 +93,8 @@ enum destroyedStructureEnum {
 class TerrainClass
 {
 public:
+    /// The object ids of the objects on a tile. Up to NUM_INFANTRY_PER_CELL ids are stored without any allocation.
+    typedef InlineList<Uint32, NUM_INFANTRY_PER_CELL> ObjectIDList;
 
     typedef enum {
         Terrain_RockDamage,
@@ -221,27 +224,19 @@ public:
 	void save(Stream& stream) const;
 
 	void assignAirUnit(Uint32 newObjectID);
-	void assignDeadUnit(Uint8 type, Uint8 house, const Coord& position) {
-        DEADUNITTYPE newDeadUnit;
-        newDeadUnit.type = type;
-        newDeadUnit.house = house;
-        newDeadUnit.onSand = isSand() || isDunes();
-        newDeadUnit.realPos = position;
-        newDeadUnit.timer = 2000;
-
-        deadUnits.push_back(newDeadUnit);
-	}
+	void assignDeadUnit(Uint8 type, Uint8 house, const Coord& position);
 
 	void assignNonInfantryGroundObject(Uint32 newObjectID);
 	int assignInfantry(Uint32 newObjectID, Sint8 currentPosition = INVALID_POS);
 	void assignUndergroundUnit(Uint32 newObjectID);
 
     /**
-        This method draws the terrain of this tile
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
+        This method draws the terrain of this tile. It is drawn to the TerrainCache and not directly to the screen.
+        \param pSurface the surface to draw to
+        \param xPos the x position of the left top corner of this tile on pSurface
+        \param yPos the y position of the left top corner of this tile on pSurface
     */
-	void blitGround(int xPos, int yPos);
+	void blitGround(SDL_Surface* pSurface, int xPos, int yPos);
 
     /**
         This method draws the structures.
@@ -293,16 +288,22 @@ public:
 	void blitSelectionRects(int xPos, int yPos);
 
 
-	void update();
+	/**
+        Counts down the timers of the tracks and dead units on this tile. Only tiles that were activated
+        by MapClass::activateTile() are updated.
+        \return true if there are still tracks or dead units left, false if this tile needs no further updates
+	*/
+	bool update();
+
+	/**
+        Checks if this tile has any tracks or dead units that have to be updated every game cycle.
+        \return true if update() has to be called, false otherwise
+	*/
+	bool needsUpdate() const;
 
 	void clearTerrain();
 
-	inline void setTrack(Uint8 direction) {
-	    if(type == Terrain_Sand || type == Terrain_Dunes
-            || type == Terrain_Spice || type == Terrain_ThickSpice) {
-            tracksCounter[direction] = 5000;
-	    }
-    }
+	void setTrack(Uint8 direction);
 
 	void damageCell(Uint32 damagerID, House* damagerOwner, const Coord& realPos, int bulletType, int bulletDamage, int damageRadius, bool air);
 	void selectAllPlayersUnits(int houseID, ObjectClass** lastCheckedObject, ObjectClass** lastSelectedObject);
@@ -315,8 +316,8 @@ public:
 	void setType(int newType);
 	void squash();
 	int getInfantryTeam();
-	double harvestSpice();
-	void setSpice(double newSpice);
+	FixPoint harvestSpice();
+	void setSpice(FixPoint newSpice);
 
 	/**
         Returns the center point of this tile
@@ -373,33 +374,23 @@ public:
 	*/
 	void triggerSpecialBloom(House* pTrigger);
 
-	/**
-        Sets this tile as explored for this house.
-        \param  houseID the house this tile should be explored for
-        \param  cycle   the cycle this happens (normally the current game cycle)
-	*/
-	inline void setExplored(int houseID, Uint32 cycle) {
-        lastAccess[houseID] = cycle;
-        explored[houseID] = true;
-    }
-
-	inline void setOwner(int newOwner) { owner = newOwner; }
+	void setOwner(int newOwner);
 	inline void setSandRegion(int newSandRegion) { sandRegion = newSandRegion; }
-	inline void setDestroyedStructureTile(int newDestroyedStructureTile) { destroyedStructureTile = newDestroyedStructureTile; };
+	void setDestroyedStructureTile(int newDestroyedStructureTile);
 
 	inline bool hasAGroundObject() const { return (hasInfantry() || hasANonInfantryGroundObject()); }
 	inline bool hasAnAirUnit() const { return !assignedAirUnitList.empty(); }
 	inline bool hasAnUndergroundUnit() const { return !assignedUndergroundUnitList.empty(); }
 	inline bool hasANonInfantryGroundObject() const { return !assignedNonInfantryGroundObjectList.empty(); }
 	inline bool hasInfantry() const { return !assignedInfantryList.empty(); }
+	inline bool hasDeadUnits() const { return !deadUnits.empty(); }
     inline bool hasAnObject() { return (hasAGroundObject() || hasAnAirUnit() || hasInfantry() || hasAnUndergroundUnit()); }
 
-	inline bool hasSpice() const { return (fixDouble(spice) > 0.0); }
+	inline bool hasSpice() const { return (spice > 0); }
 	inline bool infantryNotFull() const { return (assignedInfantryList.size() < NUM_INFANTRY_PER_CELL); }
 	inline bool isConcrete() const { return (type == Terrain_Slab); }
-	inline bool isExplored(int houseID) const {return explored[houseID];}
-
-	bool isFogged(int houseID);
+	bool isExplored(int houseID) const;
+	bool isFogged(int houseID) const;
 	inline bool isMountain() const { return (type == Terrain_Mountain);}
 	inline bool isRock() const { return ((type == Terrain_Rock) || (type == Terrain_Slab) || (type == Terrain_Mountain));}
 
@@ -413,28 +404,28 @@ public:
 	inline int getSandRegion() const { return sandRegion; }
 	inline int getOwner() const { return owner; }
 	inline int getType() const {	return type; }
-	inline double getSpice() const { return spice; }
+	inline FixPoint getSpice() const { return spice; }
 
 	/**
         Returns how fast a unit can move over this tile.
         \return Returns a speed factor. Higher values mean slower.
 	*/
-	inline double getDifficulty() const {
+	inline FixPoint getDifficulty() const {
 	    switch(type) {
-            case Terrain_Slab:          return 0.7;
-            case Terrain_Sand:          return 1.2;
-            case Terrain_Rock:          return 1.0;
-            case Terrain_Dunes:         return 1.5;
-            case Terrain_Mountain:      return 1.5;
-            case Terrain_Spice:         return 1.2;
-            case Terrain_ThickSpice:    return 1.2;
-            case Terrain_SpiceBloom:    return 1.2;
-            case Terrain_SpecialBloom:  return 1.2;
-            default:                    return 1.0;
+            case Terrain_Slab:          return FixPoint::fromRaw(45875);    // 0.7
+            case Terrain_Sand:          return FixPoint::fromRaw(78643);    // 1.2
+            case Terrain_Rock:          return 1;
+            case Terrain_Dunes:         return FixPoint::fromRaw(98304);    // 1.5
+            case Terrain_Mountain:      return FixPoint::fromRaw(98304);    // 1.5
+            case Terrain_Spice:         return FixPoint::fromRaw(78643);    // 1.2
+            case Terrain_ThickSpice:    return FixPoint::fromRaw(78643);    // 1.2
+            case Terrain_SpiceBloom:    return FixPoint::fromRaw(78643);    // 1.2
+            case Terrain_SpecialBloom:  return FixPoint::fromRaw(78643);    // 1.2
+            default:                    return 1;
 	    }
     };
 
-	inline double getSpiceRemaining() { return fixDouble(spice); }
+	inline FixPoint getSpiceRemaining() { return spice; }
 
 	inline const Coord& getLocation() const { return location; }
 	inline SDL_Surface* getSprite() const { return sprite; }
@@ -449,28 +440,29 @@ public:
 	Coord	location;   ///< location of this tile in map coordinates
 
 private:
+    // the fields used every game cycle come first so that they share as few cache lines as possible
 
 	Uint32  	type;   ///< the type of the tile (Terrain_Sand, Terrain_Rock, ...)
+	Sint32      owner;          ///< house ID of the owner of this tile
+	FixPoint    spice;          ///< how much spice on this particular cell is left
 
-	bool        explored[MAX_PLAYERS];      ///< contains for every player if this tile is explored
-	Uint32      lastAccess[MAX_PLAYERS];    ///< contains for every player when this tile was seen last by this player
+	ObjectIDList    assignedAirUnitList;                    ///< all the air units on this tile
+	ObjectIDList    assignedInfantryList;                   ///< all infantry units on this tile
+	ObjectIDList    assignedUndergroundUnitList;            ///< all underground units on this tile
+	ObjectIDList    assignedNonInfantryGroundObjectList;    ///< all structures/vehicles on this tile
 
-	Uint32      fogColor;       ///< remember last color (radar)
+	Sint16                          tracksCounter[NUM_ANGLES];  ///< Contains counters for the tracks on sand
+	std::vector<DEADUNITTYPE>       deadUnits;                  ///< dead units
+
+    // the fields only needed for drawing or rarely
 
-	Sint32      owner;          ///< house ID of the owner of this tile
 	Uint32      sandRegion;     ///< used by sandworms to check if can get to a unit
 
-	double      spice;          ///< how much spice on this particular cell is left
+
+	Uint32      fogColor;       ///< remember last color (radar)
 
 	std::vector<DAMAGETYPE>         damage;                     ///< damage positions
-	std::vector<DEADUNITTYPE>       deadUnits;                  ///< dead units
     Sint32                          destroyedStructureTile;     ///< the tile drawn for a destroyed structure
-	Sint16                          tracksCounter[NUM_ANGLES];  ///< Contains counters for the tracks on sand
-
-	std::list<Uint32>	assignedAirUnitList;                    ///< all the air units on this tile
-	std::list<Uint32>	assignedInfantryList;                   ///< all infantry units on this tile
-	std::list<Uint32>	assignedUndergroundUnitList;            ///< all underground units on this tile
-	std::list<Uint32>	assignedNonInfantryGroundObjectList;    ///< all structures/vehicles on this tile
 
 	SDL_Surface		*sprite;    ///< the graphic to draw
 };
@@ -22,7 +22,7 @@
 #include <Definitions.h>
 #include <FileClasses/Palette.h>
 #include <data.h>
-#include <misc/RobustList.h>
+#include <misc/IntrusiveList.h>
 #include <SDL.h>
 
 
@@ -76,9 +76,9 @@ EXTERN ScreenBorder*        screenborder;               ///< the screen border f
 EXTERN MapClass*            currentGameMap;             ///< the map for the current running game
 EXTERN House*		        pLocalHouse;                ///< the house of the human player that is playing the current running game on this computer
 
-EXTERN RobustList<UnitClass*>       unitList;           ///< the list of all units
-EXTERN RobustList<StructureClass*>  structureList;      ///< the list of all structures
-EXTERN RobustList<BulletClass*>     bulletList;         ///< the list of all bullets
+EXTERN IntrusiveList<UnitClass>       unitList;           ///< the list of all units
+EXTERN IntrusiveList<StructureClass>  structureList;      ///< the list of all structures
+EXTERN IntrusiveList<BulletClass>     bulletList;         ///< the list of all bullets
 
 
 // misc
@@ -86,7 +86,6 @@ EXTERN SettingsClass    settings;                       ///< the settings read f
 
 EXTERN bool debug;                                      ///< is set for debugging purposes
 
-EXTERN int lookDist[11];                                ///< lookup table for the circular viewing area
 EXTERN int houseColor[NUM_HOUSES];                      ///< the base colors for the different houses
 
 #endif //GLOBALS_H
@@ -21,15 +21,37 @@
 #include "Stream.h"
 #include <stdlib.h>
 #include <string>
+#include <vector>
+#include <stdio.h>
 
+/**
+	A Stream that reads from or writes to a file. All data goes through an internal buffer of BUFFER_SIZE bytes, so
+	reading or writing a single value is only a copy into this buffer. Files can optionally be written compressed: they
+	start with COMPRESSED_MAGIC followed by frames of at most BUFFER_SIZE uncompressed bytes, each compressed with
+	lzCompress(). Compressed and uncompressed files are both read transparently.
+*/
 class FileStream : public Stream
 {
 public:
+	static const int BUFFER_SIZE = 64*1024;				///< the size of the internal buffer and of the compressed frames
+	static const Uint32 COMPRESSED_MAGIC = 0x315A4C44;	///< "DLZ1" in little endian at the beginning of compressed files
+
 	FileStream();
 	~FileStream();
 
-	bool open(const char* filename,const char* mode);
-	bool open(std::string filename,const char* mode);
+	/**
+		Opens a file.
+		\param	filename	the file to open
+		\param	mode		the mode as for fopen(), e.g. "rb" or "wb"
+		\param	bCompressed	true if the file is opened for writing and shall be compressed; ignored for reading
+		\return	true on success, false otherwise
+	*/
+	bool open(const char* filename,const char* mode, bool bCompressed = false);
+	bool open(std::string filename,const char* mode, bool bCompressed = false);
+
+	/**
+		Writes out all buffered data and closes the file. A Stream::error is thrown if writing fails.
+	*/
 	void close();
 
 	virtual void flush();
@@ -45,6 +67,8 @@ public:
 	void writeBool(bool x);
 	void writeDouble(double x);
 
+	void writeBytes(const void* pData, size_t length);
+
 	// read operations
 
 	std::string readString();
@@ -56,8 +80,27 @@ public:
 	bool readBool();
 	double readDouble();
 
+	void readBytes(void* pData, size_t length);
+
 private:
-	FILE* fp;
+	/**
+		Writes the content of the buffer to the file (as one frame for compressed files) and empties the buffer.
+		\return	true on success, false on an I/O error
+	*/
+	bool writeBuffer();
+
+	/**
+		Refills the empty buffer from the file. A Stream::eof is thrown at the end of the file.
+	*/
+	void readBuffer();
+
+	FILE*				fp;
+	bool				bWriting;			///< true if the file is opened for writing
+	bool				bCompressed;		///< true if the file is compressed
+	std::vector<Uint8>	buffer;				///< the data to write or the data read from the file
+	size_t				bufferPos;			///< the current position inside buffer
+	size_t				bufferLength;		///< the number of valid bytes in buffer when reading
+	std::vector<Uint8>	compressedBuffer;	///< a frame of a compressed file
 };
 
 #endif // FILESTREAM_H
@@ -66,6 +66,13 @@ std::list<std::string> GetFileNamesList(std::string directory, std::string exten
 */
 std::list<FileInfo> GetFileList(std::string directory, std::string extension, bool IgnoreCase = false, FileListOrder fileListOrder = FileListOrder_Unsorted);
 
+/**
+	This function returns the names of all entries in the specified directory (except "." and "..").
+	\param	directory	the directory name
+	\return	a list of all entries in this directory; the list is empty if the directory does not exist
+*/
+std::list<std::string> GetDirectoryEntries(std::string directory);
+
 /**
     This function is used to determine a case insensitive filename. The parameter filepath specifies the complete path to the file (relative or absolute).
     The path components are treated case sensitive to determine the directory to search the file in. The filename component of filepath is then compared
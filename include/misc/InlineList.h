@@ -0,0 +1,134 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INLINELIST_H
+#define INLINELIST_H
+
+#include <stdlib.h>
+#include <vector>
+
+/**
+	A list for a few small elements. Up to N elements are stored inside the list object itself,
+	so no memory has to be allocated for them. Only if there are more than N elements they are moved
+	to a std::vector. The interface is a subset of std::list.
+
+	Caution: Iterators are plain pointers and are invalidated by every modification of the list.
+*/
+template<typename T, int N>
+class InlineList {
+public:
+	typedef T* iterator;
+	typedef const T* const_iterator;
+
+	InlineList() : numElements(0), pOverflow(NULL) {
+	}
+
+	InlineList(const InlineList<T,N>& list) : numElements(0), pOverflow(NULL) {
+		*this = list;
+	}
+
+	~InlineList() {
+		delete pOverflow;
+	}
+
+	InlineList<T,N>& operator=(const InlineList<T,N>& list) {
+		if(this != &list) {
+			assign(list.begin(), list.end());
+		}
+		return *this;
+	}
+
+	/**
+		Replaces the content of this list by the elements in [first, last).
+		\param	first	the first element to copy
+		\param	last	the element after the last element to copy
+	*/
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		clear();
+		for(;first != last; ++first) {
+			push_back(*first);
+		}
+	}
+
+	inline iterator begin() { return getData(); }
+	inline const_iterator begin() const { return getData(); }
+	inline iterator end() { return getData() + numElements; }
+	inline const_iterator end() const { return getData() + numElements; }
+
+	inline size_t size() const { return numElements; }
+	inline bool empty() const { return (numElements == 0); }
+
+	inline T& front() { return getData()[0]; }
+	inline const T& front() const { return getData()[0]; }
+
+	void push_back(const T& element) {
+		if(pOverflow != NULL) {
+			pOverflow->push_back(element);
+		} else if(numElements < N) {
+			elements[numElements] = element;
+		} else {
+			pOverflow = new std::vector<T>(elements, elements + N);
+			pOverflow->push_back(element);
+		}
+		numElements++;
+	}
+
+	/**
+		Removes all elements that are equal to element. The order of the other elements is kept.
+		\param	element	the element to remove
+	*/
+	void remove(const T& element) {
+		T* pData = getData();
+		size_t newNumElements = 0;
+		for(size_t i = 0; i < numElements; i++) {
+			if(pData[i] != element) {
+				pData[newNumElements++] = pData[i];
+			}
+		}
+		numElements = newNumElements;
+
+		if(pOverflow != NULL) {
+			if(numElements <= (size_t) N) {
+				// move back inside
+				for(size_t i = 0; i < numElements; i++) {
+					elements[i] = (*pOverflow)[i];
+				}
+				delete pOverflow;
+				pOverflow = NULL;
+			} else {
+				pOverflow->resize(numElements);
+			}
+		}
+	}
+
+	void clear() {
+		delete pOverflow;
+		pOverflow = NULL;
+		numElements = 0;
+	}
+
+private:
+	inline T* getData() { return (pOverflow != NULL) ? &(*pOverflow)[0] : elements; }
+	inline const T* getData() const { return (pOverflow != NULL) ? &(*pOverflow)[0] : elements; }
+
+	T					elements[N];	///< the elements if there are not more than N
+	size_t				numElements;	///< the number of elements in this list
+	std::vector<T>*		pOverflow;		///< all elements if there are more than N; NULL otherwise
+};
+
+#endif // INLINELIST_H
@@ -0,0 +1,293 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <stdlib.h>
+
+template<typename T> class IntrusiveList;
+template<typename T> class IntrusiveListIterator;
+
+/**
+	The links of an element of an IntrusiveList. A class whose objects shall be stored in an IntrusiveList derives from
+	this class. An object can only be in one IntrusiveList at a time.
+*/
+class IntrusiveListHook {
+public:
+	IntrusiveListHook() : pPrevHook(NULL), pNextHook(NULL) {
+	}
+
+	/**
+		Copying an object does not copy its membership in a list.
+	*/
+	IntrusiveListHook(const IntrusiveListHook&) : pPrevHook(NULL), pNextHook(NULL) {
+	}
+
+	IntrusiveListHook& operator=(const IntrusiveListHook&) {
+		return *this;
+	}
+
+	/**
+		Checks if this object is in a list.
+		\return	true if it is in a list, false otherwise
+	*/
+	inline bool isLinked() const { return (pNextHook != NULL); }
+
+private:
+	template<typename T> friend class IntrusiveList;
+	template<typename T> friend class IntrusiveListIterator;
+
+	IntrusiveListHook* pPrevHook;	///< the previous element in the list
+	IntrusiveListHook* pNextHook;	///< the next element in the list (NULL if not in a list)
+};
+
+/**
+	An iterator of an IntrusiveList. Iterators returned by IntrusiveList::begin() are registered at their list, so the
+	list can move them to the next element when the element they point to is removed. Registering only links the iterator
+	into a chain inside the list, nothing is allocated. The iterator returned by IntrusiveList::end() is not registered.
+*/
+template<typename T>
+class IntrusiveListIterator {
+public:
+	/**
+		Default constructor. Does not register at a list.
+	*/
+	IntrusiveListIterator() : pCurrent(NULL), pList(NULL), bAdvanced(false), pPrevIterator(NULL), pNextIterator(NULL) {
+	}
+
+	/**
+		Copy constructor. The copy is registered at the same list as x.
+	*/
+	IntrusiveListIterator(const IntrusiveListIterator<T>& x) : pCurrent(x.pCurrent), pList(NULL), bAdvanced(x.bAdvanced), pPrevIterator(NULL), pNextIterator(NULL) {
+		registerAtList(x.pList);
+	}
+
+	/**
+		destructor
+	*/
+	~IntrusiveListIterator() {
+		unregisterFromList();
+	}
+
+	IntrusiveListIterator<T>& operator=(const IntrusiveListIterator<T>& x) {
+		if(pList != x.pList) {
+			unregisterFromList();
+			registerAtList(x.pList);
+		}
+		pCurrent = x.pCurrent;
+		bAdvanced = x.bAdvanced;
+		return *this;
+	}
+
+	/**
+		This operator returns the element the iterator is currently pointing to
+		\return the element the iterator is currently pointing to
+	*/
+	inline T* operator*() const {
+		return static_cast<T*>(pCurrent);
+	}
+
+	/**
+		This operator advances to the next element in the list. If the element the iterator was pointing to has been
+		removed the iterator already points to the next element and is not advanced again.
+		\return A reference to this iterator
+	*/
+	inline IntrusiveListIterator<T>& operator++() {
+		if(bAdvanced == true) {
+			bAdvanced = false;
+		} else {
+			pCurrent = pCurrent->pNextHook;
+		}
+		return *this;
+	}
+
+	inline bool operator==(const IntrusiveListIterator<T>& x) const {
+		return (pCurrent == x.pCurrent);
+	}
+
+	inline bool operator!=(const IntrusiveListIterator<T>& x) const {
+		return (pCurrent != x.pCurrent);
+	}
+
+private:
+	friend class IntrusiveList<T>;
+
+	/**
+		Constructs an iterator that points at start.
+		\param	start	the element to point at
+		\param	pList	the list to register at or NULL
+	*/
+	IntrusiveListIterator(IntrusiveListHook* start, const IntrusiveList<T>* pList) : pCurrent(start), pList(NULL), bAdvanced(false), pPrevIterator(NULL), pNextIterator(NULL) {
+		registerAtList(pList);
+	}
+
+	void registerAtList(const IntrusiveList<T>* pNewList) {
+		pList = pNewList;
+		if(pList != NULL) {
+			pNextIterator = pList->pIterators;
+			if(pNextIterator != NULL) {
+				pNextIterator->pPrevIterator = this;
+			}
+			pList->pIterators = this;
+		}
+	}
+
+	void unregisterFromList() {
+		if(pList != NULL) {
+			if(pPrevIterator != NULL) {
+				pPrevIterator->pNextIterator = pNextIterator;
+			} else {
+				pList->pIterators = pNextIterator;
+			}
+			if(pNextIterator != NULL) {
+				pNextIterator->pPrevIterator = pPrevIterator;
+			}
+			pPrevIterator = NULL;
+			pNextIterator = NULL;
+			pList = NULL;
+		}
+	}
+
+	IntrusiveListHook*			pCurrent;		///< the element this iterator points to
+	const IntrusiveList<T>*		pList;			///< the list this iterator is registered at or NULL
+	bool						bAdvanced;		///< the element this iterator pointed to was removed and pCurrent is already the next one
+	IntrusiveListIterator<T>*	pPrevIterator;	///< the previous iterator registered at pList
+	IntrusiveListIterator<T>*	pNextIterator;	///< the next iterator registered at pList
+};
+
+/**
+	A list of objects that stores the links inside the objects (T must derive from IntrusiveListHook). Adding and removing
+	an element does not allocate anything and removing is O(1). Like RobustList the list may be modified in any way while
+	iterating over it: Iterators pointing to a removed element are moved to the next element and elements added at the end
+	are still visited. The elements are not owned by the list.
+*/
+template<typename T>
+class IntrusiveList {
+public:
+	typedef IntrusiveListIterator<T> iterator;
+	typedef IntrusiveListIterator<T> const_iterator;
+
+	IntrusiveList() : numElements(0), pIterators(NULL) {
+		sentinel.pPrevHook = &sentinel;
+		sentinel.pNextHook = &sentinel;
+	}
+
+	~IntrusiveList() {
+		clear();
+
+		while(pIterators != NULL) {
+			pIterators->unregisterFromList();
+		}
+	}
+
+	/**
+		Returns the number of elements currently stored in the list.
+		\return number of elements in the list
+	*/
+	inline int size() const {
+		return numElements;
+	}
+
+	/**
+		Checks whether this list is empty.
+		\returns true if the number of elements is zero, false otherwise.
+	*/
+	inline bool empty() const {
+		return (numElements == 0);
+	}
+
+	/**
+		Adds pElement at the end of the list. pElement must not be in a list.
+		\param	pElement	the element to add
+	*/
+	void push_back(T* pElement) {
+		IntrusiveListHook* pHook = pElement;
+		pHook->pNextHook = &sentinel;
+		pHook->pPrevHook = sentinel.pPrevHook;
+		sentinel.pPrevHook->pNextHook = pHook;
+		sentinel.pPrevHook = pHook;
+		numElements++;
+	}
+
+	/**
+		Removes pElement from this list. Nothing is done if pElement is not in a list.
+		\param	pElement	the element to remove
+	*/
+	void remove(T* pElement) {
+		IntrusiveListHook* pHook = pElement;
+		if(pHook->isLinked()) {
+			unlink(pHook);
+		}
+	}
+
+	/**
+		Removes all elements from this list. The elements are not deleted.
+	*/
+	void clear() {
+		while(sentinel.pNextHook != &sentinel) {
+			unlink(sentinel.pNextHook);
+		}
+	}
+
+	/**
+		Returns an iterator that points to the first element of the list.
+		\return	Iterator that points to the beginning of the list
+	*/
+	inline iterator begin() const {
+		return iterator(sentinel.pNextHook, this);
+	}
+
+	/**
+		Returns an iterator that points just past the last element of the list.
+		\return	Iterator that points to the end of the list
+	*/
+	inline iterator end() const {
+		return iterator(const_cast<IntrusiveListHook*>(&sentinel), NULL);
+	}
+
+private:
+	friend class IntrusiveListIterator<T>;
+
+	IntrusiveList(const IntrusiveList<T>& x);
+	IntrusiveList<T>& operator=(const IntrusiveList<T>& x);
+
+	/**
+		Removes pHook from the list and moves all iterators pointing to it to the next element.
+		\param	pHook	the element to remove
+	*/
+	void unlink(IntrusiveListHook* pHook) {
+		for(IntrusiveListIterator<T>* pIterator = pIterators; pIterator != NULL; pIterator = pIterator->pNextIterator) {
+			if(pIterator->pCurrent == pHook) {
+				pIterator->pCurrent = pHook->pNextHook;
+				pIterator->bAdvanced = true;
+			}
+		}
+
+		pHook->pPrevHook->pNextHook = pHook->pNextHook;
+		pHook->pNextHook->pPrevHook = pHook->pPrevHook;
+		pHook->pPrevHook = NULL;
+		pHook->pNextHook = NULL;
+		numElements--;
+	}
+
+	IntrusiveListHook					sentinel;		///< the element before the first and after the last element
+	int									numElements;	///< the number of elements in this list
+	mutable IntrusiveListIterator<T>*	pIterators;		///< all registered iterators
+};
+
+#endif // INTRUSIVELIST_H
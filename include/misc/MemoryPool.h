@@ -0,0 +1,83 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MEMORYPOOL_H
+#define MEMORYPOOL_H
+
+#include <stdlib.h>
+#include <vector>
+
+/**
+	A pool for small memory blocks of varying size. The sizes are rounded up to a multiple of GRANULARITY bytes and for
+	every rounded size the freed blocks are kept in a free list to be handed out again. New blocks are cut from chunks of
+	CHUNK_SIZE bytes that are only given back to the heap by reset(). Blocks that are larger than MAX_BLOCK_SIZE are
+	taken from the heap directly.
+	Classes use a pool by overloading operator new and operator delete.
+*/
+class MemoryPool {
+public:
+	MemoryPool();
+	~MemoryPool();
+
+	/**
+		Allocates a block of at least size bytes.
+		\param	size	the size of the block in bytes
+		\return	the allocated block
+	*/
+	void* allocate(size_t size);
+
+	/**
+		Gives the block p back to the pool.
+		\param	p		the block to free (may be NULL)
+		\param	size	the size of the block as passed to allocate()
+	*/
+	void deallocate(void* p, size_t size);
+
+	/**
+		Gives all chunks back to the heap. This is only done if no block is in use anymore, otherwise the pool is left
+		untouched.
+	*/
+	void reset();
+
+	inline int getNumAllocations() const { return numAllocations; }
+	inline int getNumHeapAllocations() const { return numHeapAllocations; }
+	inline int getNumBlocksInUse() const { return numBlocksInUse; }
+
+private:
+	MemoryPool(const MemoryPool&);
+	MemoryPool& operator=(const MemoryPool&);
+
+	static const size_t GRANULARITY = 16;
+	static const size_t CHUNK_SIZE = 64*1024;
+	static const size_t MAX_BLOCK_SIZE = 4*1024;
+
+	/// A freed block. Its memory is used for the link to the next free block.
+	struct FreeBlock {
+		FreeBlock* pNext;
+	};
+
+	std::vector<FreeBlock*>	freeLists;			///< the free blocks for every size class (index is size/GRANULARITY - 1)
+	std::vector<char*>		chunks;				///< all chunks taken from the heap
+	char*					pChunkPos;			///< the first unused byte of the current chunk
+	size_t					chunkBytesLeft;		///< the unused bytes left in the current chunk
+
+	int		numAllocations;		///< the number of blocks allocated so far
+	int		numHeapAllocations;	///< the number of allocations from the heap so far (chunks and large blocks)
+	int		numBlocksInUse;		///< the number of blocks currently allocated
+};
+
+#endif // MEMORYPOOL_H
@@ -117,6 +117,12 @@ public:
         writeUint8(x == true ? 1 : 0);
 	}
 
+	void writeBytes(const void* pData, size_t length) {
+        ensureBufferSize(currentPos + length);
+        memcpy(pBuffer + currentPos, pData, length);
+        currentPos += length;
+	}
+
 	void writeDouble(double x) {
         if(sizeof(double) != sizeof(Uint64)) {
             throw Stream::error("MemoryStream::writeDouble(): sizeof(double) != sizeof(Uint64). Cannot save doubles on such systems.");
@@ -179,6 +185,15 @@ public:
         return (readUint8() == 1 ? true : false);
     }
 
+	void readBytes(void* pData, size_t length) {
+	    if(length > (size_t) (bufferSize - currentPos)) {
+            throw Stream::eof("MemoryStream::readBytes(): End-of-File reached!");
+	    }
+
+        memcpy(pData, pBuffer + currentPos, length);
+        currentPos += length;
+	}
+
 	double readDouble() {
         if(sizeof(double) != sizeof(Uint64)) {
             throw Stream::error("MemoryStream::readDouble(): sizeof(double) != sizeof(Uint64). Cannot read doubles on such systems.");
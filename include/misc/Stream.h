@@ -19,6 +19,8 @@
 #define STREAM_H
 
 
+#include <FixPoint.h>
+
 #include <SDL.h>
 #include <string>
 #include <list>
@@ -63,6 +65,30 @@ public:
 	virtual bool readBool() = 0;
 	virtual double readDouble() = 0;
 
+	/**
+		Writes out a block of bytes as they are. Streams with an internal buffer should override this.
+		\param	pData	the bytes to write
+		\param	length	the number of bytes to write
+	*/
+	virtual void writeBytes(const void* pData, size_t length) {
+		const Uint8* pBytes = (const Uint8*) pData;
+		for(size_t i = 0; i < length; i++) {
+			writeUint8(pBytes[i]);
+		}
+	}
+
+	/**
+		Reads in a block of bytes written by writeBytes().
+		\param	pData	the buffer to read to
+		\param	length	the number of bytes to read
+	*/
+	virtual void readBytes(void* pData, size_t length) {
+		Uint8* pBytes = (Uint8*) pData;
+		for(size_t i = 0; i < length; i++) {
+			pBytes[i] = readUint8();
+		}
+	}
+
 
     /**
         Writes out a Sint8 value.
@@ -136,6 +162,22 @@ public:
         return *((Sint64*) &tmp);
 	}
 
+	/**
+        Writes out a FixPoint value.
+        \param x    the value to write out
+	*/
+	void writeFixPoint(FixPoint x) {
+        writeSint32(x.getRaw());
+	}
+
+	/**
+        Reads in a FixPoint value.
+        \return the read value
+	*/
+	FixPoint readFixPoint() {
+        return FixPoint::fromRaw(readSint32());
+	}
+
 	/**
 		Writes out a complete list of Uint32
 		\param	List	the list to write
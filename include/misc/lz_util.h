@@ -0,0 +1,45 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LZ_UTIL_H
+#define LZ_UTIL_H
+
+#include <SDL.h>
+
+#include <vector>
+
+/**
+	Compresses a block of data with a fast LZ77 compressor in the style of LZ4. The data is encoded as a sequence of
+	literal runs and back references into the last 64 KiB. It is meant for save games and replays, where speed matters
+	more than the compression ratio.
+	\param	pSrc		the data to compress
+	\param	srcLength	the number of bytes to compress
+	\param	dest		the compressed data is appended to this vector
+*/
+void lzCompress(const Uint8* pSrc, size_t srcLength, std::vector<Uint8>& dest);
+
+/**
+	Decompresses a block of data compressed by lzCompress().
+	\param	pSrc		the compressed data
+	\param	srcLength	the number of compressed bytes
+	\param	pDest		the buffer for the decompressed data
+	\param	destLength	the number of bytes the data decompresses to
+	\return	true on success, false if the compressed data is corrupt or does not decompress to exactly destLength bytes
+*/
+bool lzDecompress(const Uint8* pSrc, size_t srcLength, Uint8* pDest, size_t destLength);
+
+#endif // LZ_UTIL_H
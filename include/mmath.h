@@ -21,18 +21,18 @@
 // forward declaration
 class Coord;
 
-#include <cmath>
+#include <FixPoint.h>
 
-double fixDouble(double number);
+#include <cmath>
 
 int getRandomInt(int min, int max);
 int getRandomOf(int numParam, ...);
 
-double dest_angle(const Coord& p1, const Coord& p2);
+FixPoint dest_angle(const Coord& p1, const Coord& p2);
 
-double distance_from(const Coord& p1, const Coord& p2);
-double distance_from(double x, double y, double to_x, double to_y);
+FixPoint distance_from(const Coord& p1, const Coord& p2);
+FixPoint distance_from(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y);
 
-double blockDistance(const Coord& p1, const Coord& p2);
+FixPoint blockDistance(const Coord& p1, const Coord& p2);
 
 #endif //MMATH_H
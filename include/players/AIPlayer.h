@@ -24,6 +24,12 @@
 
 #include <misc/Stream.h>
 
+#include <list>
+
+// forward declarations
+class StructureClass;
+class BuilderClass;
+
 class AIPlayer : public Player
 {
 public:
@@ -35,8 +41,8 @@ public:
 
     virtual void update();
 
-    virtual void onIncrementStructures(int itemID);
-    virtual void onDecrementStructures(int itemID, const Coord& location);
+    virtual void onIncrementStructures(int itemID, StructureClass* pStructure);
+    virtual void onDecrementStructures(int itemID, const Coord& location, StructureClass* pStructure);
     virtual void onDamage(ObjectClass* pObject, const Coord& location);
 
     void setDifficulty(DIFFICULTYTYPE newDifficulty);
@@ -47,6 +53,13 @@ public:
 	inline int getAttackTimer() const { return attackTimer; }
 
 private:
+    /**
+        Chooses the next structure the construction yard shall build.
+        \param  pConstructionYard   the construction yard
+        \return the item id of the structure or NONE if nothing shall be built
+    */
+	Uint32 chooseStructureToBuild(BuilderClass* pConstructionYard) const;
+
 	Coord findPlaceLocation(Uint32 itemID);
 
 	DIFFICULTYTYPE	difficulty;     ///< difficulty level
@@ -54,6 +67,9 @@ private:
     Sint32  buildTimer;     ///< When to build the next structure/unit
 
 	std::list<Coord> placeLocations;    ///< Where to place structures
+
+	std::list<StructureClass*> structures;  ///< All structures of this house in the order they were created (not saved, rebuilt by onIncrementStructures())
+	std::list<StructureClass*> builders;    ///< All builders of this house in the order they were created (not saved, rebuilt by onIncrementStructures())
 };
 
 #endif //AIPLAYER_H
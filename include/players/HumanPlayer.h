@@ -36,8 +36,8 @@ public:
 
     virtual void update();
 
-    virtual void onIncrementStructures(int itemID);
-    virtual void onDecrementStructures(int itemID, const Coord& location);
+    virtual void onIncrementStructures(int itemID, StructureClass* pStructure);
+    virtual void onDecrementStructures(int itemID, const Coord& location, StructureClass* pStructure);
     virtual void onDamage(ObjectClass* pObject, const Coord& location);
 };
 
@@ -23,6 +23,7 @@
 
 class House;
 class ObjectClass;
+class StructureClass;
 
 class Player {
 public:
@@ -32,8 +33,21 @@ public:
 
     virtual void update() = 0;
 
-    virtual void onIncrementStructures(int itemID) = 0;
-    virtual void onDecrementStructures(int itemID, const Coord& location) = 0;
+    /**
+        Called when a structure of the house is created or loaded.
+        \param  itemID      the type of the new structure
+        \param  pStructure  the new structure; it is not fully constructed yet
+    */
+    virtual void onIncrementStructures(int itemID, StructureClass* pStructure) = 0;
+
+    /**
+        Called when a structure of the house is destroyed.
+        \param  itemID      the type of the destroyed structure
+        \param  location    the location of the destroyed structure
+        \param  pStructure  the destroyed structure; it is already partly destructed and may only be compared with other pointers
+    */
+    virtual void onDecrementStructures(int itemID, const Coord& location, StructureClass* pStructure) = 0;
+
     virtual void onDamage(ObjectClass* pObject, const Coord& location) = 0;
 
     House* getHouse() const { return pHouse; };
@@ -46,6 +46,10 @@ inline int missionNumberToLevelNumber(int missionNumber) {
 
 void startReplay(std::string filename);
 void startSinglePlayerGame(const GameInitSettings& init);
+void runPathfindingBenchmark();
+void runMusicBenchmark();
+void runListBenchmark();
+void runHeadlessSimulation(const std::string& filename, bool bReplay, Uint32 maxCycles);
 
 
 #endif //SAND_H
@@ -132,12 +132,12 @@ public:
 	inline bool AllowedToUpgrade() const { return (MaxUpgradeLevel() > 0); };
 	inline int CurrentUpgradeLevel() const { return curUpgradeLev; };
 	int GetUpgradeCost() const;
-	inline double GetUpgradeProgress() const { return upgradeProgress; };
+	inline FixPoint GetUpgradeProgress() const { return upgradeProgress; };
 
 	inline Uint32 GetCurrentProducedItem() const { return CurrentProducedItem; };
 	inline bool IsOnHold() { return CurrentItemOnHold; };
 	bool IsWaitingToPlace() const;
-	inline double GetProductionProgress() const { return ProductionProgress; };
+	inline FixPoint GetProductionProgress() const { return ProductionProgress; };
 	inline const std::list<BuildItem>& GetBuildList() const { return BuildList; };
 	virtual void InsertItem(std::list<BuildItem>& List, std::list<BuildItem>::iterator& iter, Uint32 itemID, int price=-1);
 	void RemoveItem(std::list<BuildItem>& List, std::list<BuildItem>::iterator& iter, Uint32 itemID);
@@ -175,12 +175,12 @@ protected:
 
     // structure state
     bool    upgrading;              ///< Currently upgrading?
-	double  upgradeProgress;        ///< The current state of the upgrade progress (measured in money spent)
+	FixPoint upgradeProgress;       ///< The current state of the upgrade progress (measured in money spent)
 	Uint8   curUpgradeLev;          ///< Current upgrade level
 
 	bool    CurrentItemOnHold;      ///< Is the currently produced item on hold?
 	Uint32  CurrentProducedItem;    ///< The ItemID of the currently produced item
-	double  ProductionProgress;     ///< The current state of the production progress (measured in money spent)
+	FixPoint ProductionProgress;    ///< The current state of the production progress (measured in money spent)
 	Uint32  deployTimer;            ///< Timer for deploying a unit
 
 	std::list<ProductionQueueItem>  CurrentProductionList;      ///< This list is the production queue (It contains the item IDs of the units/structures to produce)
@@ -41,7 +41,7 @@ public:
 	void turnRight();
 	virtual void attack();
 
-	inline int getTurretAngle() { return lround(angle); }
+	inline int getTurretAngle() { return angle.roundToInt(); }
 
 protected:
     // constant for all turrets of the same type
@@ -30,7 +30,7 @@ public:
 
     virtual ObjectInterface* GetInterfaceContainer();
 
-    virtual void setHealth(double newHealth);
+    virtual void setHealth(FixPoint newHealth);
 
 	int getProducedPower();
 };
@@ -38,7 +38,7 @@ public:
 	*/
 	bool update();
 
-    virtual double getMaxSpeed() const;
+    virtual FixPoint getMaxSpeed() const;
 
 	virtual void deploy(const Coord& newLocation);
 
@@ -78,7 +78,7 @@ protected:
 	bool	aDropOfferer;       ///< This carryall just drops some units and vanishes afterwards
 	bool    droppedOffCargo;    ///< Is the cargo already dropped off?
 
-	double  currentMaxSpeed;    ///< The current maximum allowed speed
+	FixPoint currentMaxSpeed;   ///< The current maximum allowed speed
 
 	Uint8   curFlyPoint;        ///< The current flyPoint
 	Coord	flyPoints[8];       ///< Array of flight points
@@ -41,7 +41,7 @@ public:
 	void harvesterReturn();
 
 	void move();
-	void setAmountOfSpice(double newSpice);
+	void setAmountOfSpice(FixPoint newSpice);
 	void setReturned();
 
 	void setDestination(int newX, int newY);
@@ -50,9 +50,9 @@ public:
 	void setTarget(ObjectClass* newTarget);
 
 	bool canAttack(const ObjectClass* object) const;
-	double extractSpice();
+	FixPoint extractSpice();
 
-	inline double getAmountOfSpice() { return spice; }
+	inline FixPoint getAmountOfSpice() { return spice; }
 	inline bool isReturning() { return returningToRefinery; }
 	bool isHarvesting() const;
 	inline void setReturning(bool returning) { returningToRefinery = returning; };
@@ -61,7 +61,7 @@ private:
     // harvester state
 	bool	harvestingMode;             ///< currently harvesting
     bool    returningToRefinery;    ///< currently on the way back to the refinery
-	double  spice;                  ///< loaded spice
+	FixPoint spice;                 ///< loaded spice
 	Uint32  spiceCheckCounter;      ///< Check for available spice on map to harvest
 };
 
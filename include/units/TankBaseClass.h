@@ -32,7 +32,7 @@ public:
 
 	void navigate();
 
-	inline int getTurretAngle() { return lround(turretAngle); }
+	inline int getTurretAngle() { return turretAngle.roundToInt(); }
 
 	virtual int getCurrentAttackAngle();
 
@@ -44,10 +44,10 @@ protected:
 	void turnTurretRight();
 
     // constant for all tanks of the same type
-	double      turretTurnSpeed;    ///< How fast can we turn the turret
+	FixPoint    turretTurnSpeed;    ///< How fast can we turn the turret
 
     // tank state
-    double  turretAngle;            ///< The angle of the turret
+    FixPoint turretAngle;           ///< The angle of the turret
 	Sint8   drawnTurretAngle;       ///< The drawn angle of the turret
 
 	ObjectPointer	closeTarget;	///< a enemy target that can be shot at while moving
@@ -160,9 +160,15 @@ public:
 
 	virtual bool canPass(int xPos, int yPos) const;
 
+	/**
+        Returns the movement class of this unit. All units of one movement class can pass the same terrain (ignoring other units).
+        \return the movement class of this unit
+	*/
+	MOVEMENTCLASS getMovementClass() const;
+
 	virtual int getCurrentAttackAngle();
 
-    virtual double getMaxSpeed() const;
+    virtual FixPoint getMaxSpeed() const;
 
 
 	inline void clearNextSpotFound() { nextSpotFound = false; }
@@ -171,7 +177,7 @@ public:
 
 	inline void setAttacking(bool status) { attacking = status; }
 
-	inline void setSpeedCap(double newSpeedCap) { speedCap = newSpeedCap; }
+	inline void setSpeedCap(FixPoint newSpeedCap) { speedCap = newSpeedCap; }
 	inline bool isAttacking() const { return attacking; }
 	inline bool isTracked() const { return tracked; }
 
@@ -229,11 +235,11 @@ protected:
     bool    moving;                 ///< Are we currently moving?
     bool    turning;                ///< Are we currently turning?
     bool    justStoppedMoving;      ///< Do we have just stopped moving?
-    double	speedCap;               ///< What is the current speed cap for this unit?
-    double	xSpeed;                 ///< Speed in x direction
-    double	ySpeed;                 ///< Speed in y direction
+    FixPoint speedCap;              ///< What is the current speed cap for this unit?
+    FixPoint xSpeed;                ///< Speed in x direction
+    FixPoint ySpeed;                ///< Speed in y direction
 
-    double	targetDistance;         ///< Distance to the destination
+    FixPoint targetDistance;        ///< Distance to the destination
     Sint8   targetAngle;            ///< Angle to the destination
 
     // path finding
@@ -27,23 +27,51 @@
 
 #define MAX_NODES_CHECKED   (128*128)
 
-AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord destination) {
-    sizeX = pMap->sizeX;
-    sizeY = pMap->sizeY;
+AStarSearchWorkspace::AStarSearchWorkspace(int sizeX, int sizeY) {
+    this->sizeX = sizeX;
+    this->sizeY = sizeY;
+    generation = 0;
 
     mapData = (TileData*) calloc(sizeX*sizeY, sizeof(TileData));
     if(mapData == NULL) {
         throw std::bad_alloc();
     }
+}
+
+AStarSearchWorkspace::~AStarSearchWorkspace() {
+    free(mapData);
+}
+
+void AStarSearchWorkspace::beginSearch() {
+    openList.clear();
 
-    float heuristic = blockDistance(start, destination);
-    float smallestHeuristic = heuristic;
+    generation++;
+    if(generation == 0) {
+        // generation counter wrapped around => invalidate all old tile data
+        for(int i = 0; i < sizeX*sizeY; i++) {
+            mapData[i].generation = 0;
+        }
+        generation = 1;
+    }
+}
+
+AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord destination) {
+    this->pMap = pMap;
+    pWorkspace = pMap->getAStarSearchWorkspace();
+    pWorkspace->beginSearch();
+
+    int sizeX = pWorkspace->getSizeX();
+    int sizeY = pWorkspace->getSizeY();
+    std::vector<Coord>& openList = pWorkspace->openList;
+
+    FixPoint heuristic = blockDistance(start, destination);
+    FixPoint smallestHeuristic = heuristic;
     bestCoord = Coord(INVALID_POS,INVALID_POS);
 
     //if the unit is not directly next to its destination or it is and the destination is unblocked
-	if ((heuristic > 1.5) || (pUnit->canPass(destination.x, destination.y) == true)) {
+	if ((heuristic > FixPoint::fromFraction(3, 2)) || (pUnit->canPass(destination.x, destination.y) == true)) {
 
-        putOnOpenListIfBetter(start, Coord(INVALID_POS, INVALID_POS), 0.0, heuristic);
+        putOnOpenListIfBetter(start, AStarSearchWorkspace::NO_PARENT, 0, heuristic);
 
         std::vector<short> depthCheckCount(std::min(sizeX, sizeY));
 
@@ -51,8 +79,9 @@ AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord de
         while(openList.empty() == false) {
             Coord currentCoord = extractMin();
 
-            if (MapData(currentCoord).h < smallestHeuristic) {
-				smallestHeuristic = MapData(currentCoord).h;
+            FixPoint currentHeuristic = blockDistance(currentCoord, destination);
+            if (currentHeuristic < smallestHeuristic) {
+				smallestHeuristic = currentHeuristic;
 				bestCoord = currentCoord;
 
 				if(currentCoord == destination) {
@@ -66,53 +95,56 @@ AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord de
                 for (int angle=0; angle<=7; angle++) {
                     Coord nextCoord = pMap->getMapPos(angle, currentCoord);
                     if(pUnit->canPass(nextCoord.x, nextCoord.y)) {
-                        TerrainClass& nextTerrainTile = pMap->cell[nextCoord.x][nextCoord.y];
-                        float g = MapData(currentCoord).g;
+                        TerrainClass& nextTerrainTile = *pMap->getCell(nextCoord.x, nextCoord.y);
+                        FixPoint g = MapData(currentCoord).g;
 
                         if((nextCoord.x != currentCoord.x) && (nextCoord.y != currentCoord.y)) {
                             //add diagonal movement cost
-                            g += DIAGONALCOST*(pUnit->isAFlyingUnit() ? 1.0 : nextTerrainTile.getDifficulty());
+                            g += FIX_DIAGONALCOST*(pUnit->isAFlyingUnit() ? FixPoint(1) : nextTerrainTile.getDifficulty());
                         } else {
-                            g += (pUnit->isAFlyingUnit() ? 1.0 : nextTerrainTile.getDifficulty());
+                            g += (pUnit->isAFlyingUnit() ? FixPoint(1) : nextTerrainTile.getDifficulty());
                         }
 
                         if(pUnit->isAFlyingUnit()) {
                             int numDirectionChanges = abs((pUnit->getAngle() - angle)%NUM_ANGLES);
-                            double distanceFromStart = blockDistance(start, nextCoord);
+                            FixPoint distanceFromStart = blockDistance(start, nextCoord);
 
                             if(numDirectionChanges > 2) {
-                                if(distanceFromStart <= DIAGONALCOST) {
-                                    g += 3.0;
-                                } else  if(distanceFromStart <= 2*DIAGONALCOST) {
-                                    g += 2.0;
+                                if(distanceFromStart <= FIX_DIAGONALCOST) {
+                                    g += 3;
+                                } else  if(distanceFromStart <= 2*FIX_DIAGONALCOST) {
+                                    g += 2;
                                 }
                             } else if(numDirectionChanges > 1) {
-                                if(distanceFromStart <= DIAGONALCOST) {
-                                    g += 3.0;
-                                } else  if(distanceFromStart <= 2*DIAGONALCOST) {
-                                    g += 2.0;
+                                if(distanceFromStart <= FIX_DIAGONALCOST) {
+                                    g += 3;
+                                } else  if(distanceFromStart <= 2*FIX_DIAGONALCOST) {
+                                    g += 2;
                                 }
                             }
                         }
 
-                        if(MapData(currentCoord).parentCoord.x != INVALID_POS)	{
+                        if(MapData(currentCoord).parentAngle != AStarSearchWorkspace::NO_PARENT)	{
                         //add cost of turning time
-                            int posAngle = currentGameMap->getPosAngle(MapData(currentCoord).parentCoord, currentCoord);
-                            if (posAngle != angle)
-                                g += (1.0/currentGame->objectData.data[pUnit->getItemID()].turnspeed * (double)std::min(abs(angle - posAngle), NUM_ANGLES - std::max(angle, posAngle) + std::min(angle, posAngle)))/((double)BLOCKSIZE);
+                            int posAngle = currentGameMap->getPosAngle(getParentCoord(currentCoord), currentCoord);
+                            FixPoint turnSpeed = currentGame->objectData.data[pUnit->getItemID()].turnspeed;
+                            if ((posAngle != angle) && (turnSpeed > 0)) {
+                                int numTurns = std::min(abs(angle - posAngle), NUM_ANGLES - std::max(angle, posAngle) + std::min(angle, posAngle));
+                                g += FixPoint(numTurns) / (turnSpeed*BLOCKSIZE);
+                            }
                         }
 
-                        float h = blockDistance(nextCoord, destination);
+                        FixPoint h = blockDistance(nextCoord, destination);
 
-                        if(MapData(nextCoord).bClosed == false) {
-                            putOnOpenListIfBetter(nextCoord, currentCoord, g, h);
+                        if((MapData(nextCoord).flags & AStarSearchWorkspace::TILEFLAG_CLOSED) == 0) {
+                            putOnOpenListIfBetter(nextCoord, (angle + NUM_ANGLES/2) % NUM_ANGLES, g, h);
                         }
                     }
 
                 }
             }
 
-            if (MapData(currentCoord).bClosed == false) {
+            if ((MapData(currentCoord).flags & AStarSearchWorkspace::TILEFLAG_CLOSED) == 0) {
 
 				int depth = std::max(abs(currentCoord.x - destination.x), abs(currentCoord.y - destination.y));
 
@@ -161,7 +193,7 @@ AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord de
                     }
 				}
 
-                MapData(currentCoord).bClosed = true;
+                MapData(currentCoord).flags |= AStarSearchWorkspace::TILEFLAG_CLOSED;
                 numNodesChecked++;
             }
         }
@@ -172,6 +204,37 @@ AStarSearch::AStarSearch(MapClass* pMap, UnitClass* pUnit, Coord start, Coord de
 }
 
 AStarSearch::~AStarSearch() {
-    free(mapData);
+}
+
+std::list<Coord> AStarSearch::getFoundPath() {
+    std::list<Coord> path;
+
+    if(bestCoord.x == INVALID_POS || bestCoord.y == INVALID_POS) {
+        return path;
+    }
+
+    Coord currentCoord = bestCoord;
+    while(true) {
+        Coord nextCoord = getParentCoord(currentCoord);
+
+        if(nextCoord.x == INVALID_POS || nextCoord.y == INVALID_POS) {
+            break;
+        }
+
+        path.push_front(currentCoord);
+        currentCoord = nextCoord;
+    }
+
+    return path;
+}
+
+Coord AStarSearch::getParentCoord(const Coord& coord) const {
+    Uint8 parentAngle = MapData(coord).parentAngle;
+
+    if(parentAngle == AStarSearchWorkspace::NO_PARENT) {
+        return Coord(INVALID_POS, INVALID_POS);
+    }
+
+    return pMap->getMapPos(parentAngle, coord);
 }
 
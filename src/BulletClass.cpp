@@ -29,6 +29,8 @@
 #include <misc/draw_util.h>
 
 
+MemoryPool BulletClass::memoryPool;
+
 BulletClass::BulletClass(Uint32 shooterID, Coord* newRealLocation, Coord* newRealDestination, Uint32 bulletID, int damage, bool air)
 {
     airAttack = air;
@@ -55,33 +57,29 @@ BulletClass::BulletClass(Uint32 shooterID, Coord* newRealLocation, Coord* newRea
 		int diffX = destination.x - newRealLocation->x;
         int diffY = destination.y - newRealLocation->y;
 
-		double ratio;
-		double square_root;
-
 		int weaponrange = currentGame->objectData.data[Unit_SonicTank].weaponrange;
 
 		if((diffX == 0) && (diffY == 0)) {
 			diffY = weaponrange*BLOCKSIZE;
 		}
 
-		square_root = sqrt((double)(diffX*diffX + diffY*diffY));
-		ratio = (weaponrange*BLOCKSIZE)/square_root;
-		destination.x = newRealLocation->x + (int)(((double)diffX)*ratio);
-		destination.y = newRealLocation->y + (int)(((double)diffY)*ratio);
+		FixPoint ratio = FixPoint(weaponrange*BLOCKSIZE)/FixPoint::hypot(diffX, diffY);
+		destination.x = newRealLocation->x + (ratio*diffX).toInt();
+		destination.y = newRealLocation->y + (ratio*diffY).toInt();
 	}
 
-	realX = (double)newRealLocation->x;
-	realY = (double)newRealLocation->y;
+	realX = newRealLocation->x;
+	realY = newRealLocation->y;
 	source.x = newRealLocation->x;
 	source.y = newRealLocation->y;
 	location.x = newRealLocation->x/BLOCKSIZE;
 	location.y = newRealLocation->y/BLOCKSIZE;
 
 	angle = dest_angle(*newRealLocation, destination);
-	drawnAngle = (int)((double)numFrames*angle/256.0);
+	drawnAngle = (angle*numFrames/256).toInt();
 
-    xSpeed = speed * cos(angle * conv2char);
-	ySpeed = speed * -sin(angle * conv2char);
+    xSpeed = speed * FixPoint::cos(angle);
+	ySpeed = speed * -FixPoint::sin(angle);
 }
 
 BulletClass::BulletClass(Stream& stream)
@@ -105,14 +103,14 @@ BulletClass::BulletClass(Stream& stream)
 	destination.y = stream.readSint32();
     location.x = stream.readSint32();
 	location.y = stream.readSint32();
-	realX = stream.readDouble();
-	realY = stream.readDouble();
+	realX = stream.readFixPoint();
+	realY = stream.readFixPoint();
 
-    xSpeed = stream.readDouble();
-	ySpeed = stream.readDouble();
+    xSpeed = stream.readFixPoint();
+	ySpeed = stream.readFixPoint();
 
 	drawnAngle = stream.readSint8();
-    angle = stream.readDouble();
+    angle = stream.readFixPoint();
 
 	BulletClass::init();
 }
@@ -129,7 +127,7 @@ int BulletClass::init()
             damageRadius = 2;
             groundBlocked = true;
             inaccuracy = 2;
-            speed = 9.0;
+            speed = 9;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Small, houseID);
         } break;
@@ -138,7 +136,7 @@ int BulletClass::init()
             damageRadius = 2;
             groundBlocked = true;
             inaccuracy = 2;
-            speed = 9.0;
+            speed = 9;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Small, houseID);
         } break;
@@ -146,7 +144,7 @@ int BulletClass::init()
         case(Bullet_DRocket): {
             damageRadius = 16;
             inaccuracy = 16;
-            speed = 4.0;
+            speed = 4;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_MediumRocket, houseID);
         } break;
@@ -154,7 +152,7 @@ int BulletClass::init()
         case(Bullet_LargeRocket): {
             damageRadius = 16;
             inaccuracy = 0;
-            speed = 4.0;
+            speed = 4;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_LargeRocket, houseID);
         } break;
@@ -167,7 +165,7 @@ int BulletClass::init()
             } else {
                 inaccuracy = 8;
             }
-            speed = 5.0;
+            speed = 5;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_MediumRocket, houseID);
         } break;
@@ -176,7 +174,7 @@ int BulletClass::init()
             damageRadius = 3;
             groundBlocked = true;
             inaccuracy = 4;
-            speed = 9.0;
+            speed = 9;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Medium, houseID);
         } break;
@@ -184,7 +182,7 @@ int BulletClass::init()
         case(Bullet_SmallRocket): {
             damageRadius = 5;
             inaccuracy = 6;
-            speed = 4.0;
+            speed = 4;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_SmallRocket, houseID);
         } break;
@@ -192,7 +190,7 @@ int BulletClass::init()
         case(Bullet_SmallRocketHeavy): {
             damageRadius = 5;
             inaccuracy = 6;
-            speed = 4.0;
+            speed = 4;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_SmallRocket, houseID);
         } break;
@@ -200,7 +198,7 @@ int BulletClass::init()
         case(Bullet_Sonic): {
             damageRadius = 7;
             inaccuracy = 2;
-            speed = 2.0;
+            speed = 2;
             numFrames = 1;
             SDL_Surface* tmpSurface = pGFXManager->getObjPic(ObjPic_Bullet_Sonic, houseID);
             graphic =  copySurface(tmpSurface);	//make a copy of the image
@@ -228,6 +226,8 @@ int BulletClass::init()
 
 BulletClass::~BulletClass()
 {
+    bulletList.remove(this);
+
     if((bulletID == Bullet_Sonic) && (graphic != NULL)) {
         SDL_FreeSurface(graphic);
         graphic = NULL;
@@ -250,14 +250,14 @@ void BulletClass::save(Stream& stream) const
 	stream.writeSint32(destination.y);
     stream.writeSint32(location.x);
 	stream.writeSint32(location.y);
-	stream.writeDouble(realX);
-	stream.writeDouble(realY);
+	stream.writeFixPoint(realX);
+	stream.writeFixPoint(realY);
 
-    stream.writeDouble(xSpeed);
-	stream.writeDouble(ySpeed);
+    stream.writeFixPoint(xSpeed);
+	stream.writeFixPoint(ySpeed);
 
 	stream.writeSint8(drawnAngle);
-    stream.writeDouble(angle);
+    stream.writeFixPoint(angle);
 }
 
 
@@ -342,8 +342,8 @@ void BulletClass::update()
 
 	realX += xSpeed;  //keep the bullet moving by its current speeds
 	realY += ySpeed;
-	location.x = (short)(realX/BLOCKSIZE);
-	location.y = (short)(realY/BLOCKSIZE);
+	location.x = (realX/BLOCKSIZE).toInt();
+	location.y = (realY/BLOCKSIZE).toInt();
 
 	if((location.x < -5) || (location.x >= currentGameMap->sizeX + 5) || (location.y < -5) || (location.y >= currentGameMap->sizeY + 5)) {
         // it's off the screen => delete it
@@ -356,7 +356,7 @@ void BulletClass::update()
 			destroy();
 		} else if(bulletID == Bullet_Sonic) {
 			//if((location.x != oldLocation.x) || (location.y != oldLocation.y)) {
-				Coord realPos = Coord((short)realX, (short)realY);
+				Coord realPos = Coord(realX.toInt(), realY.toInt());
 				currentGameMap->damage(shooterID, owner, realPos, bulletID,
                                         (int) (((double)damage/2.0)/((double)currentGame->objectData.data[Unit_SonicTank].weaponrange)),
                                         damageRadius, false);
@@ -364,7 +364,7 @@ void BulletClass::update()
                 realX += xSpeed;  //keep the bullet moving by its current speeds
                 realY += ySpeed;
 
-				realPos = Coord((short)realX, (short)realY);
+				realPos = Coord(realX.toInt(), realY.toInt());
 				currentGameMap->damage(shooterID, owner, realPos, bulletID,
                                         (int) (((double)damage/2.0)/((double)currentGame->objectData.data[Unit_SonicTank].weaponrange)),
                                         damageRadius, false);
@@ -382,7 +382,7 @@ void BulletClass::update()
 
 void BulletClass::destroy()
 {
-    Coord position = Coord((short)realX, (short)realY);
+    Coord position = Coord(realX.toInt(), realY.toInt());
 
     int houseID = (owner == NULL) ? HOUSE_HARKONNEN : owner->getHouseID();
 
@@ -405,8 +405,8 @@ void BulletClass::destroy()
             for(int i = 0; i < 5; i++) {
                 for(int j = 0; j < 5; j++) {
                     if (((i != 0) && (i != 4)) || ((j != 0) && (j != 4))) {
-                        position.x = (short)realX + (i - 2)*BLOCKSIZE;
-                        position.y = (short)realY + (j - 2)*BLOCKSIZE;
+                        position.x = realX.toInt() + (i - 2)*BLOCKSIZE;
+                        position.y = realY.toInt() + (j - 2)*BLOCKSIZE;
 
                         currentGameMap->damage(shooterID, owner, position, bulletID, damage, damageRadius, airAttack);
 
@@ -0,0 +1,409 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ClusterGraph.h>
+
+#include <MapClass.h>
+#include <ObjectClass.h>
+
+/// Border segments shorter than this get one entrance in the middle, longer ones get one entrance at each end
+#define MAX_SINGLE_ENTRANCE_LENGTH  6
+
+ClusterGraph::ClusterGraph(MapClass* pMap) {
+    this->pMap = pMap;
+
+    numClustersX = (pMap->sizeX + CLUSTERSIZE - 1) / CLUSTERSIZE;
+    numClustersY = (pMap->sizeY + CLUSTERSIZE - 1) / CLUSTERSIZE;
+
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        graphs[i].bBuilt = false;
+        graphs[i].bDirty = false;
+    }
+
+    searchGeneration = 0;
+    SearchNode invalidNode = { 0, false, START_KEY, 0 };
+    searchNodes.assign(pMap->sizeX*pMap->sizeY - GOAL_KEY, invalidNode);
+}
+
+ClusterGraph::~ClusterGraph() {
+}
+
+void ClusterGraph::tileChanged(const Coord& pos) {
+    if(pMap->cellExists(pos) == false) {
+        return;
+    }
+
+    int clusterX = pos.x / CLUSTERSIZE;
+    int clusterY = pos.y / CLUSTERSIZE;
+    int localX = pos.x % CLUSTERSIZE;
+    int localY = pos.y % CLUSTERSIZE;
+
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        Graph& graph = graphs[i];
+        if(graph.bBuilt == false) {
+            continue;
+        }
+
+        graph.clusters[clusterY*numClustersX + clusterX].bDirty = true;
+
+        // the entrances on the borders are shared with the neighbouring clusters
+        if((localX == 0) && (clusterX > 0)) {
+            graph.clusters[clusterY*numClustersX + clusterX - 1].bDirty = true;
+        }
+        if((localX == CLUSTERSIZE-1) && (clusterX < numClustersX-1)) {
+            graph.clusters[clusterY*numClustersX + clusterX + 1].bDirty = true;
+        }
+        if((localY == 0) && (clusterY > 0)) {
+            graph.clusters[(clusterY-1)*numClustersX + clusterX].bDirty = true;
+        }
+        if((localY == CLUSTERSIZE-1) && (clusterY < numClustersY-1)) {
+            graph.clusters[(clusterY+1)*numClustersX + clusterX].bDirty = true;
+        }
+
+        graph.bDirty = true;
+    }
+}
+
+void ClusterGraph::invalidateAll() {
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        graphs[i].bBuilt = false;
+        graphs[i].bDirty = false;
+        graphs[i].clusters.clear();
+    }
+}
+
+bool ClusterGraph::isPassable(MOVEMENTCLASS movementClass, int x, int y) const {
+    if(pMap->cellExists(x, y) == false) {
+        return false;
+    }
+
+    TerrainClass* pTile = pMap->getCell(x, y);
+
+    if(movementClass == MOVEMENTCLASS_AIR) {
+        return true;
+    } else if(movementClass == MOVEMENTCLASS_SANDWORM) {
+        return !pTile->isRock();
+    }
+
+    if(pTile->hasANonInfantryGroundObject()) {
+        ObjectClass* pObject = pTile->getNonInfantryGroundObject();
+        if((pObject != NULL) && pObject->isAStructure()) {
+            return false;
+        }
+    }
+
+    if(movementClass == MOVEMENTCLASS_INFANTRY) {
+        return true;
+    } else {
+        return !pTile->isMountain();
+    }
+}
+
+Coord ClusterGraph::getNextWaypoint(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination) {
+    if((movementClass == MOVEMENTCLASS_AIR) || !pMap->cellExists(start) || !pMap->cellExists(destination)) {
+        return destination;
+    }
+
+    if((abs(start.x/CLUSTERSIZE - destination.x/CLUSTERSIZE) <= 1) && (abs(start.y/CLUSTERSIZE - destination.y/CLUSTERSIZE) <= 1)) {
+        // close enough for a normal search
+        return destination;
+    }
+
+    update(movementClass);
+    Graph& graph = getGraph(movementClass);
+
+    int startClusterIndex = getClusterIndex(start);
+    int destClusterIndex = getClusterIndex(destination);
+    const Cluster& startCluster = graph.clusters[startClusterIndex];
+
+    calculateDistances(movementClass, start, startDistances);
+    calculateDistances(movementClass, destination, destDistances);
+
+    beginSearch();
+
+    getSearchNode(START_KEY);
+    pushOpenList(blockDistance(start, destination), START_KEY);
+
+    while(openList.empty() == false) {
+        int currentKey = popOpenList().second;
+
+        SearchNode& currentNode = getSearchNode(currentKey);
+        if(currentNode.bClosed) {
+            continue;
+        }
+        currentNode.bClosed = true;
+
+        if(currentKey == GOAL_KEY) {
+            // walk back and find the first waypoint outside of the start cluster
+            path.clear();
+            for(int key = GOAL_KEY; key != START_KEY; key = getSearchNode(key).parent) {
+                path.push_back(key);
+            }
+
+            for(std::vector<int>::reverse_iterator iter = path.rbegin(); iter != path.rend(); ++iter) {
+                if(*iter == GOAL_KEY) {
+                    break;
+                }
+
+                Coord waypoint(*iter % pMap->sizeX, *iter / pMap->sizeX);
+                if(getClusterIndex(waypoint) != startClusterIndex) {
+                    return waypoint;
+                }
+            }
+
+            return destination;
+        }
+
+        FixPoint currentG = currentNode.g;
+
+        // collect all successors of the current node
+        successors.clear();
+        if(currentKey == START_KEY) {
+            for(size_t i = 0; i < startCluster.nodes.size(); i++) {
+                FixPoint distance = startDistances[getLocalIndex(startCluster.nodes[i].pos)];
+                if(distance >= 0) {
+                    successors.push_back(std::make_pair(startCluster.nodes[i].pos.y*pMap->sizeX + startCluster.nodes[i].pos.x, distance));
+                }
+            }
+        } else {
+            Coord currentPos(currentKey % pMap->sizeX, currentKey / pMap->sizeX);
+            int currentClusterIndex = getClusterIndex(currentPos);
+            const Cluster& currentCluster = graph.clusters[currentClusterIndex];
+
+            if(currentClusterIndex == destClusterIndex) {
+                FixPoint distance = destDistances[getLocalIndex(currentPos)];
+                if(distance >= 0) {
+                    successors.push_back(std::make_pair(GOAL_KEY, distance));
+                }
+            }
+
+            size_t numNodes = currentCluster.nodes.size();
+            for(size_t i = 0; i < numNodes; i++) {
+                if(currentCluster.nodes[i].pos != currentPos) {
+                    continue;
+                }
+
+                for(size_t j = 0; j < numNodes; j++) {
+                    FixPoint distance = currentCluster.distances[i*numNodes + j];
+                    if((i != j) && (distance >= 0)) {
+                        successors.push_back(std::make_pair(currentCluster.nodes[j].pos.y*pMap->sizeX + currentCluster.nodes[j].pos.x, distance));
+                    }
+                }
+
+                const std::vector<Coord>& partners = currentCluster.nodes[i].partners;
+                for(size_t j = 0; j < partners.size(); j++) {
+                    successors.push_back(std::make_pair(partners[j].y*pMap->sizeX + partners[j].x, pMap->getCell(partners[j])->getDifficulty()));
+                }
+                break;
+            }
+        }
+
+        for(size_t i = 0; i < successors.size(); i++) {
+            int key = successors[i].first;
+            FixPoint g = currentG + successors[i].second;
+
+            bool bNewNode = (searchNodes[key - GOAL_KEY].generation != searchGeneration);
+            SearchNode& node = getSearchNode(key);
+            if(bNewNode || ((node.bClosed == false) && (g < node.g))) {
+                node.g = g;
+                node.parent = currentKey;
+            } else {
+                continue;
+            }
+
+            FixPoint h = (key == GOAL_KEY) ? FixPoint(0) : blockDistance(Coord(key % pMap->sizeX, key / pMap->sizeX), destination);
+            pushOpenList(g + h, key);
+        }
+    }
+
+    // no abstract path found
+    return destination;
+}
+
+ClusterGraph::Graph& ClusterGraph::getGraph(MOVEMENTCLASS movementClass) {
+    // wheeled and tracked units can pass the same terrain
+    if(movementClass == MOVEMENTCLASS_WHEELED) {
+        movementClass = MOVEMENTCLASS_TRACKED;
+    }
+
+    return graphs[movementClass];
+}
+
+void ClusterGraph::update(MOVEMENTCLASS movementClass) {
+    Graph& graph = getGraph(movementClass);
+
+    if(graph.bBuilt == false) {
+        graph.clusters.resize(numClustersX*numClustersY);
+        for(size_t i = 0; i < graph.clusters.size(); i++) {
+            graph.clusters[i].bDirty = true;
+        }
+        graph.bBuilt = true;
+        graph.bDirty = true;
+    }
+
+    if(graph.bDirty == false) {
+        return;
+    }
+
+    for(int clusterY = 0; clusterY < numClustersY; clusterY++) {
+        for(int clusterX = 0; clusterX < numClustersX; clusterX++) {
+            if(graph.clusters[clusterY*numClustersX + clusterX].bDirty) {
+                rebuildCluster(movementClass, clusterX, clusterY);
+            }
+        }
+    }
+
+    graph.bDirty = false;
+}
+
+void ClusterGraph::rebuildCluster(MOVEMENTCLASS movementClass, int clusterX, int clusterY) {
+    Cluster& cluster = getGraph(movementClass).clusters[clusterY*numClustersX + clusterX];
+
+    int x = clusterX * CLUSTERSIZE;
+    int y = clusterY * CLUSTERSIZE;
+    int width = std::min((int) CLUSTERSIZE, pMap->sizeX - x);
+    int height = std::min((int) CLUSTERSIZE, pMap->sizeY - y);
+
+    cluster.nodes.clear();
+
+    if(clusterX > 0) {
+        addEntrances(movementClass, cluster, x, y, 0, 1, -1, 0, height);
+    }
+    if(clusterX < numClustersX-1) {
+        addEntrances(movementClass, cluster, x + width - 1, y, 0, 1, 1, 0, height);
+    }
+    if(clusterY > 0) {
+        addEntrances(movementClass, cluster, x, y, 1, 0, 0, -1, width);
+    }
+    if(clusterY < numClustersY-1) {
+        addEntrances(movementClass, cluster, x, y + height - 1, 1, 0, 0, 1, width);
+    }
+
+    size_t numNodes = cluster.nodes.size();
+    cluster.distances.assign(numNodes*numNodes, FixPoint(-1));
+
+    std::vector<FixPoint> distances;
+    for(size_t i = 0; i < numNodes; i++) {
+        calculateDistances(movementClass, cluster.nodes[i].pos, distances);
+        for(size_t j = 0; j < numNodes; j++) {
+            cluster.distances[i*numNodes + j] = distances[getLocalIndex(cluster.nodes[j].pos)];
+        }
+    }
+
+    cluster.bDirty = false;
+}
+
+void ClusterGraph::addEntrances(MOVEMENTCLASS movementClass, Cluster& cluster, int x, int y, int dx, int dy, int partnerDx, int partnerDy, int length) {
+    int segmentStart = -1;
+    for(int i = 0; i <= length; i++) {
+        bool bOpen = false;
+        if(i < length) {
+            int posX = x + i*dx;
+            int posY = y + i*dy;
+            bOpen = isPassable(movementClass, posX, posY) && isPassable(movementClass, posX + partnerDx, posY + partnerDy);
+        }
+
+        if(bOpen && (segmentStart < 0)) {
+            segmentStart = i;
+        } else if(!bOpen && (segmentStart >= 0)) {
+            int segmentLength = i - segmentStart;
+
+            std::vector<int> entrances;
+            if(segmentLength < MAX_SINGLE_ENTRANCE_LENGTH) {
+                entrances.push_back(segmentStart + segmentLength/2);
+            } else {
+                entrances.push_back(segmentStart);
+                entrances.push_back(i - 1);
+            }
+
+            for(size_t j = 0; j < entrances.size(); j++) {
+                Coord pos(x + entrances[j]*dx, y + entrances[j]*dy);
+                addNode(cluster, pos, Coord(pos.x + partnerDx, pos.y + partnerDy));
+            }
+
+            segmentStart = -1;
+        }
+    }
+}
+
+void ClusterGraph::addNode(Cluster& cluster, const Coord& pos, const Coord& partner) {
+    // a tile in the corner of a cluster may be an entrance to two clusters
+    for(size_t i = 0; i < cluster.nodes.size(); i++) {
+        if(cluster.nodes[i].pos == pos) {
+            cluster.nodes[i].partners.push_back(partner);
+            return;
+        }
+    }
+
+    ClusterNode node;
+    node.pos = pos;
+    node.partners.push_back(partner);
+    cluster.nodes.push_back(node);
+}
+
+void ClusterGraph::calculateDistances(MOVEMENTCLASS movementClass, const Coord& start, std::vector<FixPoint>& distances) {
+    distances.assign(CLUSTERSIZE*CLUSTERSIZE, FixPoint(-1));
+
+    int clusterIndex = getClusterIndex(start);
+
+    openList.clear();
+
+    distances[getLocalIndex(start)] = 0;
+    pushOpenList(0, start.y*pMap->sizeX + start.x);
+
+    while(openList.empty() == false) {
+        OpenListEntry entry = popOpenList();
+        FixPoint distance = entry.first;
+        Coord current(entry.second % pMap->sizeX, entry.second / pMap->sizeX);
+
+        if(distance > distances[getLocalIndex(current)]) {
+            // outdated entry
+            continue;
+        }
+
+        for(int angle = 0; angle < NUM_ANGLES; angle++) {
+            Coord next = pMap->getMapPos(angle, current);
+
+            if(!pMap->cellExists(next) || (getClusterIndex(next) != clusterIndex) || !isPassable(movementClass, next.x, next.y)) {
+                continue;
+            }
+
+            FixPoint nextDistance = distance + pMap->getCell(next)->getDifficulty();
+            if((next.x != current.x) && (next.y != current.y)) {
+                nextDistance = distance + FIX_DIAGONALCOST * pMap->getCell(next)->getDifficulty();
+            }
+
+            FixPoint& oldDistance = distances[getLocalIndex(next)];
+            if((oldDistance < 0) || (nextDistance < oldDistance)) {
+                oldDistance = nextDistance;
+                pushOpenList(nextDistance, next.y*pMap->sizeX + next.x);
+            }
+        }
+    }
+}
+
+void ClusterGraph::beginSearch() {
+    openList.clear();
+
+    searchGeneration++;
+    if(searchGeneration == 0) {
+        // generation counter wrapped around => invalidate all old search nodes
+        SearchNode invalidNode = { 0, false, START_KEY, 0 };
+        std::fill(searchNodes.begin(), searchNodes.end(), invalidNode);
+        searchGeneration = 1;
+    }
+}
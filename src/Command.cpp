@@ -36,32 +36,49 @@
 
 Command::Command(CMDTYPE id) {
 	CommandID = id;
+	numParameters = 0;
 }
 
 Command::Command(CMDTYPE id, Uint32 parameter1) {
 	CommandID = id;
-	Parameter.push_back(parameter1);
+	numParameters = 1;
+	Parameter[0] = parameter1;
 }
 
 Command::Command(CMDTYPE id, Uint32 parameter1, Uint32 parameter2) {
 	CommandID = id;
-	Parameter.push_back(parameter1);
-	Parameter.push_back(parameter2);
+	numParameters = 2;
+	Parameter[0] = parameter1;
+	Parameter[1] = parameter2;
 }
 
 Command::Command(CMDTYPE id, Uint32 parameter1, Uint32 parameter2, Uint32 parameter3) {
 	CommandID = id;
-	Parameter.push_back(parameter1);
-	Parameter.push_back(parameter2);
-	Parameter.push_back(parameter3);
+	numParameters = 3;
+	Parameter[0] = parameter1;
+	Parameter[1] = parameter2;
+	Parameter[2] = parameter3;
 }
 
 Command::Command(CMDTYPE id, Uint32 parameter1, Uint32 parameter2, Uint32 parameter3, Uint32 parameter4) {
 	CommandID = id;
-	Parameter.push_back(parameter1);
-	Parameter.push_back(parameter2);
-	Parameter.push_back(parameter3);
-	Parameter.push_back(parameter4);
+	numParameters = 4;
+	Parameter[0] = parameter1;
+	Parameter[1] = parameter2;
+	Parameter[2] = parameter3;
+	Parameter[3] = parameter4;
+}
+
+Command::Command(CMDTYPE id, Uint32 numParameters, const Uint32* parameters) {
+	if(numParameters > MAX_PARAMETERS) {
+		throw std::invalid_argument("Command::Command(): Too many parameters!");
+	}
+
+	CommandID = id;
+	this->numParameters = numParameters;
+	for(Uint32 i=0;i<numParameters;i++) {
+		Parameter[i] = parameters[i];
+	}
 }
 
 Command::Command(Uint8* data, Uint32 length) {
@@ -73,6 +90,10 @@ Command::Command(Uint8* data, Uint32 length) {
 		throw std::invalid_argument("Command::Command(): Command must be at least 4 bytes long!");
 	}
 
+	if((length-4)/4 > MAX_PARAMETERS) {
+		throw std::invalid_argument("Command::Command(): Too many parameters!");
+	}
+
 	CommandID = (CMDTYPE) *((Uint32*) data);
 
 	if(CommandID >= CMD_MAX) {
@@ -80,15 +101,22 @@ Command::Command(Uint8* data, Uint32 length) {
 	}
 
 	Uint32* pData = (Uint32*) (data+4);
-	for(Uint32 i=0;i<(length-4)/4;i++) {
-		Parameter.push_back(*pData);
-		*pData++;
+	numParameters = (length-4)/4;
+	for(Uint32 i=0;i<numParameters;i++) {
+		Parameter[i] = pData[i];
 	}
 }
 
 Command::Command(Stream& stream) {
 	CommandID = (CMDTYPE) stream.readUint32();
-	Parameter = stream.readUint32Vector();
+	numParameters = stream.readUint32();
+	if(numParameters > MAX_PARAMETERS) {
+		throw std::invalid_argument("Command::Command(): Too many parameters!");
+	}
+
+	for(Uint32 i=0;i<numParameters;i++) {
+		Parameter[i] = stream.readUint32();
+	}
 }
 
 Command::~Command() {
@@ -96,14 +124,17 @@ Command::~Command() {
 
 void Command::save(Stream& stream) const {
 	stream.writeUint32((Uint32) CommandID);
-	stream.writeUint32Vector(Parameter);
+	stream.writeUint32(numParameters);
+	for(Uint32 i=0;i<numParameters;i++) {
+		stream.writeUint32(Parameter[i]);
+	}
 	stream.flush();
 }
 
 void Command::executeCommand() const {
 	switch(CommandID) {
         case CMD_TEST_SYNC: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_TEST_SYNC needs 1 Parameters!");
 			}
 
@@ -129,7 +160,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_PLACE_STRUCTURE: {
-			if(Parameter.size() != 4) {
+			if(numParameters != 4) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_PLACE_STRUCTURE needs 4 Parameters!");
 			}
 			BuilderClass* pBuilder = dynamic_cast<BuilderClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -141,7 +172,7 @@ void Command::executeCommand() const {
 
 
 		case CMD_UNIT_MOVE2POS: {
-			if(Parameter.size() != 4) {
+			if(numParameters != 4) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_UNIT_MOVE2POS needs 4 Parameters!");
 			}
 			UnitClass* unit = dynamic_cast<UnitClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -149,7 +180,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_UNIT_MOVE2OBJECT: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_UNIT_MOVE2OBJECT needs 2 Parameters!");
 			}
 			UnitClass* unit = dynamic_cast<UnitClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -157,7 +188,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_UNIT_ATTACKPOS: {
-			if(Parameter.size() != 4) {
+			if(numParameters != 4) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_UNIT_ATTACKPOS needs 4 Parameters!");
 			}
 			UnitClass* unit = dynamic_cast<UnitClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -165,7 +196,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_UNIT_ATTACKOBJECT: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_UNIT_ATTACKOBJECT needs 2 Parameters!");
 			}
 			UnitClass* pUnit = dynamic_cast<UnitClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -173,7 +204,7 @@ void Command::executeCommand() const {
 		} break;
 
         case CMD_INFANTRY_CAPTURE: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_INFANTRY_CAPTURE needs 2 Parameters!");
 			}
 			InfantryClass* pInfantry = dynamic_cast<InfantryClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -181,7 +212,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_UNIT_SETMODE: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_UNIT_SETMODE needs 2 Parameter!");
 			}
 			UnitClass* pUnit = dynamic_cast<UnitClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -189,7 +220,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_CARRYALL_SETDEPLOYSTRUCTURE: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_CARRYALL_SETDEPLOYSTRUCTURE needs 2 Parameters!");
 			}
 			Carryall* pCarryall = dynamic_cast<Carryall*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -197,7 +228,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_DEVASTATOR_STARTDEVASTATE: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_DEVASTATOR_STARTDEVASTATE needs 1 Parameter!");
 			}
 			DevastatorClass* pDevastator = dynamic_cast<DevastatorClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -205,7 +236,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_MCV_DEPLOY: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_MCV_DEPLOY needs 1 Parameter!");
 			}
 			MCVClass* pMCV = dynamic_cast<MCVClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -213,7 +244,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_STRUCTURE_SETDEPLOYPOSITION: {
-			if(Parameter.size() != 3) {
+			if(numParameters != 3) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_STRUCTURE_SETDEPLOYPOSITION needs 3 Parameters!");
 			}
 			StructureClass* pStructure = dynamic_cast<StructureClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -221,7 +252,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_STRUCTURE_REPAIR: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_STRUCTURE_REPAIR needs 1 Parameter!");
 			}
 			StructureClass* pStructure = dynamic_cast<StructureClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -230,7 +261,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_BUILDER_UPGRADE: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_BUILDER_UPGRADE needs 1 Parameter!");
 			}
 			BuilderClass* pBuilder = dynamic_cast<BuilderClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -238,7 +269,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_BUILDER_PRODUCEITEM: {
-			if(Parameter.size() != 3) {
+			if(numParameters != 3) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_BUILDER_PRODUCEITEM needs 3 Parameter!");
 			}
 			BuilderClass* pBuilder = dynamic_cast<BuilderClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -246,7 +277,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_BUILDER_CANCELITEM: {
-			if(Parameter.size() != 3) {
+			if(numParameters != 3) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_BUILDER_CANCELITEM needs 3 Parameter!");
 			}
 			BuilderClass* pBuilder = dynamic_cast<BuilderClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -254,7 +285,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_BUILDER_SETONHOLD: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_BUILDER_SETONHOLD needs 2 Parameters!");
 			}
 			BuilderClass* pBuilder = dynamic_cast<BuilderClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -262,7 +293,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_PALACE_SPECIALWEAPON: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_PALACE_SPECIALWEAPON needs 1 Parameter!");
 			}
 			PalaceClass* palace = dynamic_cast<PalaceClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -270,7 +301,7 @@ void Command::executeCommand() const {
 		} break;
 
         case CMD_PALACE_DEATHHAND: {
-			if(Parameter.size() != 3) {
+			if(numParameters != 3) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_PALACE_DEATHHAND needs 3 Parameter!");
 			}
 			PalaceClass* palace = dynamic_cast<PalaceClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -279,7 +310,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_STARPORT_PLACEORDER: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_STARPORT_PLACEORDER needs 1 Parameter!");
 			}
 			StarPortClass* pStarport = dynamic_cast<StarPortClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -287,7 +318,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_STARPORT_CANCELORDER: {
-			if(Parameter.size() != 1) {
+			if(numParameters != 1) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_STARPORT_CANCELORDER needs 1 Parameter!");
 			}
 			StarPortClass* pStarport = dynamic_cast<StarPortClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -295,7 +326,7 @@ void Command::executeCommand() const {
 		} break;
 
 		case CMD_TURRET_ATTACKOBJECT: {
-			if(Parameter.size() != 2) {
+			if(numParameters != 2) {
 				throw std::invalid_argument("Command::executeCommand(): CMD_TURRET_ATTACKOBJECT needs 2 Parameters!");
 			}
 			TurretClass* pTurret = dynamic_cast<TurretClass*>(currentGame->getObjectManager().getObject(Parameter[0]));
@@ -21,9 +21,54 @@
 
 #include <Game.h>
 
+#include <stdexcept>
 
 
+
+/// The first four bytes of the saved commands. Older versions directly started with the game cycle of the first command.
+#define COMPACT_COMMANDS_TAG    0x32444D43      // "CMD2"
+#define SIZED_COMMANDS_TAG      0x33444D43      // "CMD3", the same as "CMD2" but with the length of the commands
+
+/**
+	Appends x to data with 7 bits per byte. The highest bit of every byte is set if another byte follows.
+	\param	data	the data to append to
+	\param	x		the value to append
+*/
+static inline void appendVarUint32(std::vector<Uint8>& data, Uint32 x) {
+	while(x >= 0x80) {
+		data.push_back((Uint8) (x | 0x80));
+		x >>= 7;
+	}
+	data.push_back((Uint8) x);
+}
+
+/**
+	Reads a value written by appendVarUint32().
+	\param	data	the data to read from
+	\param	pos		the position to read from; it is set to the position after the read value
+	\return	the read value
+*/
+static inline Uint32 readVarUint32(const std::vector<Uint8>& data, size_t& pos) {
+	Uint32 x = 0;
+	for(int shift = 0; shift < 35; shift += 7) {
+		if(pos >= data.size()) {
+			throw std::out_of_range("readVarUint32(): End of data reached!");
+		}
+
+		Uint8 byte = data[pos++];
+		x |= ((Uint32) (byte & 0x7F)) << shift;
+		if((byte & 0x80) == 0) {
+			return x;
+		}
+	}
+
+	throw std::invalid_argument("readVarUint32(): Invalid encoding!");
+}
+
 CommandManager::CommandManager() {
+	lastCycle = 0;
+	executePos = 0;
+	executeCycle = 0;
 	pStream = NULL;
 	bReadOnly = false;
 }
@@ -38,55 +83,129 @@ void CommandManager::addCommand(Command cmd) {
 	addCommand(cmd, CycleNumber);
 }
 
-void CommandManager::save(Stream& stream) const {
-	for(unsigned int i=0;i<timeslot.size();i++) {
-		const std::list<Command>& cmdlist = timeslot[i];
-		std::list<Command>::const_iterator iter;
-
-		for(iter = cmdlist.begin(); iter != cmdlist.end(); ++iter) {
-			stream.writeUint32(i);
-			iter->save(stream);
-		}
+void CommandManager::save(Stream& stream, bool bStoreLength) const {
+	if(bStoreLength == true) {
+		stream.writeUint32(SIZED_COMMANDS_TAG);
+		stream.writeUint32(commandData.size());
+	} else {
+		stream.writeUint32(COMPACT_COMMANDS_TAG);
+	}
+	if(commandData.empty() == false) {
+		stream.writeBytes(&commandData[0], commandData.size());
 	}
 }
 
 void CommandManager::load(Stream& stream) {
 	try {
-		while(1) {
-			Uint32 cycle = stream.readUint32();
-			addCommand(Command(stream), cycle);
+		Uint32 tag = stream.readUint32();
+
+		if((tag == COMPACT_COMMANDS_TAG) || (tag == SIZED_COMMANDS_TAG)) {
+			std::vector<Uint8> data;
+			if(tag == SIZED_COMMANDS_TAG) {
+				data.resize(stream.readUint32());
+				if(data.empty() == false) {
+					stream.readBytes(&data[0], data.size());
+				}
+			} else {
+				try {
+					while(1) {
+						data.push_back(stream.readUint8());
+					}
+				} catch (Stream::exception& e) {
+					;
+				}
+			}
+
+			// decode and add every command; a truncated last command is ignored
+			size_t pos = 0;
+			Uint32 cycle = 0;
+			while(pos < data.size()) {
+				Uint32 cycleDelta;
+				Command cmd = decodeCommand(data, pos, cycleDelta);
+				cycle += cycleDelta;
+				addCommand(cmd, cycle);
+			}
+		} else {
+			// the format of older versions: every command is preceded by its game cycle
+			Uint32 cycle = tag;
+			while(1) {
+				addCommand(Command(stream), cycle);
+				cycle = stream.readUint32();
+			}
 		}
 	} catch (Stream::exception& e) {
 		;
+	} catch (std::logic_error& e) {
+		fprintf(stderr,"CommandManager::load(): %s\n", e.what());
 	}
 }
 
 void CommandManager::addCommand(Command cmd, Uint32 CycleNumber) {
 	if(bReadOnly == false) {
 
-		if(CycleNumber >= timeslot.size()) {
-			timeslot.resize(CycleNumber+1);
+		if(CycleNumber < lastCycle) {
+			fprintf(stderr,"CommandManager::addCommand(): Cannot add a command for game cycle %d after a command for game cycle %d!\n", CycleNumber, lastCycle);
+			return;
 		}
 
-		timeslot[CycleNumber].push_back(cmd);
+		size_t startPos = commandData.size();
+		encodeCommand(cmd, CycleNumber);
 
 		if(pStream != NULL) {
-			pStream->writeUint32(CycleNumber);
-			cmd.save(*pStream);
+			pStream->writeBytes(&commandData[startPos], commandData.size() - startPos);
+			pStream->flush();
 		}
 	}
 }
 
-void CommandManager::executeCommands(Uint32 CycleNumber) const {
-	if(CycleNumber >= timeslot.size()) {
-		return;
-	}
+void CommandManager::executeCommands(Uint32 CycleNumber) {
+	// commands for earlier game cycles were added after these cycles were executed and are skipped
+	while(executePos < commandData.size()) {
+		size_t pos = executePos;
+		Uint32 cycleDelta;
+		Command cmd = decodeCommand(commandData, pos, cycleDelta);
 
-	const std::list<Command>& cmdlist = timeslot[CycleNumber];
-	std::list<Command>::const_iterator iter;
+		if(executeCycle + cycleDelta > CycleNumber) {
+			break;
+		}
+
+		executePos = pos;
+		executeCycle += cycleDelta;
+
+		if(executeCycle == CycleNumber) {
+			cmd.executeCommand();
+		}
+	}
+}
 
-	for(iter = cmdlist.begin(); iter != cmdlist.end(); ++iter) {
-		iter->executeCommand();
+void CommandManager::encodeCommand(const Command& cmd, Uint32 CycleNumber) {
+	appendVarUint32(commandData, CycleNumber - lastCycle);
+	commandData.push_back((Uint8) cmd.getCommandID());
+	commandData.push_back((Uint8) cmd.getNumParameters());
+	for(Uint32 i = 0; i < cmd.getNumParameters(); i++) {
+		appendVarUint32(commandData, cmd.getParameter(i));
 	}
+
+	lastCycle = CycleNumber;
 }
 
+Command CommandManager::decodeCommand(const std::vector<Uint8>& data, size_t& pos, Uint32& cycleDelta) {
+	cycleDelta = readVarUint32(data, pos);
+
+	if(pos + 2 > data.size()) {
+		throw std::out_of_range("CommandManager::decodeCommand(): End of data reached!");
+	}
+
+	CMDTYPE id = (CMDTYPE) data[pos++];
+	Uint32 numParameters = data[pos++];
+	if((id >= CMD_MAX) || (numParameters > Command::MAX_PARAMETERS)) {
+		throw std::invalid_argument("CommandManager::decodeCommand(): Invalid command!");
+	}
+
+	Uint32 parameters[Command::MAX_PARAMETERS];
+	for(Uint32 i = 0; i < numParameters; i++) {
+		parameters[i] = readVarUint32(data, pos);
+	}
+
+	return Command(id, numParameters, parameters);
+}
@@ -25,6 +25,8 @@
 
 #define CYCLES_PER_FRAME    5
 
+MemoryPool Explosion::memoryPool;
+
 Explosion::Explosion()
  : explosionID(NONE), house(HOUSE_HARKONNEN)
 {
@@ -57,7 +59,7 @@ Explosion::Explosion(Stream& stream)
 
 Explosion::~Explosion()
 {
-
+    currentGame->getExplosionList().remove(this);
 }
 
 void Explosion::init()
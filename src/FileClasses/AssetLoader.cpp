@@ -0,0 +1,254 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/AssetLoader.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/// More threads do not help as the data files are read from the same disk
+#define MAX_WORKER_THREADS	8
+
+AssetLoader::ProgressCallback AssetLoader::pProgressCallback = NULL;
+bool AssetLoader::bBenchmark = false;
+
+AssetLoader::AssetLoader(const std::string& stage)
+ : stage(stage), wallTime(0), numThreads(0), bQuit(false) {
+	pMutex = SDL_CreateMutex();
+	pWorkAvailable = SDL_CreateCond();
+	pTaskDecoded = SDL_CreateCond();
+	if((pMutex == NULL) || (pWorkAvailable == NULL) || (pTaskDecoded == NULL)) {
+		throw std::runtime_error("AssetLoader::AssetLoader(): Cannot create mutex!");
+	}
+}
+
+AssetLoader::~AssetLoader() {
+	std::vector<TaskEntry>::iterator iter;
+	for(iter = tasks.begin(); iter != tasks.end(); ++iter) {
+		delete iter->pTask;
+	}
+
+	SDL_DestroyCond(pTaskDecoded);
+	SDL_DestroyCond(pWorkAvailable);
+	SDL_DestroyMutex(pMutex);
+}
+
+int AssetLoader::addTask(Task* pTask) {
+	return addTask(pTask, std::vector<int>());
+}
+
+int AssetLoader::addTask(Task* pTask, const std::vector<int>& dependencies) {
+	int id = tasks.size();
+
+	TaskEntry entry;
+	entry.pTask = pTask;
+	entry.numOpenDependencies = 0;
+	entry.decodeTime = 0;
+	tasks.push_back(entry);
+
+	// dependencies must be added before, so there can be no cycles
+	std::vector<int>::const_iterator iter;
+	for(iter = dependencies.begin(); iter != dependencies.end(); ++iter) {
+		if((*iter < 0) || (*iter >= id)) {
+			throw std::invalid_argument("AssetLoader::addTask(): Invalid dependency for " + pTask->getName() + "!");
+		}
+		tasks[*iter].dependents.push_back(id);
+		tasks[id].numOpenDependencies++;
+	}
+
+	return id;
+}
+
+void AssetLoader::run() {
+	Uint32 startTime = SDL_GetTicks();
+	int numTasks = tasks.size();
+
+	bQuit = false;
+	readyTasks.clear();
+	decodedTasks.clear();
+	for(int i = 0; i < numTasks; i++) {
+		if(tasks[i].numOpenDependencies == 0) {
+			readyTasks.push_back(i);
+		}
+	}
+
+	std::vector<SDL_Thread*> threads;
+	int maxThreads = std::min(getNumProcessors(), numTasks);
+	for(int i = 0; i < maxThreads; i++) {
+		SDL_Thread* pThread = SDL_CreateThread(workerMain, this);
+		if(pThread == NULL) {
+			fprintf(stderr,"AssetLoader::run(): Cannot create worker thread: %s\n", SDL_GetError());
+			break;
+		}
+		threads.push_back(pThread);
+	}
+	numThreads = threads.size();
+
+	std::string error;
+	int numFinished = 0;
+
+	SDL_LockMutex(pMutex);
+	while((numFinished < numTasks) && error.empty()) {
+		if(decodedTasks.empty()) {
+			if(threads.empty()) {
+				// no worker threads => decode on this thread
+				int id = readyTasks.front();
+				readyTasks.pop_front();
+				SDL_UnlockMutex(pMutex);
+				decodeTask(id);
+				SDL_LockMutex(pMutex);
+				decodedTasks.push_back(id);
+			} else {
+				SDL_CondWait(pTaskDecoded, pMutex);
+			}
+			continue;
+		}
+
+		int id = decodedTasks.front();
+		decodedTasks.pop_front();
+
+		if(tasks[id].error.empty() == false) {
+			error = tasks[id].error;
+			break;
+		}
+
+		SDL_UnlockMutex(pMutex);
+		try {
+			tasks[id].pTask->finish();
+		} catch(std::exception& e) {
+			error = "Cannot load " + tasks[id].pTask->getName() + ": " + e.what();
+		}
+
+		if(error.empty() && (pProgressCallback != NULL)) {
+			pProgressCallback(stage, numFinished + 1, numTasks);
+		}
+		SDL_LockMutex(pMutex);
+
+		if(error.empty() == false) {
+			break;
+		}
+		numFinished++;
+
+		std::vector<int>::const_iterator iter;
+		for(iter = tasks[id].dependents.begin(); iter != tasks[id].dependents.end(); ++iter) {
+			if(--tasks[*iter].numOpenDependencies == 0) {
+				readyTasks.push_back(*iter);
+				SDL_CondSignal(pWorkAvailable);
+			}
+		}
+	}
+
+	bQuit = true;
+	SDL_CondBroadcast(pWorkAvailable);
+	SDL_UnlockMutex(pMutex);
+
+	std::vector<SDL_Thread*>::const_iterator iter;
+	for(iter = threads.begin(); iter != threads.end(); ++iter) {
+		SDL_WaitThread(*iter, NULL);
+	}
+
+	wallTime = SDL_GetTicks() - startTime;
+
+	if(error.empty() == false) {
+		throw std::runtime_error(error);
+	}
+
+	if(bBenchmark == true) {
+		printStatistics(stdout);
+	}
+}
+
+void AssetLoader::printStatistics(FILE* pFile) const {
+	std::vector< std::pair<Uint32, std::string> > times;
+	Uint32 totalDecodeTime = 0;
+	std::vector<TaskEntry>::const_iterator iter;
+	for(iter = tasks.begin(); iter != tasks.end(); ++iter) {
+		times.push_back(std::make_pair(iter->decodeTime, iter->pTask->getName()));
+		totalDecodeTime += iter->decodeTime;
+	}
+
+	std::sort(times.begin(), times.end());
+
+	fprintf(pFile, "\nDecoding %s:\n", stage.c_str());
+	std::vector< std::pair<Uint32, std::string> >::const_reverse_iterator timeIter;
+	for(timeIter = times.rbegin(); timeIter != times.rend(); ++timeIter) {
+		fprintf(pFile, "%8u ms  %s\n", timeIter->first, timeIter->second.c_str());
+	}
+
+	fprintf(pFile, "%d assets decoded in %u ms on %d threads (%u ms decode time in total)\n\n",
+			(int) tasks.size(), wallTime, numThreads, totalDecodeTime);
+}
+
+void AssetLoader::decodeTask(int id) {
+	TaskEntry& entry = tasks[id];
+
+	Uint32 startTime = SDL_GetTicks();
+	try {
+		entry.pTask->decode();
+	} catch(std::exception& e) {
+		entry.error = "Cannot load " + entry.pTask->getName() + ": " + e.what();
+	}
+	entry.decodeTime = SDL_GetTicks() - startTime;
+}
+
+int AssetLoader::workerMain(void* pData) {
+	AssetLoader* pLoader = (AssetLoader*) pData;
+
+	SDL_LockMutex(pLoader->pMutex);
+	while(true) {
+		while(pLoader->readyTasks.empty() && (pLoader->bQuit == false)) {
+			SDL_CondWait(pLoader->pWorkAvailable, pLoader->pMutex);
+		}
+
+		if(pLoader->bQuit == true) {
+			break;
+		}
+
+		int id = pLoader->readyTasks.front();
+		pLoader->readyTasks.pop_front();
+		SDL_UnlockMutex(pLoader->pMutex);
+
+		pLoader->decodeTask(id);
+
+		SDL_LockMutex(pLoader->pMutex);
+		pLoader->decodedTasks.push_back(id);
+		SDL_CondSignal(pLoader->pTaskDecoded);
+	}
+	SDL_UnlockMutex(pLoader->pMutex);
+
+	return 0;
+}
+
+int AssetLoader::getNumProcessors() {
+	int numProcessors = 1;
+
+#ifdef _WIN32
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	numProcessors = systemInfo.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+	numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+	return std::max(1, std::min(numProcessors, MAX_WORKER_THREADS));
+}
@@ -78,8 +78,8 @@ SDL_Surface * LoadCPS_RW(SDL_RWops* RWop, int freesrc)
             throw std::runtime_error("LoadCPS_RW(): Decoding this *.cps-File failed!");
         }
 
-        // create new picture surface
-        if((pic = SDL_CreateRGBSurface(SDL_HWSURFACE,SIZE_X,SIZE_Y,8,0,0,0,0))== NULL) {
+        // create new picture surface (this is called on the threads of the AssetLoader)
+        if((pic = SDL_CreateRGBSurface(SDL_SWSURFACE,SIZE_X,SIZE_Y,8,0,0,0,0))== NULL) {
             throw std::runtime_error("LoadCPS_RW(): SDL_CreateRGBSurface has failed!");
         }
 
@@ -24,6 +24,7 @@
 #include <config.h>
 #include <misc/fnkdat.h>
 #include <misc/md5.h>
+#include <misc/string_util.h>
 
 #include <algorithm>
 #include <stdexcept>
@@ -46,8 +47,10 @@ FileManager::FileManager(bool saveMode) {
             std::string filepath = *searchPathIter + "/" + *filenameIter;
             if(GetCaseInsensitiveFilename(filepath) == true) {
                 try {
-                    fprintf(stderr,"%s  %s\n", md5FromFilename(filepath).c_str(), filepath.c_str());
+                    std::string md5 = md5FromFilename(filepath);
+                    fprintf(stderr,"%s  %s\n", md5.c_str(), filepath.c_str());
                     PakFiles.push_back(new Pakfile(filepath));
+                    dataChecksum += md5 + " " + *filenameIter + ";";
                 } catch (std::exception &e) {
                     if(saveMode == false) {
                         while(PakFiles.empty()) {
@@ -67,6 +70,8 @@ FileManager::FileManager(bool saveMode) {
     }
 
     fprintf(stderr,"\n");
+
+    buildIndex();
 }
 
 FileManager::~FileManager() {
@@ -154,57 +159,104 @@ std::vector<std::string> FileManager::getMissingFiles(int Language) {
 }
 
 SDL_RWops* FileManager::OpenFile(std::string Filename) {
-	SDL_RWops* ret;
-
-    // try loading external file
-    std::vector<std::string> searchPath = getSearchPath();
-    std::vector<std::string>::const_iterator searchPathIter;
-    for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
-
-        std::string externalFilename = *searchPathIter + "/" + Filename;
-        if(GetCaseInsensitiveFilename(externalFilename) == true) {
-            if((ret = SDL_RWFromFile(externalFilename.c_str(), "rb")) != NULL) {
-                return ret;
-            }
+    FileLocation location;
+    if(findFile(Filename, location) == true) {
+        SDL_RWops* ret;
+        if(location.pPakfile != NULL) {
+            ret = location.pPakfile->OpenFile(location.pakIndex);
+        } else {
+            ret = SDL_RWFromFile(location.externalPath.c_str(), "rb");
         }
-    }
 
-    // now try loading from pak file
-    std::vector<Pakfile*>::const_iterator iter;
-    for(iter = PakFiles.begin(); iter != PakFiles.end(); ++iter) {
-        ret = (*iter)->OpenFile(Filename);
-		if(ret != NULL) {
-			return ret;
-		}
+        if(ret != NULL) {
+            return ret;
+        }
     }
 
     throw std::runtime_error("FileManager::OpenFile(): Cannot find " + Filename + "!");
 }
 
 bool FileManager::exists(std::string Filename) {
+    FileLocation location;
+    return findFile(Filename, location);
+}
+
+/**
+    Adds all files in the search paths and all files in the PAK-Files to the file index. If a filename occurs
+    more than once the first one is used (files in the search paths first, then the PAK-Files in the order they were opened).
+*/
+void FileManager::buildIndex() {
+    fileIndex.clear();
 
-    // try finding external file
     std::vector<std::string> searchPath = getSearchPath();
     std::vector<std::string>::const_iterator searchPathIter;
     for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
-
-        std::string externalFilename = *searchPathIter + "/" + Filename;
-        if(GetCaseInsensitiveFilename(externalFilename) == true) {
-            return true;
+        std::list<std::string> entries = GetDirectoryEntries(*searchPathIter);
+
+        std::list<std::string>::const_iterator entryIter;
+        for(entryIter = entries.begin(); entryIter != entries.end(); ++entryIter) {
+            FileLocation location;
+            location.externalPath = *searchPathIter + "/" + *entryIter;
+            location.pPakfile = NULL;
+            location.pakIndex = 0;
+            fileIndex.insert(std::make_pair(getIndexKey(*entryIter), location));
         }
     }
 
-    // now try finding in one pak file
     std::vector<Pakfile*>::const_iterator iter;
     for(iter = PakFiles.begin(); iter != PakFiles.end(); ++iter) {
-        if((*iter)->exists(Filename) == true) {
-            return true;
+        for(int i = 0; i < (*iter)->GetNumFiles(); i++) {
+            FileLocation location;
+            location.pPakfile = *iter;
+            location.pakIndex = i;
+            fileIndex.insert(std::make_pair(getIndexKey((*iter)->GetFilename(i)), location));
         }
     }
+}
 
-    return false;
+/**
+    Searches a file in the file index.
+    \param  Filename    the name of the file (case insensitive)
+    \param  location    the location of the file is stored here
+    \return true if the file was found, false otherwise
+*/
+bool FileManager::findFile(const std::string& Filename, FileLocation& location) const {
+    if(Filename.find('/') != std::string::npos) {
+        // the index only contains the top level of the search paths
+        std::vector<std::string> searchPath = getSearchPath();
+        std::vector<std::string>::const_iterator searchPathIter;
+        for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
+
+            std::string externalFilename = *searchPathIter + "/" + Filename;
+            if(GetCaseInsensitiveFilename(externalFilename) == true) {
+                location.externalPath = externalFilename;
+                location.pPakfile = NULL;
+                location.pakIndex = 0;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::unordered_map<std::string, FileLocation>::const_iterator iter = fileIndex.find(getIndexKey(Filename));
+    if(iter == fileIndex.end()) {
+        return false;
+    }
+
+    location = iter->second;
+    return true;
 }
 
+/**
+    Returns the key of Filename in the file index.
+    \param  Filename    the name of the file
+    \return the key for the file index
+*/
+std::string FileManager::getIndexKey(std::string Filename) {
+    convertToUpper(Filename);
+    return Filename;
+}
 
 std::string FileManager::md5FromFilename(std::string filename) {
 	unsigned char md5sum[16];
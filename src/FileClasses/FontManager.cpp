@@ -24,6 +24,8 @@
 #include <FileClasses/PictureFont.h>
 
 #include <list>
+#include <algorithm>
+#include <stdexcept>
 
 FontManager::FontManager() {
 	Fonts[FONT_STD10] = std::shared_ptr<Font>(new PictureFont(SDL_LoadBMP_RW(pFileManager->OpenFile("Font10.bmp"),true), true));
@@ -32,6 +34,13 @@ FontManager::FontManager() {
 }
 
 FontManager::~FontManager() {
+	for(std::map<int, GlyphAtlas>::iterator iter = glyphAtlases.begin(); iter != glyphAtlases.end(); ++iter) {
+		SDL_FreeSurface(iter->second.pSurface);
+	}
+
+	for(TextCacheList::iterator iter = textCache.begin(); iter != textCache.end(); ++iter) {
+		SDL_FreeSurface(iter->second);
+	}
 }
 
 void FontManager::DrawTextOnSurface(SDL_Surface* pSurface, std::string text, unsigned char color, unsigned int FontNum) {
@@ -76,7 +85,7 @@ SDL_Surface* FontManager::createSurfaceWithText(std::string text, unsigned char
     palette.applyToSurface(pic);
     SDL_SetColorKey(pic, SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
 
-    Fonts[FontNum]->DrawTextOnSurface(pic,text,color);
+    drawText(pic, text, color, FontNum, 0, 0);
 
     return pic;
 }
@@ -113,18 +122,135 @@ SDL_Surface* FontManager::createSurfaceWithMultilineText(std::string text, unsig
     palette.applyToSurface(pic);
     SDL_SetColorKey(pic, SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
 
-    SDL_Rect dest = { 0,0,0,lineHeight};
+    int y = 0;
     std::list<std::string>::iterator iter;
-    for(iter = TextLines.begin(); iter != TextLines.end(); ++iter, dest.y += lineHeight) {
-        SDL_Surface* tmpSurface = createSurfaceWithText(*iter, color, FontNum);
+    for(iter = TextLines.begin(); iter != TextLines.end(); ++iter, y += lineHeight) {
+        int x = (bCentered == false) ? 0 : (width - Fonts[FontNum]->getTextWidth(*iter))/2;
+        drawText(pic, *iter, color, FontNum, x, y);
+    }
+
+    return pic;
+}
 
-        dest.w = tmpSurface->w;
-        dest.x = (bCentered == false) ? 0 : (width - dest.w)/2;
+void FontManager::drawText(SDL_Surface* pSurface, const std::string& text, unsigned char color, unsigned int FontNum, int x, int y) {
+	if(FontNum >= NUM_FONTS) {
+		return;
+	}
 
-        SDL_BlitSurface(tmpSurface,NULL,pic,&dest);
+	const GlyphAtlas& atlas = getGlyphAtlas(color, FontNum);
 
-        SDL_FreeSurface(tmpSurface);
-    }
+	SDL_Rect src = { 0, 0, 0, atlas.pSurface->h };
+	const unsigned char* pText = (const unsigned char*) text.c_str();
+	while(*pText != '\0') {
+		int index = *pText;
+		src.x = atlas.glyphX[index];
+		src.w = atlas.glyphX[index+1] - atlas.glyphX[index];
 
-    return pic;
+		if(src.w > 0) {
+			// SDL_BlitSurface() clips dest, so it has to be set for every character
+			SDL_Rect dest = { x, y, src.w, src.h };
+			SDL_BlitSurface(atlas.pSurface, &src, pSurface, &dest);
+		}
+
+		x += src.w;
+		pText++;
+	}
+}
+
+SDL_Surface* FontManager::getCachedSurfaceWithText(const std::string& text, unsigned char color, unsigned int FontNum) {
+	TextKey key;
+	key.text = text;
+	key.FontNum = FontNum;
+	key.color = color;
+	key.bMultiline = false;
+	key.bCentered = false;
+
+	return getCachedSurface(key);
+}
+
+SDL_Surface* FontManager::getCachedSurfaceWithMultilineText(const std::string& text, unsigned char color, unsigned int FontNum, bool bCentered) {
+	TextKey key;
+	key.text = text;
+	key.FontNum = FontNum;
+	key.color = color;
+	key.bMultiline = true;
+	key.bCentered = bCentered;
+
+	return getCachedSurface(key);
+}
+
+bool FontManager::TextKey::operator<(const TextKey& other) const {
+	if(FontNum != other.FontNum) {
+		return FontNum < other.FontNum;
+	} else if(color != other.color) {
+		return color < other.color;
+	} else if(bMultiline != other.bMultiline) {
+		return bMultiline < other.bMultiline;
+	} else if(bCentered != other.bCentered) {
+		return bCentered < other.bCentered;
+	} else {
+		return text < other.text;
+	}
+}
+
+const FontManager::GlyphAtlas& FontManager::getGlyphAtlas(unsigned char color, unsigned int FontNum) {
+	int atlasKey = FontNum*256 + color;
+	std::map<int, GlyphAtlas>::iterator iter = glyphAtlases.find(atlasKey);
+	if(iter != glyphAtlases.end()) {
+		return iter->second;
+	}
+
+	// character 0 ends every string, so it is never drawn and gets no space on the atlas
+	GlyphAtlas atlas;
+	std::string allCharacters;
+	atlas.glyphX[0] = 0;
+	atlas.glyphX[1] = 0;
+	for(int i = 1; i < 256; i++) {
+		std::string character(1, (char) i);
+		atlas.glyphX[i+1] = atlas.glyphX[i] + Fonts[FontNum]->getTextWidth(character);
+		allCharacters += character;
+	}
+
+	int width = std::max(atlas.glyphX[256], 1);
+	int height = std::max(Fonts[FontNum]->getTextHeight(), 1);
+	if((atlas.pSurface = SDL_CreateRGBSurface(SDL_SWSURFACE,width,height,8,0,0,0,0)) == NULL) {
+		throw std::runtime_error("FontManager::getGlyphAtlas(): Cannot create surface!");
+	}
+
+	palette.applyToSurface(atlas.pSurface);
+	SDL_SetColorKey(atlas.pSurface, SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+	Fonts[FontNum]->DrawTextOnSurface(atlas.pSurface,allCharacters,color);
+
+	return glyphAtlases.insert(std::make_pair(atlasKey, atlas)).first->second;
+}
+
+SDL_Surface* FontManager::getCachedSurface(const TextKey& key) {
+	if(key.FontNum >= NUM_FONTS) {
+		return NULL;
+	}
+
+	std::map<TextKey, TextCacheList::iterator>::iterator indexIter = textCacheIndex.find(key);
+	if(indexIter != textCacheIndex.end()) {
+		// move to the front as it is the most recently used text now
+		textCache.splice(textCache.begin(), textCache, indexIter->second);
+		return indexIter->second->second;
+	}
+
+	SDL_Surface* pSurface = key.bMultiline ? createSurfaceWithMultilineText(key.text, key.color, key.FontNum, key.bCentered)
+                                           : createSurfaceWithText(key.text, key.color, key.FontNum);
+	if(pSurface == NULL) {
+		return NULL;
+	}
+
+	textCache.push_front(std::make_pair(key, pSurface));
+	textCacheIndex[key] = textCache.begin();
+
+	if(textCacheIndex.size() > TEXTCACHESIZE) {
+		SDL_FreeSurface(textCache.back().second);
+		textCacheIndex.erase(textCache.back().first);
+		textCache.pop_back();
+	}
+
+	return pSurface;
 }
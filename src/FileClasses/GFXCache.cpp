@@ -0,0 +1,311 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/GFXCache.h>
+
+#include <SDL_endian.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define GFXCACHE_MAGIC		0x43584647	// "GFXC"
+#define GFXCACHE_VERSION	1			// increase this whenever the format or the content of the cache changes
+
+/// Everything in the cache file is aligned to 4 bytes
+static inline Uint32 align4(Uint32 size) {
+	return (size + 3) & ~3;
+}
+
+GFXCache::GFXCache(std::string filename, std::string key)
+ : filename(filename), key(key), pData(NULL), dataSize(0), readPos(0), bMapped(false), pWriteFile(NULL) {
+}
+
+GFXCache::~GFXCache() {
+	if(pWriteFile != NULL) {
+		finishWriting(false);
+	}
+
+	if(pData != NULL) {
+#ifndef _WIN32
+		if(bMapped == true) {
+			munmap(pData, dataSize);
+		} else {
+			free(pData);
+		}
+#else
+		free(pData);
+#endif
+	}
+}
+
+bool GFXCache::openForReading() {
+#ifndef _WIN32
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return false;
+	}
+
+	struct stat fileStat;
+	if((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+		// the pages are only copied if a surface is modified (e.g. the windtrap color animation)
+		void* pMapping = mmap(NULL, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if(pMapping != MAP_FAILED) {
+			pData = (char*) pMapping;
+			dataSize = fileStat.st_size;
+			bMapped = true;
+		}
+	}
+
+	close(fd);
+#else
+	SDL_RWops* pFile = SDL_RWFromFile(filename.c_str(), "rb");
+	if(pFile == NULL) {
+		return false;
+	}
+
+	int size = SDL_RWseek(pFile, 0, SEEK_END);
+	SDL_RWseek(pFile, 0, SEEK_SET);
+	if((size > 0) && ((pData = (char*) malloc(size)) != NULL)) {
+		if(SDL_RWread(pFile, pData, size, 1) == 1) {
+			dataSize = size;
+		} else {
+			free(pData);
+			pData = NULL;
+		}
+	}
+
+	SDL_RWclose(pFile);
+#endif
+
+	if(pData == NULL) {
+		return false;
+	}
+
+	try {
+		if((readUint32() != GFXCACHE_MAGIC) || (readUint32() != GFXCACHE_VERSION)) {
+			return false;
+		}
+
+		Uint32 keyLength = readUint32();
+		const char* pKey = readBytes(keyLength);
+		return (std::string(pKey, keyLength) == key);
+	} catch(std::exception&) {
+		return false;
+	}
+}
+
+SDL_Surface* GFXCache::readSurface() {
+	if(readUint32() == 0) {
+		return NULL;
+	}
+
+	Uint32 w = readUint32();
+	Uint32 h = readUint32();
+	Uint32 colorKeyFlags = readUint32();
+	Uint32 colorKey = readUint32();
+	Uint32 numColors = readUint32();
+
+	if(numColors > 256) {
+		throw std::runtime_error("GFXCache::readSurface(): Invalid palette!");
+	}
+
+	const char* pColors = readBytes(numColors*4);
+	Uint32 pitch = align4(w);
+	char* pPixels = (char*) readBytes(pitch*h);
+
+	SDL_Surface* pSurface = SDL_CreateRGBSurfaceFrom(pPixels, w, h, 8, pitch, 0, 0, 0, 0);
+	if(pSurface == NULL) {
+		throw std::runtime_error("GFXCache::readSurface(): Cannot create surface!");
+	}
+
+	SDL_Color colors[256];
+	for(Uint32 i = 0; i < numColors; i++) {
+		colors[i].r = pColors[4*i];
+		colors[i].g = pColors[4*i + 1];
+		colors[i].b = pColors[4*i + 2];
+		colors[i].unused = 0;
+	}
+	SDL_SetColors(pSurface, colors, 0, numColors);
+
+	if(colorKeyFlags & SDL_SRCCOLORKEY) {
+		SDL_SetColorKey(pSurface, SDL_SRCCOLORKEY | ((colorKeyFlags & SDL_RLEACCELOK) ? SDL_RLEACCEL : 0), colorKey);
+	}
+
+	return pSurface;
+}
+
+Animation* GFXCache::readAnimation() {
+	if(readUint32() == 0) {
+		return NULL;
+	}
+
+	Uint32 numFrames = readUint32();
+	Uint32 frameDurationTime = readUint32();
+
+	Animation* pAnimation = new Animation();
+	pAnimation->setFrameDurationTime(frameDurationTime);
+
+	try {
+		for(Uint32 i = 0; i < numFrames; i++) {
+			SDL_Surface* pFrame = readSurface();
+			if(pFrame == NULL) {
+				throw std::runtime_error("GFXCache::readAnimation(): Missing animation frame!");
+			}
+			pAnimation->addFrame(pFrame);
+		}
+	} catch(std::exception&) {
+		delete pAnimation;
+		throw;
+	}
+
+	return pAnimation;
+}
+
+Uint32 GFXCache::readUint32() {
+	return SDL_SwapLE32(*((const Uint32*) readBytes(4)));
+}
+
+bool GFXCache::openForWriting() {
+	if(pWriteFile != NULL) {
+		return false;
+	}
+
+	if((pWriteFile = SDL_RWFromFile((filename + ".tmp").c_str(), "wb")) == NULL) {
+		return false;
+	}
+
+	return writeUint32(GFXCACHE_MAGIC) && writeUint32(GFXCACHE_VERSION)
+			&& writeUint32(key.length()) && writeBytes(key.c_str(), key.length());
+}
+
+bool GFXCache::writeSurface(SDL_Surface* pSurface) {
+	if(pSurface == NULL) {
+		return writeUint32(0);
+	}
+
+	if((pSurface->format->BitsPerPixel != 8) || (pSurface->format->palette == NULL)) {
+		fprintf(stderr,"GFXCache::writeSurface(): Only 8-bit surfaces can be cached!\n");
+		return false;
+	}
+
+	SDL_Palette* pPalette = pSurface->format->palette;
+
+	bool bSuccess = writeUint32(1) && writeUint32(pSurface->w) && writeUint32(pSurface->h)
+					&& writeUint32(pSurface->flags & (SDL_SRCCOLORKEY | SDL_RLEACCELOK)) && writeUint32(pSurface->format->colorkey)
+					&& writeUint32(pPalette->ncolors);
+
+	for(int i = 0; bSuccess && (i < pPalette->ncolors); i++) {
+		Uint8 color[4] = { pPalette->colors[i].r, pPalette->colors[i].g, pPalette->colors[i].b, 0 };
+		bSuccess = writeBytes(color, 4);
+	}
+
+	// locking also decodes RLE accelerated surfaces
+	if(bSuccess && (SDL_LockSurface(pSurface) == 0)) {
+		Uint32 pitch = align4(pSurface->w);
+		for(int y = 0; bSuccess && (y < pSurface->h); y++) {
+			bSuccess = (SDL_RWwrite(pWriteFile, ((char*) pSurface->pixels) + y*pSurface->pitch, 1, pSurface->w) == pSurface->w);
+			if(bSuccess && (pitch > (Uint32) pSurface->w)) {
+				Uint8 padding[4] = { 0, 0, 0, 0 };
+				bSuccess = (SDL_RWwrite(pWriteFile, padding, 1, pitch - pSurface->w) == (int) (pitch - pSurface->w));
+			}
+		}
+		SDL_UnlockSurface(pSurface);
+	} else {
+		bSuccess = false;
+	}
+
+	return bSuccess;
+}
+
+bool GFXCache::writeAnimation(Animation* pAnimation) {
+	if(pAnimation == NULL) {
+		return writeUint32(0);
+	}
+
+	bool bSuccess = writeUint32(1) && writeUint32(pAnimation->getNumFrames()) && writeUint32(pAnimation->getFrameDurationTime());
+
+	for(unsigned int i = 0; bSuccess && (i < pAnimation->getNumFrames()); i++) {
+		bSuccess = writeSurface(pAnimation->getFrameSurface(i));
+	}
+
+	return bSuccess;
+}
+
+bool GFXCache::writeUint32(Uint32 value) {
+	Uint32 data = SDL_SwapLE32(value);
+	return writeBytes(&data, 4);
+}
+
+bool GFXCache::finishWriting(bool bSuccess) {
+	if(pWriteFile == NULL) {
+		return false;
+	}
+
+	SDL_RWclose(pWriteFile);
+	pWriteFile = NULL;
+
+	std::string tmpFilename = filename + ".tmp";
+
+	if(bSuccess == true) {
+		remove(filename.c_str());
+		if(rename(tmpFilename.c_str(), filename.c_str()) == 0) {
+			return true;
+		}
+	}
+
+	remove(tmpFilename.c_str());
+	return false;
+}
+
+/**
+	Returns the next size bytes of the cache file. The read position is advanced to the next aligned position.
+	\param	size	the number of bytes to read
+	\return	the read bytes
+*/
+const char* GFXCache::readBytes(Uint32 size) {
+	if((pData == NULL) || (size > dataSize) || (readPos > dataSize - align4(size))) {
+		throw std::runtime_error("GFXCache::readBytes(): Unexpected end of cache file!");
+	}
+
+	const char* pBytes = pData + readPos;
+	readPos += align4(size);
+	return pBytes;
+}
+
+/**
+	Writes size bytes to the new cache file and pads them to the next aligned position.
+	\param	pData	the bytes to write
+	\param	size	the number of bytes to write
+	\return	true on success, false otherwise
+*/
+bool GFXCache::writeBytes(const void* pData, Uint32 size) {
+	if((size > 0) && (SDL_RWwrite(pWriteFile, pData, size, 1) != 1)) {
+		return false;
+	}
+
+	Uint8 padding[4] = { 0, 0, 0, 0 };
+	Uint32 paddingSize = align4(size) - size;
+	return (paddingSize == 0) || (SDL_RWwrite(pWriteFile, padding, paddingSize, 1) == 1);
+}
@@ -25,13 +25,84 @@
 #include <FileClasses/Icnfile.h>
 #include <FileClasses/Wsafile.h>
 #include <FileClasses/Palfile.h>
+#include <FileClasses/GFXCache.h>
+#include <FileClasses/AssetLoader.h>
 
 #include <misc/draw_util.h>
+#include <misc/fnkdat.h>
 
 #include <stdexcept>
+#include <sstream>
 
 using std::shared_ptr;
 
+namespace {
+
+	/// Decodes all frames of a WSA file into an animation
+	class WsaAnimationTask : public AssetLoader::Task {
+	public:
+		WsaAnimationTask(Animation** ppAnimation, const std::string& filename)
+		 : AssetLoader::Task(filename), ppAnimation(ppAnimation), pDecodedAnimation(NULL) {
+		}
+
+		virtual ~WsaAnimationTask() {
+			delete pDecodedAnimation;
+		}
+
+		virtual void decode() {
+			SDL_RWops* file = pFileManager->OpenFile(getName());
+			try {
+				Wsafile wsafile(file);
+				pDecodedAnimation = wsafile.getAnimation(0, wsafile.getNumFrames() - 1, true, false);
+			} catch(std::exception&) {
+				SDL_RWclose(file);
+				throw;
+			}
+			SDL_RWclose(file);
+		}
+
+		virtual void finish() {
+			*ppAnimation = pDecodedAnimation;
+			pDecodedAnimation = NULL;
+		}
+
+	private:
+		Animation**	ppAnimation;			///< where to store the decoded animation
+		Animation*	pDecodedAnimation;		///< the decoded animation until it is handed over
+	};
+
+	/// Decodes a CPS picture
+	class CpsPictureTask : public AssetLoader::Task {
+	public:
+		CpsPictureTask(SDL_Surface** ppSurface, const std::string& filename, bool bDoublePic)
+		 : AssetLoader::Task(filename), ppSurface(ppSurface), pDecodedSurface(NULL), bDoublePic(bDoublePic) {
+		}
+
+		virtual ~CpsPictureTask() {
+			if(pDecodedSurface != NULL) {
+				SDL_FreeSurface(pDecodedSurface);
+			}
+		}
+
+		virtual void decode() {
+			pDecodedSurface = LoadCPS_RW(pFileManager->OpenFile(getName()), true);
+			if((pDecodedSurface != NULL) && (bDoublePic == true)) {
+				pDecodedSurface = DoublePicture(pDecodedSurface);
+			}
+		}
+
+		virtual void finish() {
+			*ppSurface = pDecodedSurface;
+			pDecodedSurface = NULL;
+		}
+
+	private:
+		SDL_Surface**	ppSurface;			///< where to store the decoded picture
+		SDL_Surface*	pDecodedSurface;	///< the decoded picture until it is handed over
+		bool			bDoublePic;			///< double the size of the picture?
+	};
+}
+
 GFXManager::GFXManager() {
 	WindTrapColorTimer = -139;
 
@@ -71,6 +142,107 @@ GFXManager::GFXManager() {
 		Anim[i] = NULL;
 	}
 
+	// the cache is only valid for the same data files, language and screen format
+	std::stringstream key;
+	key << pFileManager->getDataChecksum() << settings.General.LanguageExt << ";" << (int) screen->format->BitsPerPixel;
+
+	pCache = new GFXCache(getCacheFilename(), key.str());
+	if((AssetLoader::isBenchmark() == true) || (loadFromCache() == false)) {
+		freeGraphics();
+		delete pCache;
+		pCache = NULL;
+
+		loadFromDataFiles();
+
+		GFXCache newCache(getCacheFilename(), key.str());
+		if(saveToCache(newCache) == false) {
+			fprintf(stderr,"GFXManager: Cannot write graphics cache!\n");
+		}
+	}
+
+	// Create alpha blending surfaces (128x128 pixel)
+	Transparent40Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
+    SDL_SetAlpha(Transparent40Surface, SDL_SRCALPHA, 40);
+
+	Transparent150Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
+    SDL_SetAlpha(Transparent150Surface, SDL_SRCALPHA, 150);
+
+	for(int i = 0; i < NUM_ANIMATION; i++) {
+		if(Anim[i] == NULL) {
+			fprintf(stderr,"GFXManager::GFXManager: Not all animations could be loaded\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+void GFXManager::loadFromDataFiles() {
+	// the animations and the big pictures take most of the time => decode them on all processors first
+	AssetLoader loader("graphics");
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_AtreidesPlanet], "FARTR.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_HarkonnenPlanet], "FHARK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_OrdosPlanet], "FORDOS.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Win1], "WIN1.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Win2], "WIN2.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Lose1], "LOSTBILD.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Lose2], "LOSTVEHC.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Barracks], "BARRAC.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Carryall], "CARRYALL.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_ConstructionYard], "CONSTRUC.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Fremen], "FREMEN.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_DeathHand], "GOLD-BB.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Devastator], "HARKTANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Harvester], "HARVEST.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Radar], "HEADQRTS.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_HighTechFactory], "HITCFTRY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_SiegeTank], "HTANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_HeavyFactory], "HVYFTRY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Trooper], "HYINFY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Infantry], "INFANTRY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_IX], "IX.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_LightFactory], "LITEFTRY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Tank], "LTANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_MCV], "MCV.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Deviator], "ORDRTANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Ornithopter], "ORNI.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Raider], "OTRIKE.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Palace], "PALACE.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Quad], "QUAD.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Refinery], "REFINERY.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_RepairYard], "REPAIR.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Launcher], "RTANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_RocketTurret], "RTURRET.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Saboteur], "SABOTURE.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Slab1], "SLAB.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_SonicTank], "STANK.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_StarPort], "STARPORT.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Silo], "STORAGE.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Trike], "TRIKE.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_GunTurret], "TURRET.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Wall], "WALL.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_WindTrap], "WINDTRAP.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_WOR], "WOR.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Sandworm], "WORM.WSA"));
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Sardaukar], "SARDUKAR.WSA"));
+	if(pFileManager->exists("FRIGATE.WSA")) {
+		loader.addTask(new WsaAnimationTask(&Anim[Anim_Frigate], "FRIGATE.WSA"));
+	} else {
+		// There are some MENTAT.PAK files without FRIGATE.WSA.
+		// We replace it with the starport
+		loader.addTask(new WsaAnimationTask(&Anim[Anim_Frigate], "STARPORT.WSA"));
+	}
+	loader.addTask(new WsaAnimationTask(&Anim[Anim_Slab4], "4SLAB.WSA"));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_PlanetBackground][HOUSE_HARKONNEN], "BIGPLAN.CPS", false));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_ATREIDES], "MENTATA.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_FREMEN], "MENTATA.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_ORDOS], "MENTATO.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_MERCENARY], "MENTATM.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_HARKONNEN], "MENTATH.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MentatBackground][HOUSE_SARDAUKAR], "MENTATH.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN], "DUNEMAP.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], "DUNERGN.CPS", true));
+	loader.addTask(new CpsPictureTask(&UIGraphic[UI_MapChoiceClickMap][HOUSE_HARKONNEN], "RGNCLK.CPS", true));
+	loader.run();
+
 	// open all shp files
 	shared_ptr<Shpfile> units = LoadShpfile("UNITS.SHP");
 	shared_ptr<Shpfile> units1 = LoadShpfile("UNITS1.SHP");
@@ -265,62 +437,10 @@ GFXManager::GFXManager() {
 	    Anim[Anim_MercenaryMouth]->setPalette(benePalette);
 	}
 	Anim[Anim_MercenaryMouth]->setFrameRate(5.0);
-	Anim[Anim_AtreidesPlanet] = LoadAnimationFromWsa("FARTR.WSA");
+
 	Anim[Anim_AtreidesPlanet]->setFrameRate(12);
-	Anim[Anim_HarkonnenPlanet] = LoadAnimationFromWsa("FHARK.WSA");
 	Anim[Anim_HarkonnenPlanet]->setFrameRate(12);
-	Anim[Anim_OrdosPlanet] = LoadAnimationFromWsa("FORDOS.WSA");
 	Anim[Anim_OrdosPlanet]->setFrameRate(12);
-	Anim[Anim_Win1] = LoadAnimationFromWsa("WIN1.WSA");
-	Anim[Anim_Win2] = LoadAnimationFromWsa("WIN2.WSA");
-	Anim[Anim_Lose1] = LoadAnimationFromWsa("LOSTBILD.WSA");
-	Anim[Anim_Lose2] = LoadAnimationFromWsa("LOSTVEHC.WSA");
-	Anim[Anim_Barracks] = LoadAnimationFromWsa("BARRAC.WSA");
-	Anim[Anim_Carryall] = LoadAnimationFromWsa("CARRYALL.WSA");
-	Anim[Anim_ConstructionYard] = LoadAnimationFromWsa("CONSTRUC.WSA");
-	Anim[Anim_Fremen] = LoadAnimationFromWsa("FREMEN.WSA");
-	Anim[Anim_DeathHand] = LoadAnimationFromWsa("GOLD-BB.WSA");
-	Anim[Anim_Devastator] = LoadAnimationFromWsa("HARKTANK.WSA");
-	Anim[Anim_Harvester] = LoadAnimationFromWsa("HARVEST.WSA");
-	Anim[Anim_Radar] = LoadAnimationFromWsa("HEADQRTS.WSA");
-	Anim[Anim_HighTechFactory] = LoadAnimationFromWsa("HITCFTRY.WSA");
-	Anim[Anim_SiegeTank] = LoadAnimationFromWsa("HTANK.WSA");
-	Anim[Anim_HeavyFactory] = LoadAnimationFromWsa("HVYFTRY.WSA");
-	Anim[Anim_Trooper] = LoadAnimationFromWsa("HYINFY.WSA");
-	Anim[Anim_Infantry] = LoadAnimationFromWsa("INFANTRY.WSA");
-	Anim[Anim_IX] = LoadAnimationFromWsa("IX.WSA");
-	Anim[Anim_LightFactory] = LoadAnimationFromWsa("LITEFTRY.WSA");
-	Anim[Anim_Tank] = LoadAnimationFromWsa("LTANK.WSA");
-	Anim[Anim_MCV] = LoadAnimationFromWsa("MCV.WSA");
-	Anim[Anim_Deviator] = LoadAnimationFromWsa("ORDRTANK.WSA");
-	Anim[Anim_Ornithopter] = LoadAnimationFromWsa("ORNI.WSA");
-	Anim[Anim_Raider] = LoadAnimationFromWsa("OTRIKE.WSA");
-	Anim[Anim_Palace] = LoadAnimationFromWsa("PALACE.WSA");
-	Anim[Anim_Quad] = LoadAnimationFromWsa("QUAD.WSA");
-	Anim[Anim_Refinery] = LoadAnimationFromWsa("REFINERY.WSA");
-	Anim[Anim_RepairYard] = LoadAnimationFromWsa("REPAIR.WSA");
-	Anim[Anim_Launcher] = LoadAnimationFromWsa("RTANK.WSA");
-	Anim[Anim_RocketTurret] = LoadAnimationFromWsa("RTURRET.WSA");
-	Anim[Anim_Saboteur] = LoadAnimationFromWsa("SABOTURE.WSA");
-	Anim[Anim_Slab1] = LoadAnimationFromWsa("SLAB.WSA");
-	Anim[Anim_SonicTank] = LoadAnimationFromWsa("STANK.WSA");
-	Anim[Anim_StarPort] = LoadAnimationFromWsa("STARPORT.WSA");
-	Anim[Anim_Silo] = LoadAnimationFromWsa("STORAGE.WSA");
-	Anim[Anim_Trike] = LoadAnimationFromWsa("TRIKE.WSA");
-	Anim[Anim_GunTurret] = LoadAnimationFromWsa("TURRET.WSA");
-	Anim[Anim_Wall] = LoadAnimationFromWsa("WALL.WSA");
-	Anim[Anim_WindTrap] = LoadAnimationFromWsa("WINDTRAP.WSA");
-	Anim[Anim_WOR] = LoadAnimationFromWsa("WOR.WSA");
-	Anim[Anim_Sandworm] = LoadAnimationFromWsa("WORM.WSA");
-	Anim[Anim_Sardaukar] = LoadAnimationFromWsa("SARDUKAR.WSA");
-	if(pFileManager->exists("FRIGATE.WSA")) {
-        Anim[Anim_Frigate] = LoadAnimationFromWsa("FRIGATE.WSA");
-	} else {
-	    // There are some MENTAT.PAK files without FRIGATE.WSA.
-	    // We replace it with the starport
-        Anim[Anim_Frigate] = LoadAnimationFromWsa("STARPORT.WSA");
-	}
-	Anim[Anim_Slab4] = LoadAnimationFromWsa("4SLAB.WSA");
 
 	for(int i = Anim_Barracks; i <= Anim_Slab4; i++) {
 		Anim[i]->setFrameRate(15.0);
@@ -413,21 +533,14 @@ GFXManager::GFXManager() {
 	UIGraphic[UI_GameMenu][HOUSE_HARKONNEN] = PicFactory->createMenu(UIGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],158);
 	PicFactory->drawFrame(UIGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
 
-	UIGraphic[UI_PlanetBackground][HOUSE_HARKONNEN] = LoadCPS_RW(pFileManager->OpenFile("BIGPLAN.CPS"),true);
 	PicFactory->drawFrame(UIGraphic[UI_PlanetBackground][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
 	UIGraphic[UI_MenuButtonBorder][HOUSE_HARKONNEN] = PicFactory->createFrame(PictureFactory::DecorationFrame1,190,123,false);
 
 	PicFactory->drawFrame(UIGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
 
-	UIGraphic[UI_MentatBackground][HOUSE_ATREIDES] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATA.CPS"),true));
-	UIGraphic[UI_MentatBackground][HOUSE_FREMEN] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATA.CPS"),true));
-	UIGraphic[UI_MentatBackground][HOUSE_ORDOS] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATO.CPS"),true));
-	UIGraphic[UI_MentatBackground][HOUSE_MERCENARY] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATM.CPS"),true));
 	if(UIGraphic[UI_MentatBackground][HOUSE_MERCENARY] != NULL) {
 	    benePalette.applyToSurface(UIGraphic[UI_MentatBackground][HOUSE_MERCENARY]);
 	}
-	UIGraphic[UI_MentatBackground][HOUSE_HARKONNEN] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATH.CPS"),true));
-	UIGraphic[UI_MentatBackground][HOUSE_SARDAUKAR] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("MENTATH.CPS"),true));
 	UIGraphic[UI_MentatYes][HOUSE_HARKONNEN] = DoublePicture(mentat->getPicture(0));
 	UIGraphic[UI_MentatYes_Pressed][HOUSE_HARKONNEN] = DoublePicture(mentat->getPicture(1));
 	UIGraphic[UI_MentatNo][HOUSE_HARKONNEN] = DoublePicture(mentat->getPicture(2));
@@ -454,11 +567,8 @@ GFXManager::GFXManager() {
 	UIGraphic[UI_MapChoiceScreen][HOUSE_ATREIDES] = PicFactory->createMapChoiceScreen(HOUSE_ATREIDES);
 	UIGraphic[UI_MapChoiceScreen][HOUSE_ORDOS] = PicFactory->createMapChoiceScreen(HOUSE_ORDOS);
 	UIGraphic[UI_MapChoiceScreen][HOUSE_HARKONNEN] = PicFactory->createMapChoiceScreen(HOUSE_HARKONNEN);
-	UIGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("DUNEMAP.CPS"),true));
 	SDL_SetColorKey(UIGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	UIGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("DUNERGN.CPS"),true));
 	SDL_SetColorKey(UIGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	UIGraphic[UI_MapChoiceClickMap][HOUSE_HARKONNEN] = DoublePicture(LoadCPS_RW(pFileManager->OpenFile("RGNCLK.CPS"),true));
 
 	UIGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->OpenFile("StructureSizeLattice.bmp"),true);
 	SDL_SetColorKey(UIGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
@@ -477,13 +587,6 @@ GFXManager::GFXManager() {
 		SDL_SetColorKey(MapChoiceArrows[i], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
 	}
 
-	// Create alpha blending surfaces (128x128 pixel)
-	Transparent40Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
-    SDL_SetAlpha(Transparent40Surface, SDL_SRCALPHA, 40);
-
-	Transparent150Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
-    SDL_SetAlpha(Transparent150Surface, SDL_SRCALPHA, 150);
-
 	for(int i = 0; i < NUM_OBJPICS; i++) {
 		for(int j = 0; j < (int) NUM_HOUSES; j++) {
 			if(ObjPic[i][j] != NULL) {
@@ -525,16 +628,19 @@ GFXManager::GFXManager() {
 			}
 		}
 	}
-
-	for(int i = 0; i < NUM_ANIMATION; i++) {
-		if(Anim[i] == NULL) {
-			fprintf(stderr,"GFXManager::GFXManager: Not all animations could be loaded\n");
-			exit(EXIT_FAILURE);
-		}
-	}
 }
 
 GFXManager::~GFXManager() {
+	freeGraphics();
+
+	SDL_FreeSurface(Transparent40Surface);
+	SDL_FreeSurface(Transparent150Surface);
+
+	// the cached surfaces point into the cache => delete it last
+	delete pCache;
+}
+
+void GFXManager::freeGraphics() {
 	for(int i = 0; i < NUM_OBJPICS; i++) {
 		for(int j = 0; j < (int) NUM_HOUSES; j++) {
 			if(ObjPic[i][j] != NULL) {
@@ -583,8 +689,6 @@ GFXManager::~GFXManager() {
 		}
 	}
 
-	SDL_FreeSurface(Transparent40Surface);
-	SDL_FreeSurface(Transparent150Surface);
 }
 
 SDL_Surface* GFXManager::getObjPic(unsigned int id, int house) {
@@ -785,21 +889,118 @@ SDL_Surface* GFXManager::ExtractSmallDetailPic(std::string filename) {
 	return returnPic;
 }
 
-Animation* GFXManager::LoadAnimationFromWsa(std::string filename) {
-	SDL_RWops* file;
-	if((file = pFileManager->OpenFile(filename)) == NULL) {
-		fprintf(stderr,"GFXManager::LoadAnimationFromWsa(): Cannot open %s!\n",filename.c_str());
-		exit(EXIT_FAILURE);
+std::string GFXManager::getCacheFilename() {
+	char tmp[FILENAME_MAX];
+	fnkdat("gfx.cache", tmp, FILENAME_MAX, FNKDAT_USER | FNKDAT_CREAT);
+	return std::string(tmp);
+}
+
+bool GFXManager::loadFromCache() {
+	if(pCache->openForReading() == false) {
+		return false;
 	}
 
-	Wsafile* wsafile;
-	if((wsafile = new Wsafile(file)) == NULL) {
-		fprintf(stderr,"GFXManager::LoadAnimationFromWsa(): Cannot open %s!\n",filename.c_str());
-		exit(EXIT_FAILURE);
+	try {
+		// the sizes of all arrays are stored as a sanity check
+		if((pCache->readUint32() != NUM_OBJPICS) || (pCache->readUint32() != NUM_HOUSES)
+			|| (pCache->readUint32() != NUM_SMALLDETAILPICS) || (pCache->readUint32() != NUM_UIGRAPHICS)
+			|| (pCache->readUint32() != NUM_MAPCHOICEPIECES) || (pCache->readUint32() != NUM_MAPCHOICEARROWS)
+			|| (pCache->readUint32() != NUM_ANIMATION)) {
+			return false;
+		}
+
+		for(int i = 0; i < NUM_OBJPICS; i++) {
+			for(int j = 0; j < (int) NUM_HOUSES; j++) {
+				ObjPic[i][j] = pCache->readSurface();
+			}
+		}
+
+		for(int i = 0; i < NUM_SMALLDETAILPICS; i++) {
+			SmallDetailPic[i] = pCache->readSurface();
+		}
+
+		for(int i = 0; i < NUM_UIGRAPHICS; i++) {
+			for(int j = 0; j < (int) NUM_HOUSES; j++) {
+				UIGraphic[i][j] = pCache->readSurface();
+			}
+		}
+
+		for(int i = 0; i < NUM_MAPCHOICEPIECES; i++) {
+			for(int j = 0; j < (int) NUM_HOUSES; j++) {
+				MapChoicePieces[i][j] = pCache->readSurface();
+			}
+		}
+
+		for(int i = 0; i < NUM_MAPCHOICEARROWS; i++) {
+			MapChoiceArrows[i] = pCache->readSurface();
+		}
+
+		for(int i = 0; i < NUM_ANIMATION; i++) {
+			Anim[i] = pCache->readAnimation();
+		}
+	} catch(std::exception& e) {
+		fprintf(stderr,"GFXManager: Graphics cache is corrupt: %s\n", e.what());
+		return false;
+	}
+
+	return true;
+}
+
+bool GFXManager::saveToCache(GFXCache& cache) {
+	// remap all house colored pictures now so that later starts need not to do it
+	for(int i = 0; i < NUM_OBJPICS; i++) {
+		if(ObjPic[i][HOUSE_HARKONNEN] != NULL) {
+			for(int j = 0; j < (int) NUM_HOUSES; j++) {
+				getObjPic(i, j);
+			}
+		}
+	}
+
+	for(int i = 0; i < NUM_MAPCHOICEPIECES; i++) {
+		for(int j = 0; j < (int) NUM_HOUSES; j++) {
+			getMapChoicePiece(i, j);
+		}
+	}
+
+	if(cache.openForWriting() == false) {
+		return false;
+	}
+
+	bool bSuccess = cache.writeUint32(NUM_OBJPICS) && cache.writeUint32(NUM_HOUSES)
+					&& cache.writeUint32(NUM_SMALLDETAILPICS) && cache.writeUint32(NUM_UIGRAPHICS)
+					&& cache.writeUint32(NUM_MAPCHOICEPIECES) && cache.writeUint32(NUM_MAPCHOICEARROWS)
+					&& cache.writeUint32(NUM_ANIMATION);
+
+	for(int i = 0; bSuccess && (i < NUM_OBJPICS); i++) {
+		for(int j = 0; bSuccess && (j < (int) NUM_HOUSES); j++) {
+			bSuccess = cache.writeSurface(ObjPic[i][j]);
+		}
+	}
+
+	for(int i = 0; bSuccess && (i < NUM_SMALLDETAILPICS); i++) {
+		bSuccess = cache.writeSurface(SmallDetailPic[i]);
+	}
+
+	// the other houses' UI graphics are rarely needed and still remapped on demand
+	for(int i = 0; bSuccess && (i < NUM_UIGRAPHICS); i++) {
+		for(int j = 0; bSuccess && (j < (int) NUM_HOUSES); j++) {
+			bSuccess = cache.writeSurface(UIGraphic[i][j]);
+		}
+	}
+
+	for(int i = 0; bSuccess && (i < NUM_MAPCHOICEPIECES); i++) {
+		for(int j = 0; bSuccess && (j < (int) NUM_HOUSES); j++) {
+			bSuccess = cache.writeSurface(MapChoicePieces[i][j]);
+		}
+	}
+
+	for(int i = 0; bSuccess && (i < NUM_MAPCHOICEARROWS); i++) {
+		bSuccess = cache.writeSurface(MapChoiceArrows[i]);
+	}
+
+	for(int i = 0; bSuccess && (i < NUM_ANIMATION); i++) {
+		bSuccess = cache.writeAnimation(Anim[i]);
 	}
 
-	Animation* ret = wsafile->getAnimation(0,wsafile->getNumFrames() - 1,true,false);
-	delete wsafile;
-	SDL_RWclose(file);
-	return ret;
+	return cache.finishWriting(bSuccess);
 }
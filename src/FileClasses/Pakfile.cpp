@@ -23,6 +23,13 @@
 #include <SDL.h>
 #include <stdexcept>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 
 ///	Constructor for Pakfile
 /**
@@ -37,6 +44,8 @@ Pakfile::Pakfile(std::string Pakfilename, bool write)
 	this->write = write;
 	WriteOutData = NULL;
 	NumWriteOutData = 0;
+	pMappedData = NULL;
+	MappedSize = 0;
 
 	Filename = Pakfilename;
 
@@ -53,12 +62,16 @@ Pakfile::Pakfile(std::string Pakfilename, bool write)
             throw;
         }
 
+        MapFile();
+
 	} else {
 		// Open for writing
 		if( (fPakFile = SDL_RWFromFile(Filename.c_str(), "wb")) == NULL) {
 			throw std::invalid_argument("Pakfile::Pakfile(): Cannot open " + Pakfilename + "!");
 		}
 	}
+
+	pReadMutex = SDL_CreateMutex();
 }
 
 /// Destructor
@@ -93,10 +106,16 @@ Pakfile::~Pakfile()
 		SDL_RWwrite(fPakFile,WriteOutData,NumWriteOutData,1);
 	}
 
+	UnmapFile();
+
 	if(fPakFile != NULL) {
 		SDL_RWclose(fPakFile);
 	}
 
+	if(pReadMutex != NULL) {
+		SDL_DestroyMutex(pReadMutex);
+	}
+
 	if(WriteOutData != NULL) {
 		free(WriteOutData);
 		WriteOutData = NULL;
@@ -179,24 +198,32 @@ void Pakfile::AddFile(SDL_RWops* rwop, std::string filename) {
 	\return	SDL_RWops for this file
 */
 SDL_RWops* Pakfile::OpenFile(std::string filename) {
-	if(write == true) {
-		// reading files is not allowed
+	int Index = FindFile(filename);
+
+	if(Index == -1) {
 		return NULL;
 	}
 
-	// find file
-	int Index = -1;
-	for(unsigned int i=0;i<FileEntries.size();i++) {
-		if(filename == FileEntries[i].Filename) {
-			Index = i;
-			break;
-		}
-	}
+	return OpenFile(Index);
+}
 
-	if(Index == -1) {
+/// Opens a file in this PAK-File.
+/**
+	This method opens the nth file of this PAK-File. See OpenFile(std::string filename) for details.
+	\param	index	Index in pak-File
+	\return	SDL_RWops for this file
+*/
+SDL_RWops* Pakfile::OpenFile(unsigned int index) {
+	if((write == true) || (index >= FileEntries.size())) {
+		// reading files is not allowed
 		return NULL;
 	}
 
+	if(pMappedData != NULL) {
+		// read directly from the mapped memory
+		return SDL_RWFromConstMem(pMappedData + FileEntries[index].StartOffset, FileEntries[index].EndOffset + 1 - FileEntries[index].StartOffset);
+	}
+
 	// alloc RWop
 	SDL_RWops *pRWop;
 	if((pRWop = SDL_AllocRW()) == NULL) {
@@ -213,7 +240,7 @@ SDL_RWops* Pakfile::OpenFile(std::string filename) {
 	pRWop->type = PAKFILE_RWOP_TYPE;
 	pRWopData->curPakfile = this;
 	pRWopData->FileOffset = 0;
-	pRWopData->FileIndex = Index;
+	pRWopData->FileIndex = index;
 
 	pRWop->read = Pakfile::ReadFile;
 	pRWop->write = Pakfile::WriteFile;
@@ -225,13 +252,7 @@ SDL_RWops* Pakfile::OpenFile(std::string filename) {
 }
 
 bool Pakfile::exists(std::string filename) {
-	for(unsigned int i=0;i<FileEntries.size();i++) {
-		if(filename == FileEntries[i].Filename) {
-			return true;
-		}
-	}
-
-	return false;
+	return (FindFile(filename) != -1);
 }
 
 
@@ -269,11 +290,13 @@ int Pakfile::ReadFile(SDL_RWops* pRWop, void *ptr, int size, int n) {
 		}
 	}
 
-	if(SDL_RWseek(pPakfile->fPakFile,readstartoffset,SEEK_SET) < 0) {
-		return -1;
-	}
+	// the files of one PAK-File might be read by several threads at once but they share one file handle
+	SDL_LockMutex(pPakfile->pReadMutex);
+	bool bSuccess = (SDL_RWseek(pPakfile->fPakFile,readstartoffset,SEEK_SET) >= 0)
+					&& (SDL_RWread(pPakfile->fPakFile,ptr,bytes2read,1) == 1);
+	SDL_UnlockMutex(pPakfile->pReadMutex);
 
-	if(SDL_RWread(pPakfile->fPakFile,ptr,bytes2read,1) != 1) {
+	if(bSuccess == false) {
 		return -1;
 	}
 
@@ -389,3 +412,55 @@ void Pakfile::ReadIndex()
 
 	FileEntries.back().EndOffset = filesize - 1;
 }
+
+/// Searches a file in this PAK-File
+/**
+	\param	filename	The name of the file to search
+	\return	the index of the file or -1 if there is no such file
+*/
+int Pakfile::FindFile(const std::string& filename) const {
+	for(unsigned int i=0;i<FileEntries.size();i++) {
+		if(filename == FileEntries[i].Filename) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/// Maps the whole PAK-File into memory
+/**
+	If the PAK-File cannot be mapped pMappedData stays NULL and the files are read through fPakFile.
+*/
+void Pakfile::MapFile() {
+#ifndef _WIN32
+	int fd = open(Filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return;
+	}
+
+	struct stat fileStat;
+	if((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)
+		&& (FileEntries.empty() || (FileEntries.back().EndOffset < (uint32_t) fileStat.st_size))) {
+		void* pData = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(pData != MAP_FAILED) {
+			pMappedData = (const char*) pData;
+			MappedSize = fileStat.st_size;
+		}
+	}
+
+	close(fd);
+#endif
+}
+
+/// Releases the mapping created by MapFile()
+void Pakfile::UnmapFile() {
+#ifndef _WIN32
+	if(pMappedData != NULL) {
+		munmap((void*) pMappedData, MappedSize);
+	}
+#endif
+
+	pMappedData = NULL;
+	MappedSize = 0;
+}
@@ -21,9 +21,139 @@
 
 #include <FileClasses/FileManager.h>
 #include <FileClasses/Vocfile.h>
+#include <FileClasses/AssetLoader.h>
 
 #include <misc/sound_util.h>
 
+#include <deque>
+
+namespace {
+
+	/// Decodes a VOC or WAV file into a sound chunk
+	class SoundChunkTask : public AssetLoader::Task {
+	public:
+		SoundChunkTask(Mix_Chunk** ppChunk, const std::string& filename, const std::string& alternativeFilename = "")
+		 : AssetLoader::Task(filename), ppChunk(ppChunk), alternativeFilename(alternativeFilename), pDecodedChunk(NULL) {
+		}
+
+		virtual ~SoundChunkTask() {
+			if(pDecodedChunk != NULL) {
+				Mix_FreeChunk(pDecodedChunk);
+			}
+		}
+
+		virtual void decode() {
+			const std::string& filename = getName();
+			if((filename.length() > 4) && (filename.compare(filename.length() - 4, 4, ".WAV") == 0)) {
+				pDecodedChunk = Mix_LoadWAV_RW(pFileManager->OpenFile(filename),1);
+			} else if(alternativeFilename.empty()) {
+				pDecodedChunk = GetChunkFromFile(filename);
+			} else {
+				pDecodedChunk = GetChunkFromFile(filename, alternativeFilename);
+			}
+		}
+
+		virtual void finish() {
+			*ppChunk = pDecodedChunk;
+			pDecodedChunk = NULL;
+		}
+
+	private:
+		Mix_Chunk**	ppChunk;				///< where to store the decoded chunk
+		std::string	alternativeFilename;	///< the file to use if the first one does not exist
+		Mix_Chunk*	pDecodedChunk;			///< the decoded chunk until it is handed over
+	};
+
+	/// Concatenates two or three decoded sound chunks
+	class ConcatChunksTask : public AssetLoader::Task {
+	public:
+		ConcatChunksTask(Mix_Chunk** ppChunk, const std::string& name, Mix_Chunk** ppPart1, Mix_Chunk** ppPart2, Mix_Chunk** ppPart3)
+		 : AssetLoader::Task(name), ppChunk(ppChunk), ppPart1(ppPart1), ppPart2(ppPart2), ppPart3(ppPart3), pDecodedChunk(NULL) {
+		}
+
+		virtual ~ConcatChunksTask() {
+			if(pDecodedChunk != NULL) {
+				Mix_FreeChunk(pDecodedChunk);
+			}
+		}
+
+		virtual void decode() {
+			if(ppPart3 == NULL) {
+				pDecodedChunk = Concat2Chunks(*ppPart1, *ppPart2);
+			} else {
+				pDecodedChunk = Concat3Chunks(*ppPart1, *ppPart2, *ppPart3);
+			}
+		}
+
+		virtual void finish() {
+			*ppChunk = pDecodedChunk;
+			pDecodedChunk = NULL;
+		}
+
+	private:
+		Mix_Chunk**	ppChunk;			///< where to store the concatenated chunk
+		Mix_Chunk**	ppPart1;			///< the first part (decoded by a dependency)
+		Mix_Chunk**	ppPart2;			///< the second part (decoded by a dependency)
+		Mix_Chunk**	ppPart3;			///< the third part (decoded by a dependency) or NULL
+		Mix_Chunk*	pDecodedChunk;		///< the concatenated chunk until it is handed over
+	};
+
+	/// The parts of concatenated voices. They are decoded by the loader and freed when this list is destroyed.
+	class SoundPartList {
+	public:
+		SoundPartList(AssetLoader& loader) : loader(loader) {
+		}
+
+		~SoundPartList() {
+			std::deque<Mix_Chunk*>::const_iterator iter;
+			for(iter = parts.begin(); iter != parts.end(); ++iter) {
+				if(*iter != NULL) {
+					Mix_FreeChunk(*iter);
+				}
+			}
+		}
+
+		/**
+			Adds a part to decode.
+			\param	filename	the file to decode
+			\return	the index of the part
+		*/
+		int add(const std::string& filename) {
+			// the chunks in a deque do not move when adding more
+			parts.push_back(NULL);
+			taskIds.push_back(loader.addTask(new SoundChunkTask(&parts.back(), filename)));
+			names.push_back(filename);
+			return parts.size() - 1;
+		}
+
+		/**
+			Concatenates two or three parts after they were decoded.
+			\param	ppChunk	where to store the concatenated chunk
+			\param	part1	the index of the first part
+			\param	part2	the index of the second part
+			\param	part3	the index of the third part or -1
+		*/
+		void concat(Mix_Chunk** ppChunk, int part1, int part2, int part3 = -1) {
+			std::vector<int> dependencies;
+			dependencies.push_back(taskIds[part1]);
+			dependencies.push_back(taskIds[part2]);
+			std::string name = names[part1] + "+" + names[part2];
+			if(part3 >= 0) {
+				dependencies.push_back(taskIds[part3]);
+				name += "+" + names[part3];
+			}
+
+			loader.addTask(new ConcatChunksTask(ppChunk, name, &parts[part1], &parts[part2], (part3 >= 0) ? &parts[part3] : NULL), dependencies);
+		}
+
+	private:
+		AssetLoader&				loader;
+		std::deque<Mix_Chunk*>		parts;
+		std::vector<int>			taskIds;
+		std::vector<std::string>	names;
+	};
+}
+
 SFXManager::SFXManager() {
 	// load voice and language specific sounds
 	switch(settings.General.Language) {
@@ -103,9 +233,12 @@ void SFXManager::LoadVoice_English() {
 		Lng_Voice[i] = NULL;
 	}
 
+	AssetLoader loader("sounds");
+	SoundPartList parts(loader);
+
 	// now we can load
 	for(int house = 0; house < 3; house++) {
-		Mix_Chunk* HouseNameChunk;
+		int HouseNamePart;
 
 		std::string HouseString;
 		int VoiceNum;
@@ -114,156 +247,126 @@ void SFXManager::LoadVoice_English() {
 			case HOUSE_FREMEN:
 				VoiceNum = 0;
 				HouseString = "A";
-				HouseNameChunk = GetChunkFromFile(HouseString + "ATRE.VOC");
+				HouseNamePart = parts.add(HouseString + "ATRE.VOC");
 				break;
 			case HOUSE_ORDOS:
 			case HOUSE_MERCENARY:
 				VoiceNum = 1;
 				HouseString = "O";
-				HouseNameChunk = GetChunkFromFile(HouseString + "ORDOS.VOC");
+				HouseNamePart = parts.add(HouseString + "ORDOS.VOC");
 				break;
 			case HOUSE_HARKONNEN:
 			case HOUSE_SARDAUKAR:
 			default:
 				VoiceNum = 2;
 				HouseString = "H";
-				HouseNameChunk = GetChunkFromFile(HouseString + "HARK.VOC");
+				HouseNamePart = parts.add(HouseString + "HARK.VOC");
 				break;
 		}
 
 		// "... Harvester deployed"
-		Mix_Chunk* Harvester = GetChunkFromFile(HouseString + "HARVEST.VOC");
-		Mix_Chunk* Deployed = GetChunkFromFile(HouseString + "DEPLOY.VOC");
-		Lng_Voice[HarvesterDeployed*3+VoiceNum] = Concat3Chunks(HouseNameChunk, Harvester, Deployed);
-		Mix_FreeChunk(Harvester);
-		Mix_FreeChunk(Deployed);
+		parts.concat(&Lng_Voice[HarvesterDeployed*3+VoiceNum], HouseNamePart, parts.add(HouseString + "HARVEST.VOC"), parts.add(HouseString + "DEPLOY.VOC"));
 
 		// "Contruction complete"
-		Lng_Voice[ConstructionComplete*3+VoiceNum] = GetChunkFromFile(HouseString + "CONST.VOC");
+		loader.addTask(new SoundChunkTask(&Lng_Voice[ConstructionComplete*3+VoiceNum], HouseString + "CONST.VOC"));
 
 		// "Vehicle repaired"
-		Mix_Chunk* Vehicle = GetChunkFromFile(HouseString + "VEHICLE.VOC");
-		Mix_Chunk* Repaired = GetChunkFromFile(HouseString + "REPAIR.VOC");
-		Lng_Voice[VehicleRepaired*3+VoiceNum] = Concat2Chunks(Vehicle, Repaired);
-		Mix_FreeChunk(Vehicle);
-		Mix_FreeChunk(Repaired);
+		parts.concat(&Lng_Voice[VehicleRepaired*3+VoiceNum], parts.add(HouseString + "VEHICLE.VOC"), parts.add(HouseString + "REPAIR.VOC"));
 
 		// "Frigate has arrived"
-		Mix_Chunk* FrigateChunk = GetChunkFromFile(HouseString + "FRIGATE.VOC");
-		Mix_Chunk* HasArrivedChunk = GetChunkFromFile(HouseString + "ARRIVE.VOC");
-		Lng_Voice[FrigateHasArrived*3+VoiceNum] = Concat2Chunks(FrigateChunk, HasArrivedChunk);
-		Mix_FreeChunk(FrigateChunk);
-		Mix_FreeChunk(HasArrivedChunk);
+		parts.concat(&Lng_Voice[FrigateHasArrived*3+VoiceNum], parts.add(HouseString + "FRIGATE.VOC"), parts.add(HouseString + "ARRIVE.VOC"));
 
 		// "Your mission is complete"
-		Lng_Voice[YourMissionIsComplete*3+VoiceNum] = GetChunkFromFile(HouseString + "WIN.VOC");
+		loader.addTask(new SoundChunkTask(&Lng_Voice[YourMissionIsComplete*3+VoiceNum], HouseString + "WIN.VOC"));
 
 		// "You have failed your mission"
-		Lng_Voice[YouHaveFailedYourMission*3+VoiceNum] = GetChunkFromFile(HouseString + "LOSE.VOC");
+		loader.addTask(new SoundChunkTask(&Lng_Voice[YouHaveFailedYourMission*3+VoiceNum], HouseString + "LOSE.VOC"));
 
 		// "Radar activated"/"Radar deactivated"
-		Mix_Chunk* RadarChunk = GetChunkFromFile(HouseString + "RADAR.VOC");
-		Mix_Chunk* RadarActivatedChunk = GetChunkFromFile(HouseString + "ON.VOC");
-		Mix_Chunk* RadarDeactivatedChunk = GetChunkFromFile(HouseString + "OFF.VOC");
-		Lng_Voice[RadarActivated*3+VoiceNum] = Concat2Chunks(RadarChunk, RadarActivatedChunk);
-		Lng_Voice[RadarDeactivated*3+VoiceNum] = Concat2Chunks(RadarChunk, RadarDeactivatedChunk);
-		Mix_FreeChunk(RadarChunk);
-		Mix_FreeChunk(RadarActivatedChunk);
-		Mix_FreeChunk(RadarDeactivatedChunk);
+		int RadarPart = parts.add(HouseString + "RADAR.VOC");
+		parts.concat(&Lng_Voice[RadarActivated*3+VoiceNum], RadarPart, parts.add(HouseString + "ON.VOC"));
+		parts.concat(&Lng_Voice[RadarDeactivated*3+VoiceNum], RadarPart, parts.add(HouseString + "OFF.VOC"));
 
 		// "Bloom located"
-		Mix_Chunk* Bloom = GetChunkFromFile(HouseString + "BLOOM.VOC");
-		Mix_Chunk* Located = GetChunkFromFile(HouseString + "LOCATED.VOC");
-		Lng_Voice[BloomLocated*3+VoiceNum] = Concat2Chunks(Bloom, Located);
-		Mix_FreeChunk(Bloom);
-		Mix_FreeChunk(Located);
+		parts.concat(&Lng_Voice[BloomLocated*3+VoiceNum], parts.add(HouseString + "BLOOM.VOC"), parts.add(HouseString + "LOCATED.VOC"));
 
         // "Warning Wormsign"
-        Mix_Chunk* WarningChunk = GetChunkFromFile(HouseString + "WARNING.VOC");
-        Mix_Chunk* WormSignChunk = GetChunkFromFile(HouseString + "WORMY.VOC");
-        Lng_Voice[WarningWormSign*3+VoiceNum] = Concat2Chunks(WarningChunk, WormSignChunk);
-        Mix_FreeChunk(WarningChunk);
-        Mix_FreeChunk(WormSignChunk);
+        parts.concat(&Lng_Voice[WarningWormSign*3+VoiceNum], parts.add(HouseString + "WARNING.VOC"), parts.add(HouseString + "WORMY.VOC"));
 
         // "Our base is under attack"
-		Lng_Voice[BaseIsUnderAttack*3+VoiceNum] = GetChunkFromFile(HouseString + "ATTACK.VOC");
+		loader.addTask(new SoundChunkTask(&Lng_Voice[BaseIsUnderAttack*3+VoiceNum], HouseString + "ATTACK.VOC"));
 
         // "Saboteur approaching" and "Missile approaching"
-        Mix_Chunk* SabotChunk = GetChunkFromFile(HouseString + "SABOT.VOC");
-        Mix_Chunk* MissileChunk = GetChunkFromFile(HouseString + "MISSILE.VOC");
-        Mix_Chunk* ApproachingChunk = GetChunkFromFile(HouseString + "APPRCH.VOC");
-        Lng_Voice[SaboteurApproaching*3+VoiceNum] = Concat2Chunks(SabotChunk, ApproachingChunk);
-        Lng_Voice[MissileApproaching*3+VoiceNum] = Concat2Chunks(MissileChunk, ApproachingChunk);
-        Mix_FreeChunk(SabotChunk);
-        Mix_FreeChunk(MissileChunk);
-        Mix_FreeChunk(ApproachingChunk);
-
-		Mix_FreeChunk(HouseNameChunk);
-	}
-
-	for(int i = 0; i < Num_Lng_Voice; i++) {
-		if(Lng_Voice[i] == NULL) {
-			fprintf(stderr,"SFXManager::LoadVoice_English: Not all voice sounds could be loaded\n");
-			exit(EXIT_FAILURE);
-		}
+        int ApproachingPart = parts.add(HouseString + "APPRCH.VOC");
+        parts.concat(&Lng_Voice[SaboteurApproaching*3+VoiceNum], parts.add(HouseString + "SABOT.VOC"), ApproachingPart);
+        parts.concat(&Lng_Voice[MissileApproaching*3+VoiceNum], parts.add(HouseString + "MISSILE.VOC"), ApproachingPart);
 	}
 
 	// "Yes Sir"
-    SoundChunk[YesSir] = GetChunkFromFile("ZREPORT1.VOC", "REPORT1.VOC");
+    loader.addTask(new SoundChunkTask(&SoundChunk[YesSir], "ZREPORT1.VOC", "REPORT1.VOC"));
 
 	// "Reporting"
-	SoundChunk[Reporting] = GetChunkFromFile("ZREPORT2.VOC", "REPORT2.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Reporting], "ZREPORT2.VOC", "REPORT2.VOC"));
 
 	// "Acknowledged"
-	SoundChunk[Acknowledged] = GetChunkFromFile("ZREPORT3.VOC", "REPORT3.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Acknowledged], "ZREPORT3.VOC", "REPORT3.VOC"));
 
 	// "Affirmative"
-	SoundChunk[Affirmative] = GetChunkFromFile("ZAFFIRM.VOC", "AFFIRM.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Affirmative], "ZAFFIRM.VOC", "AFFIRM.VOC"));
 
 	// "Moving out"
-	SoundChunk[MovingOut] = GetChunkFromFile("ZMOVEOUT.VOC", "MOVEOUT.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[MovingOut], "ZMOVEOUT.VOC", "MOVEOUT.VOC"));
 
 	// "Infantry out"
-	SoundChunk[InfantryOut] = GetChunkFromFile("ZOVEROUT.VOC", "OVEROUT.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[InfantryOut], "ZOVEROUT.VOC", "OVEROUT.VOC"));
 
 	// "Somthing's under the sand"
-	SoundChunk[SomethingUnderTheSand] = GetChunkFromFile("SANDBUG.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[SomethingUnderTheSand], "SANDBUG.VOC"));
 
 	// "House Atreides"
-	SoundChunk[HouseAtreides] = GetChunkFromFile("MATRE.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseAtreides], "MATRE.VOC"));
 
 	// "House Ordos"
-	SoundChunk[HouseOrdos] = GetChunkFromFile("MORDOS.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseOrdos], "MORDOS.VOC"));
 
 	// "House Harkonnen"
-	SoundChunk[HouseHarkonnen] = GetChunkFromFile("MHARK.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseHarkonnen], "MHARK.VOC"));
 
 	// Sfx
-	SoundChunk[PlaceStructure] = GetChunkFromFile("EXDUD.VOC");
-	SoundChunk[ButtonClick] = GetChunkFromFile("BUTTON.VOC");
-	SoundChunk[InvalidAction] = Mix_LoadWAV_RW(pFileManager->OpenFile("CANNOT.WAV"),1);
-	SoundChunk[CreditsTick] = Mix_LoadWAV_RW(pFileManager->OpenFile("CREDIT.WAV"),1);
-	SoundChunk[Tick] = Mix_LoadWAV_RW(pFileManager->OpenFile("TICK.WAV"),1);
-	SoundChunk[RadarNoise] = GetChunkFromFile("STATICP.VOC");
-	SoundChunk[Sound_ExplosionGas] = GetChunkFromFile("EXGAS.VOC");
-	SoundChunk[Sound_ExplosionTiny] = GetChunkFromFile("EXTINY.VOC");
-	SoundChunk[Sound_ExplosionSmall] = GetChunkFromFile("EXSMALL.VOC");
-	SoundChunk[Sound_ExplosionMedium] = GetChunkFromFile("EXMED.VOC");
-	SoundChunk[Sound_ExplosionLarge] = GetChunkFromFile("EXLARGE.VOC");
-	SoundChunk[Sound_ExplosionStructure] = GetChunkFromFile("CRUMBLE.VOC");
-	SoundChunk[Sound_WormAttack] = GetChunkFromFile("WORMET3P.VOC");
-	SoundChunk[Sound_Gun] = GetChunkFromFile("GUN.VOC");
-	SoundChunk[Sound_Rocket] = GetChunkFromFile("ROCKET.VOC");
-	SoundChunk[Sound_Bloom] = GetChunkFromFile("EXSAND.VOC");
-	SoundChunk[Sound_Scream1] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream2] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream3] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream4] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream5] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Squashed] = GetChunkFromFile("SQUISH2.VOC");
-	SoundChunk[Sound_MachineGun] = GetChunkFromFile("GUNMULTI.VOC");
-	SoundChunk[Sound_Sonic] = Mix_LoadWAV_RW(pFileManager->OpenFile("SONIC.WAV"),1);
-	SoundChunk[Sound_RocketSmall] = GetChunkFromFile("MISLTINP.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[PlaceStructure], "EXDUD.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[ButtonClick], "BUTTON.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[InvalidAction], "CANNOT.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[CreditsTick], "CREDIT.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Tick], "TICK.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[RadarNoise], "STATICP.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionGas], "EXGAS.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionTiny], "EXTINY.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionSmall], "EXSMALL.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionMedium], "EXMED.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionLarge], "EXLARGE.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionStructure], "CRUMBLE.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_WormAttack], "WORMET3P.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Gun], "GUN.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Rocket], "ROCKET.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Bloom], "EXSAND.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream1], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream2], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream3], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream4], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream5], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Squashed], "SQUISH2.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_MachineGun], "GUNMULTI.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Sonic], "SONIC.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_RocketSmall], "MISLTINP.VOC"));
+
+	loader.run();
+
+	for(int i = 0; i < Num_Lng_Voice; i++) {
+		if(Lng_Voice[i] == NULL) {
+			fprintf(stderr,"SFXManager::LoadVoice_English: Not all voice sounds could be loaded\n");
+			exit(EXIT_FAILURE);
+		}
+	}
 }
 
 
@@ -303,17 +406,19 @@ void SFXManager::LoadVoice_NonEnglish(std::string languagePrefix) {
 		Lng_Voice[i] = NULL;
 	}
 
+	AssetLoader loader("sounds");
+	SoundPartList parts(loader);
 
-	Lng_Voice[HarvesterDeployed] = GetChunkFromFile(languagePrefix + "HARVEST.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[HarvesterDeployed], languagePrefix + "HARVEST.VOC"));
 
 	// "Contruction complete"
-	Lng_Voice[ConstructionComplete] = GetChunkFromFile(languagePrefix + "CONST.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[ConstructionComplete], languagePrefix + "CONST.VOC"));
 
 	// "Vehicle repaired"
-	Lng_Voice[VehicleRepaired] = GetChunkFromFile(languagePrefix + "REPAIR.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[VehicleRepaired], languagePrefix + "REPAIR.VOC"));
 
 	// "Frigate has arrived"
-	Lng_Voice[FrigateHasArrived] = GetChunkFromFile(languagePrefix + "FRIGATE.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[FrigateHasArrived], languagePrefix + "FRIGATE.VOC"));
 
 	// "Your mission is complete" (No non-english voc available)
 	Lng_Voice[YourMissionIsComplete] = CreateEmptyChunk();
@@ -322,95 +427,93 @@ void SFXManager::LoadVoice_NonEnglish(std::string languagePrefix) {
 	Lng_Voice[YouHaveFailedYourMission] = CreateEmptyChunk();
 
 	// "Radar activated"/"Radar deactivated"
-	Lng_Voice[RadarActivated] = GetChunkFromFile(languagePrefix + "ON.VOC");
-	Lng_Voice[RadarDeactivated] = GetChunkFromFile(languagePrefix + "OFF.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[RadarActivated], languagePrefix + "ON.VOC"));
+	loader.addTask(new SoundChunkTask(&Lng_Voice[RadarDeactivated], languagePrefix + "OFF.VOC"));
 
 	// "Bloom located"
-	Lng_Voice[BloomLocated] = GetChunkFromFile(languagePrefix + "BLOOM.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[BloomLocated], languagePrefix + "BLOOM.VOC"));
 
 	// "Warning Wormsign"
 	if(pFileManager->exists(languagePrefix + "WORMY.VOC")) {
-        Mix_Chunk* WarningChunk = GetChunkFromFile(languagePrefix + "WARNING.VOC");
-        Mix_Chunk* WormSignChunk = GetChunkFromFile(languagePrefix + "WORMY.VOC");
-        Lng_Voice[WarningWormSign] = Concat2Chunks(WarningChunk, WormSignChunk);
-        Mix_FreeChunk(WarningChunk);
-        Mix_FreeChunk(WormSignChunk);
+        parts.concat(&Lng_Voice[WarningWormSign], parts.add(languagePrefix + "WARNING.VOC"), parts.add(languagePrefix + "WORMY.VOC"));
 	} else {
-        Lng_Voice[WarningWormSign] = GetChunkFromFile(languagePrefix + "WARNING.VOC");
+        loader.addTask(new SoundChunkTask(&Lng_Voice[WarningWormSign], languagePrefix + "WARNING.VOC"));
 	}
 
     // "Our base is under attack"
-	Lng_Voice[BaseIsUnderAttack] = GetChunkFromFile(languagePrefix + "ATTACK.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[BaseIsUnderAttack], languagePrefix + "ATTACK.VOC"));
 
     // "Saboteur approaching"
-	Lng_Voice[SaboteurApproaching] = GetChunkFromFile(languagePrefix + "SABOT.VOC");
+	loader.addTask(new SoundChunkTask(&Lng_Voice[SaboteurApproaching], languagePrefix + "SABOT.VOC"));
 
     // "Missile approaching"
-	Lng_Voice[MissileApproaching] = GetChunkFromFile(languagePrefix + "MISSILE.VOC");
-
-	for(int i = 0; i < Num_Lng_Voice; i++) {
-		if(Lng_Voice[i] == NULL) {
-			fprintf(stderr,"SFXManager::LoadVoice_NonEnglish: Not all voice sounds could be loaded\n");
-			exit(EXIT_FAILURE);
-		}
-	}
+	loader.addTask(new SoundChunkTask(&Lng_Voice[MissileApproaching], languagePrefix + "MISSILE.VOC"));
 
 	// "Yes Sir"
-	SoundChunk[YesSir] = GetChunkFromFile(languagePrefix + "REPORT1.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[YesSir], languagePrefix + "REPORT1.VOC"));
 
 	// "Reporting"
-	SoundChunk[Reporting] = GetChunkFromFile(languagePrefix + "REPORT2.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Reporting], languagePrefix + "REPORT2.VOC"));
 
 	// "Acknowledged"
-	SoundChunk[Acknowledged] = GetChunkFromFile(languagePrefix + "REPORT3.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Acknowledged], languagePrefix + "REPORT3.VOC"));
 
 	// "Affirmative"
-	SoundChunk[Affirmative] = GetChunkFromFile(languagePrefix + "AFFIRM.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[Affirmative], languagePrefix + "AFFIRM.VOC"));
 
 	// "Moving out"
-	SoundChunk[MovingOut] = GetChunkFromFile(languagePrefix + "MOVEOUT.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[MovingOut], languagePrefix + "MOVEOUT.VOC"));
 
 	// "Infantry out"
-	SoundChunk[InfantryOut] = GetChunkFromFile(languagePrefix + "OVEROUT.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[InfantryOut], languagePrefix + "OVEROUT.VOC"));
 
 	// "Somthing's under the sand"
-	SoundChunk[SomethingUnderTheSand] = GetChunkFromFile("SANDBUG.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[SomethingUnderTheSand], "SANDBUG.VOC"));
 
 	// "House Atreides"
-	SoundChunk[HouseAtreides] = GetChunkFromFile(languagePrefix + "ATRE.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseAtreides], languagePrefix + "ATRE.VOC"));
 
 	// "House Ordos"
-	SoundChunk[HouseOrdos] = GetChunkFromFile(languagePrefix + "ORDOS.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseOrdos], languagePrefix + "ORDOS.VOC"));
 
 	// "House Harkonnen"
-	SoundChunk[HouseHarkonnen] = GetChunkFromFile(languagePrefix + "HARK.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[HouseHarkonnen], languagePrefix + "HARK.VOC"));
 
 	// Sfx
-	SoundChunk[PlaceStructure] = GetChunkFromFile("EXDUD.VOC");
-	SoundChunk[ButtonClick] = GetChunkFromFile("BUTTON.VOC");
-	SoundChunk[InvalidAction] = Mix_LoadWAV_RW(pFileManager->OpenFile("CANNOT.WAV"),1);
-	SoundChunk[CreditsTick] = Mix_LoadWAV_RW(pFileManager->OpenFile("CREDIT.WAV"),1);
-	SoundChunk[Tick] = Mix_LoadWAV_RW(pFileManager->OpenFile("TICK.WAV"),1);
-	SoundChunk[RadarNoise] = GetChunkFromFile("STATICP.VOC");
-	SoundChunk[Sound_ExplosionGas] = GetChunkFromFile("EXGAS.VOC");
-	SoundChunk[Sound_ExplosionTiny] = GetChunkFromFile("EXTINY.VOC");
-	SoundChunk[Sound_ExplosionSmall] = GetChunkFromFile("EXSMALL.VOC");
-	SoundChunk[Sound_ExplosionMedium] = GetChunkFromFile("EXMED.VOC");
-	SoundChunk[Sound_ExplosionLarge] = GetChunkFromFile("EXLARGE.VOC");
-	SoundChunk[Sound_ExplosionStructure] = GetChunkFromFile("CRUMBLE.VOC");
-	SoundChunk[Sound_WormAttack] = GetChunkFromFile("WORMET3P.VOC");
-	SoundChunk[Sound_Gun] = GetChunkFromFile("GUN.VOC");
-	SoundChunk[Sound_Rocket] = GetChunkFromFile("ROCKET.VOC");
-	SoundChunk[Sound_Bloom] = GetChunkFromFile("EXSAND.VOC");
-	SoundChunk[Sound_Scream1] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream2] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream3] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream4] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Scream5] = GetChunkFromFile("VSCREAM1.VOC");
-	SoundChunk[Sound_Squashed] = GetChunkFromFile("SQUISH2.VOC");
-	SoundChunk[Sound_MachineGun] = GetChunkFromFile("GUNMULTI.VOC");
-	SoundChunk[Sound_Sonic] = Mix_LoadWAV_RW(pFileManager->OpenFile("SONIC.WAV"),1);
-	SoundChunk[Sound_RocketSmall] = GetChunkFromFile("MISLTINP.VOC");
+	loader.addTask(new SoundChunkTask(&SoundChunk[PlaceStructure], "EXDUD.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[ButtonClick], "BUTTON.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[InvalidAction], "CANNOT.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[CreditsTick], "CREDIT.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Tick], "TICK.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[RadarNoise], "STATICP.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionGas], "EXGAS.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionTiny], "EXTINY.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionSmall], "EXSMALL.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionMedium], "EXMED.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionLarge], "EXLARGE.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_ExplosionStructure], "CRUMBLE.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_WormAttack], "WORMET3P.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Gun], "GUN.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Rocket], "ROCKET.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Bloom], "EXSAND.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream1], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream2], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream3], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream4], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Scream5], "VSCREAM1.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Squashed], "SQUISH2.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_MachineGun], "GUNMULTI.VOC"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_Sonic], "SONIC.WAV"));
+	loader.addTask(new SoundChunkTask(&SoundChunk[Sound_RocketSmall], "MISLTINP.VOC"));
+
+	loader.run();
+
+	for(int i = 0; i < Num_Lng_Voice; i++) {
+		if(Lng_Voice[i] == NULL) {
+			fprintf(stderr,"SFXManager::LoadVoice_NonEnglish: Not all voice sounds could be loaded\n");
+			exit(EXIT_FAILURE);
+		}
+	}
 }
 
 Mix_Chunk* SFXManager::GetVoice_NonEnglish(Voice_enum id, int house) {
@@ -120,7 +120,7 @@ SDL_Surface * Wsafile::getPicture(Uint32 FrameNumber)
 	unsigned char * Image = decodedFrames + (FrameNumber * SizeX * SizeY);
 
 	// create new picture surface
-	if((pic = SDL_CreateRGBSurface(SDL_HWSURFACE,SizeX,SizeY,8,0,0,0,0))== NULL) {
+	if((pic = SDL_CreateRGBSurface(SDL_SWSURFACE,SizeX,SizeY,8,0,0,0,0))== NULL) {
 		return NULL;
 	}
 
@@ -146,7 +146,7 @@ SDL_Surface * Wsafile::getAnimationAsPictureRow() {
 	SDL_Surface * pic;
 
 	// create new picture surface
-	if((pic = SDL_CreateRGBSurface(SDL_HWSURFACE,SizeX*NumFrames,SizeY,8,0,0,0,0))== NULL) {
+	if((pic = SDL_CreateRGBSurface(SDL_SWSURFACE,SizeX*NumFrames,SizeY,8,0,0,0,0))== NULL) {
 		return NULL;
 	}
 
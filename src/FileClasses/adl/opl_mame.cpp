@@ -1026,10 +1026,25 @@ static void OPL_UnLockTable(void) {
 /*		YM3812 local section                                                   */
 /*******************************************************************************/
 
+/* ---------- check if a channel is silent ----------- */
+/* Both slots have finished their release and will stay off until the next key on */
+inline bool OPL_CH_IS_OFF(OPL_CH *CH) {
+	return (CH->SLOT[SLOT1].evc == EG_OFF) && (CH->SLOT[SLOT1].evs == 0)
+		&& (CH->SLOT[SLOT2].evc == EG_OFF) && (CH->SLOT[SLOT2].evs == 0);
+}
+
+/* number of samples rendered channel by channel */
+#define OPL_BLOCK_SIZE 512
+
 /* ---------- update one of chip ----------- */
+/* The output is rendered in blocks: the LFO values of a block are computed first and then every channel
+   is rendered for the whole block. Channels whose slots are off are skipped. */
 void YM3812UpdateOne(FM_OPL *OPL, int16 *buffer, int length) {
+	static int amsBlock[OPL_BLOCK_SIZE];
+	static int vibBlock[OPL_BLOCK_SIZE];
+	static int mixBlock[OPL_BLOCK_SIZE];
+
 	int i;
-	int data;
 	int16 *buf = buffer;
 	uint amsCnt = OPL->amsCnt;
 	uint vibCnt = OPL->vibCnt;
@@ -1054,22 +1069,48 @@ void YM3812UpdateOne(FM_OPL *OPL, int16 *buffer, int length) {
 		vib_table = OPL->vib_table;
 	}
 	R_CH = rythm ? &S_CH[6] : E_CH;
-	for (i = 0; i < length; i++) {
-		/*            channel A         channel B         channel C      */
+	while (length > 0) {
+		int blockLength = (length < OPL_BLOCK_SIZE) ? length : OPL_BLOCK_SIZE;
+
 		/* LFO */
-		ams = ams_table[(amsCnt += amsIncr) >> AMS_SHIFT];
-		vib = vib_table[(vibCnt += vibIncr) >> VIB_SHIFT];
-		outd[0] = 0;
+		for (i = 0; i < blockLength; i++) {
+			amsBlock[i] = ams_table[(amsCnt += amsIncr) >> AMS_SHIFT];
+			vibBlock[i] = vib_table[(vibCnt += vibIncr) >> VIB_SHIFT];
+			mixBlock[i] = 0;
+		}
 		/* FM part */
-		for (CH = S_CH; CH < R_CH; CH++)
-			OPL_CALC_CH(CH);
+		for (CH = S_CH; CH < R_CH; CH++) {
+			if (OPL_CH_IS_OFF(CH)) {
+				/* nothing to render; only the feedback history runs out */
+				CH->op1_out[1] = (blockLength > 1) ? 0 : CH->op1_out[0];
+				CH->op1_out[0] = 0;
+				continue;
+			}
+			for (i = 0; i < blockLength; i++) {
+				ams = amsBlock[i];
+				vib = vibBlock[i];
+				outd[0] = 0;
+				OPL_CALC_CH(CH);
+				mixBlock[i] += outd[0];
+			}
+		}
 		/* Rythn part */
-		if (rythm)
-			OPL_CALC_RH(OPL, S_CH);
-		/* limit check */
-		data = CLIP(outd[0], OPL_MINOUT, OPL_MAXOUT);
-		/* store to sound buffer */
-		buf[i] = data >> OPL_OUTSB;
+		if (rythm) {
+			for (i = 0; i < blockLength; i++) {
+				ams = amsBlock[i];
+				vib = vibBlock[i];
+				outd[0] = 0;
+				OPL_CALC_RH(OPL, S_CH);
+				mixBlock[i] += outd[0];
+			}
+		}
+		/* limit check and store to sound buffer */
+		for (i = 0; i < blockLength; i++) {
+			buf[i] = CLIP(mixBlock[i], OPL_MINOUT, OPL_MAXOUT) >> OPL_OUTSB;
+		}
+
+		buf += blockLength;
+		length -= blockLength;
 	}
 
 	OPL->amsCnt = amsCnt;
@@ -2268,7 +2268,7 @@ const uint8 AdlibDriver::_unkTables[][32] = {
 //#pragma mark -
 
 
-SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, bool bMAME) : _driver(0), _trackEntries(), _soundDataPtr(0) {
+SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, bool bMAME) : _driver(0), _trackEntries(), _soundDataPtr(0), renderBuffer(RENDER_BUFFER_SIZE) {
 	memset(_trackEntries, 0, sizeof(_trackEntries));
 
   	Mix_QuerySpec(&m_freq, &m_format, &m_channels);
@@ -2287,7 +2287,7 @@ SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, bool bMAME) : _driver(0), _trackEntr
 	internalLoadFile(rwop);
 }
 
-SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, int freq, bool bMAME) : _driver(0), _trackEntries(), _soundDataPtr(0) {
+SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, int freq, bool bMAME) : _driver(0), _trackEntries(), _soundDataPtr(0), renderBuffer(RENDER_BUFFER_SIZE) {
 	memset(_trackEntries, 0, sizeof(_trackEntries));
 
 	m_freq = freq;
@@ -2366,6 +2366,50 @@ void SoundAdlibPC::playSoundEffect(uint8 track) {
 	play(track);
 }
 
+namespace {
+
+/**
+	Converts one sample to the output format. The sample is halved, shifted and offset to the output range and
+	the byte order is swapped if needed.
+*/
+template<typename SampleType, int shift, int offset, bool bSwap>
+inline SampleType convertSample(int16 in) {
+	Uint16 sample = (Uint16) (((in/2) >> shift) + offset);
+	return (SampleType) (bSwap ? (Uint16) ((sample << 8) | (sample >> 8)) : sample);
+}
+
+/**
+	Converts mono 16-bit samples (in system endianess) to the output format. The whole buffer is converted in one pass
+	without any branches inside the loops, so that the compiler can vectorise them.
+	\param	in			the samples to convert
+	\param	out			the output buffer
+	\param	numSamples	the number of samples per channel
+	\param	numChannels	the number of output channels; every channel gets the same sample
+*/
+template<typename SampleType, int shift, int offset, bool bSwap>
+void convertSamples(const int16* in, SampleType* out, int numSamples, int numChannels) {
+	if(numChannels == 1) {
+		for(int i=0;i<numSamples;i++) {
+			out[i] = convertSample<SampleType, shift, offset, bSwap>(in[i]);
+		}
+	} else if(numChannels == 2) {
+		for(int i=0;i<numSamples;i++) {
+			SampleType sample = convertSample<SampleType, shift, offset, bSwap>(in[i]);
+			out[2*i] = sample;
+			out[2*i+1] = sample;
+		}
+	} else {
+		for(int i=0;i<numSamples;i++) {
+			SampleType sample = convertSample<SampleType, shift, offset, bSwap>(in[i]);
+			for(int j=0;j<numChannels;j++,out++) {
+				*out = sample;
+			}
+		}
+	}
+}
+
+}
+
 void SoundAdlibPC::callback(void *userdata, Uint8 *audiobuf, int len)
 {
 	SoundAdlibPC *self = (SoundAdlibPC *)userdata;
@@ -2374,75 +2418,47 @@ void SoundAdlibPC::callback(void *userdata, Uint8 *audiobuf, int len)
 
 	int numSamples = len / (self->getsampsize());
 
-	int16* tmpBuf = (int16*) calloc(numSamples,sizeof(int16));
-	if(tmpBuf == NULL) {
-		warning("Not enough memory!");
-		return;
+	// the buffer is kept between the calls and only grows
+	if(self->renderBuffer.size() < (size_t) numSamples) {
+		self->renderBuffer.resize(numSamples);
 	}
+	int16* tmpBuf = &self->renderBuffer[0];
 
 	// write mono 16-bit signed samples (in system endianess)
-	self->_driver->readBuffer((int16*) tmpBuf, numSamples);
+	self->_driver->readBuffer(tmpBuf, numSamples);
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+	static const bool bSwapLE = false;
+	static const bool bSwapBE = true;
+#else
+	static const bool bSwapLE = true;
+	static const bool bSwapBE = false;
+#endif
 
 	// now convert to target format
 	switch(self->m_format) {
 		case AUDIO_U8: {
-			Uint8* out = audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = ((tmpBuf[i]/2) >> 8) + 0x80;
-				}
-			}
+			convertSamples<Uint8, 8, 0x80, false>(tmpBuf, (Uint8*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		case AUDIO_S8: {
-			Sint8* out = (Sint8*) audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = ((tmpBuf[i]/2) >> 8);
-				}
-			}
+			convertSamples<Sint8, 8, 0, false>(tmpBuf, (Sint8*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		case AUDIO_U16LSB: {
-			Uint16* out = (Uint16*) audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapLE16((tmpBuf[i]/2) + 0x8000);
-				}
-			}
+			convertSamples<Uint16, 0, 0x8000, bSwapLE>(tmpBuf, (Uint16*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		case AUDIO_S16LSB: {
-			Sint16* out = (Sint16*) audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapLE16(tmpBuf[i]/2);
-				}
-			}
+			convertSamples<Sint16, 0, 0, bSwapLE>(tmpBuf, (Sint16*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		case AUDIO_U16MSB: {
-			Uint16* out = (Uint16*) audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapBE16((tmpBuf[i]/2) + 0x8000);
-				}
-			}
+			convertSamples<Uint16, 0, 0x8000, bSwapBE>(tmpBuf, (Uint16*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		case AUDIO_S16MSB: {
-			Sint16* out = (Sint16*) audiobuf;
-
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapBE16(tmpBuf[i]/2);
-				}
-			}
+			convertSamples<Sint16, 0, 0, bSwapBE>(tmpBuf, (Sint16*) audiobuf, numSamples, self->m_channels);
 		} break;
 
 		default: {
@@ -2451,8 +2467,6 @@ void SoundAdlibPC::callback(void *userdata, Uint8 *audiobuf, int len)
 		}
 	}
 
-	free(tmpBuf);
-
 	self->bJustStartedPlaying = false;
 }
 
@@ -2564,17 +2578,22 @@ void SoundAdlibPC::unk2() {
 Mix_Chunk* SoundAdlibPC::getSubsong(int Num) {
 	Uint8*	buf = NULL;
 	int		bufSize = 0;
+	int		bufCapacity = 0;
 
 	playTrack(Num);
 
 	do {
-		bufSize += 1024;
-		if((buf = (Uint8*) realloc(buf, bufSize)) == NULL) {
-			perror("SoundAdlibPC::getSubsong(): Cannot allocate memory!\n");
-			exit(EXIT_FAILURE);
+		if(bufSize + 1024 > bufCapacity) {
+			// grow geometrically to avoid copying the whole buffer every 1024 bytes
+			bufCapacity = std::max(64*1024, 2*bufCapacity);
+			if((buf = (Uint8*) realloc(buf, bufCapacity)) == NULL) {
+				perror("SoundAdlibPC::getSubsong(): Cannot allocate memory!\n");
+				exit(EXIT_FAILURE);
+			}
 		}
 
-		SoundAdlibPC::callback(this, buf + bufSize - 1024, 1024);
+		SoundAdlibPC::callback(this, buf + bufSize, 1024);
+		bufSize += 1024;
 
 		if(bufSize > 1024*1024*16) {
 			fprintf(stderr,"SoundAdlibPC::getSubsong(): Decoding aborted after 16MB have been decoded.\n");
@@ -2583,8 +2602,15 @@ Mix_Chunk* SoundAdlibPC::getSubsong(int Num) {
 
 	} while(isPlaying());
 
+	// give back the unused part of the buffer
+	Uint8* shrunkBuf = (Uint8*) realloc(buf, bufSize);
+	if(shrunkBuf != NULL) {
+		buf = shrunkBuf;
+	}
+
 	Mix_Chunk* myChunk;
 	if((myChunk = (Mix_Chunk*) calloc(sizeof(Mix_Chunk),1)) == NULL) {
+		free(buf);
 		return NULL;
 	}
 
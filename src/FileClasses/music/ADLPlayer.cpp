@@ -19,17 +19,12 @@
 
 #include <globals.h>
 
-#include <FileClasses/FileManager.h>
-#include <FileClasses/adl/sound_adlib.h>
-
 #include <mmath.h>
 
-ADLPlayer::ADLPlayer() : MusicPlayer() {
+ADLPlayer::ADLPlayer() : MusicPlayer(), trackCache(MAX_MUSIC_MEMORY) {
     musicVolume = MIX_MAX_VOLUME/2;
     Mix_VolumeMusic(musicVolume);
 
-    pSoundAdlibPC = NULL;
-
 	currentMusicNum = 0;
 }
 
@@ -191,19 +186,11 @@ void ADLPlayer::changeMusic(MUSICTYPE musicType)
 	if((musicOn == true) && (filename != "")) {
 
         Mix_HookMusic(NULL, NULL);
-	    delete pSoundAdlibPC;
 
-	    SDL_RWops* rwop = pFileManager->OpenFile(filename);
-	    if(rwop == NULL) {
+	    if(trackCache.play(filename, musicNum) == false) {
             printf("Unable to load %s!\n",filename.c_str());
 	    } else {
-            pSoundAdlibPC = new SoundAdlibPC(rwop);
-
-            SDL_RWclose(rwop);
-
-            pSoundAdlibPC->playTrack(musicNum);
-
-            Mix_HookMusic(pSoundAdlibPC->callback, pSoundAdlibPC);
+            Mix_HookMusic(ADLTrackCache::callback, &trackCache);
 
             //printf("Now playing %s!\n",filename.c_str());
 	    }
@@ -212,7 +199,11 @@ void ADLPlayer::changeMusic(MUSICTYPE musicType)
 
 void ADLPlayer::musicCheck() {
 	if(musicOn) {
-		if(pSoundAdlibPC->isPlaying() == false) {
+	    SDL_LockAudio();
+	    bool bPlaying = trackCache.isPlaying();
+	    SDL_UnlockAudio();
+
+		if(bPlaying == false) {
 			changeMusic(MUSIC_PEACE);
 		}
 	}
@@ -226,8 +217,7 @@ void ADLPlayer::setMusic(bool value) {
 	} else {
 	    Mix_HookMusic(NULL, NULL);
 
-	    delete pSoundAdlibPC;
-	    pSoundAdlibPC = NULL;
+	    trackCache.stop();
 	}
 }
 
@@ -242,3 +232,10 @@ void ADLPlayer::toggleSound()
 		setMusic(false);
 	}
 }
+
+size_t ADLPlayer::getMemoryUsage() {
+    SDL_LockAudio();
+    size_t memoryUsage = trackCache.getMemoryUsage();
+    SDL_UnlockAudio();
+    return memoryUsage;
+}
@@ -0,0 +1,243 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/music/ADLTrackCache.h>
+
+#include <globals.h>
+
+#include <FileClasses/FileManager.h>
+#include <FileClasses/adl/sound_adlib.h>
+
+#include <SDL_mixer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+ADLTrackCache::ADLTrackCache(size_t maxMemory) {
+	pCurrentTrack = NULL;
+	position = 0;
+	pRenderTrack = NULL;
+	pRenderer = NULL;
+	memoryUsage = 0;
+	this->maxMemory = maxMemory;
+
+	int frequency;
+	int channels;
+	format = AUDIO_S16SYS;
+	Mix_QuerySpec(&frequency, &format, &channels);
+}
+
+ADLTrackCache::~ADLTrackCache() {
+	while(tracks.empty() == false) {
+		removeTrack(tracks.front());
+	}
+}
+
+bool ADLTrackCache::play(const std::string& filename, int trackNum) {
+	stop();
+
+	Track* pTrack = NULL;
+	std::list<Track*>::iterator iter;
+	for(iter = tracks.begin(); iter != tracks.end(); ++iter) {
+		if(((*iter)->filename == filename) && ((*iter)->trackNum == trackNum)) {
+			pTrack = *iter;
+			break;
+		}
+	}
+
+	if((pTrack != NULL) && (pTrack->bKeep == false)) {
+		// the beginning of this track is already freed
+		removeTrack(pTrack);
+		pTrack = NULL;
+	}
+
+	if((pRenderTrack != NULL) && (pRenderTrack != pTrack)) {
+		// only one track can be rendered at a time
+		removeTrack(pRenderTrack);
+	}
+
+	if(pTrack == NULL) {
+		SDL_RWops* rwop = pFileManager->OpenFile(filename);
+		if(rwop == NULL) {
+			return false;
+		}
+
+		pRenderer = new SoundAdlibPC(rwop);
+		SDL_RWclose(rwop);
+		pRenderer->playTrack(trackNum);
+
+		pTrack = new Track();
+		pTrack->filename = filename;
+		pTrack->trackNum = trackNum;
+		pTrack->length = 0;
+		pTrack->bFinished = false;
+		pTrack->bKeep = true;
+		pRenderTrack = pTrack;
+	} else {
+		tracks.remove(pTrack);
+	}
+
+	tracks.push_front(pTrack);
+	pCurrentTrack = pTrack;
+	position = 0;
+
+	shrink();
+
+	return true;
+}
+
+void ADLTrackCache::stop() {
+	if((pCurrentTrack != NULL) && (pCurrentTrack->bKeep == false)) {
+		removeTrack(pCurrentTrack);
+	}
+
+	pCurrentTrack = NULL;
+	position = 0;
+}
+
+bool ADLTrackCache::isPlaying() const {
+	return (pCurrentTrack != NULL) && ((pCurrentTrack->bFinished == false) || (position < pCurrentTrack->length));
+}
+
+void ADLTrackCache::read(Uint8* buffer, int len) {
+	int offset = 0;
+	while((offset < len) && (pCurrentTrack != NULL)) {
+		if(position >= pCurrentTrack->length) {
+			if(pCurrentTrack->bFinished == true) {
+				break;
+			}
+
+			// the current track is not finished, so it is the one being rendered
+			renderChunk();
+			continue;
+		}
+
+		size_t blockIndex = position / BLOCK_SIZE;
+		size_t blockOffset = position % BLOCK_SIZE;
+		size_t numBytes = std::min((size_t) (len - offset), std::min(BLOCK_SIZE - blockOffset, pCurrentTrack->length - position));
+
+		memcpy(buffer + offset, pCurrentTrack->blocks[blockIndex] + blockOffset, numBytes);
+		offset += numBytes;
+		position += numBytes;
+
+		if((pCurrentTrack->bKeep == false) && (blockOffset + numBytes == (size_t) BLOCK_SIZE)) {
+			// this block will not be played again
+			free(pCurrentTrack->blocks[blockIndex]);
+			pCurrentTrack->blocks[blockIndex] = NULL;
+			memoryUsage -= BLOCK_SIZE;
+		}
+	}
+
+	fillSilence(buffer + offset, len - offset);
+}
+
+void ADLTrackCache::callback(void* userdata, Uint8* audiobuf, int len) {
+	ADLTrackCache* pCache = (ADLTrackCache*) userdata;
+	pCache->read(audiobuf, len);
+}
+
+void ADLTrackCache::renderChunk() {
+	size_t blockOffset = pRenderTrack->length % BLOCK_SIZE;
+	if(blockOffset == 0) {
+		Uint8* pBlock = (Uint8*) malloc(BLOCK_SIZE);
+		if(pBlock == NULL) {
+			perror("ADLTrackCache::renderChunk(): Cannot allocate memory!\n");
+			exit(EXIT_FAILURE);
+		}
+
+		pRenderTrack->blocks.push_back(pBlock);
+		memoryUsage += BLOCK_SIZE;
+	}
+
+	SoundAdlibPC::callback(pRenderer, pRenderTrack->blocks.back() + blockOffset, RENDER_CHUNK_SIZE);
+	pRenderTrack->length += RENDER_CHUNK_SIZE;
+	bool bFinished = (pRenderer->isPlaying() == false);
+
+	if((pRenderTrack->bKeep == true) && (pRenderTrack->length > maxMemory)) {
+		// this track is too long to be kept; renderChunk() is only called for the current track so the blocks before position are played already
+		pRenderTrack->bKeep = false;
+		for(size_t i = 0; i < position / BLOCK_SIZE; i++) {
+			free(pRenderTrack->blocks[i]);
+			pRenderTrack->blocks[i] = NULL;
+			memoryUsage -= BLOCK_SIZE;
+		}
+	}
+
+	if(bFinished == true) {
+		pRenderTrack->bFinished = true;
+		pRenderTrack = NULL;
+		delete pRenderer;
+		pRenderer = NULL;
+	}
+}
+
+void ADLTrackCache::removeTrack(Track* pTrack) {
+	std::vector<Uint8*>::const_iterator iter;
+	for(iter = pTrack->blocks.begin(); iter != pTrack->blocks.end(); ++iter) {
+		if(*iter != NULL) {
+			free(*iter);
+			memoryUsage -= BLOCK_SIZE;
+		}
+	}
+
+	if(pTrack == pRenderTrack) {
+		pRenderTrack = NULL;
+		delete pRenderer;
+		pRenderer = NULL;
+	}
+
+	if(pTrack == pCurrentTrack) {
+		pCurrentTrack = NULL;
+		position = 0;
+	}
+
+	tracks.remove(pTrack);
+	delete pTrack;
+}
+
+void ADLTrackCache::shrink() {
+	while(memoryUsage > maxMemory) {
+		Track* pLeastRecentlyPlayed = tracks.back();
+		if(pLeastRecentlyPlayed == pCurrentTrack) {
+			break;
+		}
+
+		removeTrack(pLeastRecentlyPlayed);
+	}
+}
+
+void ADLTrackCache::fillSilence(Uint8* buffer, int len) const {
+	switch(format) {
+		case AUDIO_U8: {
+			memset(buffer, 0x80, len);
+		} break;
+
+		case AUDIO_U16LSB:
+		case AUDIO_U16MSB: {
+			Uint16 silence = (format == AUDIO_U16LSB) ? SDL_SwapLE16(0x8000) : SDL_SwapBE16(0x8000);
+			for(int i = 0; i + 1 < len; i += 2) {
+				memcpy(buffer + i, &silence, 2);
+			}
+		} break;
+
+		default: {
+			memset(buffer, 0, len);
+		} break;
+	}
+}
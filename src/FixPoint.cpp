@@ -0,0 +1,150 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FixPoint.h>
+
+#include <cmath>
+
+const int FixPoint::FRACTION_BITS;
+const Sint32 FixPoint::ONE;
+
+/*
+	The tables are hard-coded and not calculated at startup because sin() and atan() may return slightly different
+	results on different platforms.
+*/
+
+/// sin(i/64 * PI/2) * 65536 for the first quarter of the circle
+static const Sint32 sinTable[65] = {
+	0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+	25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+	46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581, 54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+	60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+	65536
+};
+
+/// atan(i/64) * 256/(2*PI) * 65536, i.e. the angle in game units
+static const Sint32 atanTable[65] = {
+	0, 41718, 83416, 125073, 166669, 208185, 249600, 290894, 332050, 373047, 413869, 454496, 494912, 535100, 575043, 614727,
+	654136, 693257, 732076, 770579, 808756, 846595, 884085, 921217, 957981, 994370, 1030375, 1065990, 1101209, 1136026, 1170436, 1204436,
+	1238021, 1271189, 1303938, 1336265, 1368170, 1399652, 1430711, 1461346, 1491559, 1521350, 1550722, 1579676, 1608214, 1636338, 1664052, 1691359,
+	1718262, 1744764, 1770869, 1796582, 1821906, 1846846, 1871405, 1895590, 1919403, 1942851, 1965938, 1988668, 2011047, 2033080, 2054772, 2076127,
+	2097152
+};
+
+/**
+	Looks up x in table with linear interpolation.
+	\param	table	a table with 65 entries
+	\param	x		the position in the table multiplied by ONE (0 to 64*ONE)
+	\return	the interpolated value
+*/
+static inline Sint32 interpolate(const Sint32* table, Sint32 x) {
+	int index = x >> FixPoint::FRACTION_BITS;
+	if(index >= 64) {
+		return table[64];
+	}
+	Sint32 fraction = x & (FixPoint::ONE - 1);
+	return table[index] + (Sint32) (((Sint64) (table[index+1] - table[index]) * fraction) >> FixPoint::FRACTION_BITS);
+}
+
+/**
+	Calculates the integer square root of x.
+	\param	x	the number to calculate the square root of
+	\return	the square root rounded down
+*/
+static Uint32 isqrt(Uint64 x) {
+	Uint64 result = 0;
+	Uint64 bit = ((Uint64) 1) << 62;
+
+	while(bit > x) {
+		bit >>= 2;
+	}
+
+	while(bit != 0) {
+		if(x >= result + bit) {
+			x -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (Uint32) result;
+}
+
+FixPoint FixPoint::fromDouble(double x) {
+	return fromRaw((Sint32) floor(x * ONE + 0.5));
+}
+
+FixPoint FixPoint::sqrt(const FixPoint& x) {
+	if(x.value <= 0) {
+		return FixPoint();
+	}
+
+	return fromRaw((Sint32) isqrt(((Uint64) x.value) << FRACTION_BITS));
+}
+
+FixPoint FixPoint::hypot(const FixPoint& x, const FixPoint& y) {
+	Uint64 x2 = (Uint64) ((Sint64) x.value * x.value);
+	Uint64 y2 = (Uint64) ((Sint64) y.value * y.value);
+
+	return fromRaw((Sint32) isqrt(x2 + y2));
+}
+
+FixPoint FixPoint::sin(const FixPoint& angle) {
+	// reduce to [0;256) and then to the first quarter
+	Sint32 a = angle.value & (256*ONE - 1);
+	int quarter = a / (64*ONE);
+	Sint32 x = a % (64*ONE);
+
+	switch(quarter) {
+		case 0:		return fromRaw(interpolate(sinTable, x));
+		case 1:		return fromRaw(interpolate(sinTable, 64*ONE - x));
+		case 2:		return fromRaw(-interpolate(sinTable, x));
+		default:	return fromRaw(-interpolate(sinTable, 64*ONE - x));
+	}
+}
+
+FixPoint FixPoint::cos(const FixPoint& angle) {
+	return sin(angle + 64);
+}
+
+FixPoint FixPoint::atan2(const FixPoint& y, const FixPoint& x) {
+	if((x.value == 0) && (y.value == 0)) {
+		return FixPoint();
+	}
+
+	Sint64 absX = (x.value < 0) ? -((Sint64) x.value) : x.value;
+	Sint64 absY = (y.value < 0) ? -((Sint64) y.value) : y.value;
+
+	// the angle in the first octant
+	Sint32 octantAngle;
+	if(absY <= absX) {
+		octantAngle = interpolate(atanTable, (Sint32) ((absY * 64 * ONE) / absX));
+	} else {
+		octantAngle = 64*ONE - interpolate(atanTable, (Sint32) ((absX * 64 * ONE) / absY));
+	}
+
+	Sint32 result;
+	if(x.value >= 0) {
+		result = (y.value >= 0) ? octantAngle : 256*ONE - octantAngle;
+	} else {
+		result = (y.value >= 0) ? 128*ONE - octantAngle : 128*ONE + octantAngle;
+	}
+
+	return fromRaw(result & (256*ONE - 1));
+}
@@ -0,0 +1,186 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FogOfWar.h>
+
+#include <MapClass.h>
+
+#include <algorithm>
+#include <stdlib.h>
+
+FogOfWar::FogOfWar(MapClass* pMap) {
+    this->pMap = pMap;
+    sizeX = pMap->sizeX;
+    sizeY = pMap->sizeY;
+    wordsPerRow = (sizeX + 31) / 32;
+
+    exploredBits.assign(MAX_PLAYERS*sizeY*wordsPerRow, 0);
+    visibleBits.assign(MAX_PLAYERS*sizeY*wordsPerRow, 0);
+    lastSeen.assign(MAX_PLAYERS*sizeY*sizeX, 0);
+}
+
+FogOfWar::~FogOfWar() {
+}
+
+void FogOfWar::load(Stream& stream) {
+    for(unsigned int i = 0; i < exploredBits.size(); i++) {
+        exploredBits[i] = stream.readUint32();
+    }
+
+    for(unsigned int i = 0; i < visibleBits.size(); i++) {
+        visibleBits[i] = stream.readUint32();
+    }
+
+    for(unsigned int i = 0; i < lastSeen.size(); i++) {
+        lastSeen[i] = stream.readUint32();
+    }
+
+    pendingReveals.clear();
+    Uint32 numReveals = stream.readUint32();
+    for(Uint32 i = 0; i < numReveals; i++) {
+        Reveal r;
+        r.cycle = stream.readUint32();
+        r.houseMask = stream.readUint32();
+        r.x = stream.readSint32();
+        r.y = stream.readSint32();
+        r.radius = stream.readSint32();
+        pendingReveals.push_back(r);
+    }
+}
+
+void FogOfWar::save(Stream& stream) const {
+    for(unsigned int i = 0; i < exploredBits.size(); i++) {
+        stream.writeUint32(exploredBits[i]);
+    }
+
+    for(unsigned int i = 0; i < visibleBits.size(); i++) {
+        stream.writeUint32(visibleBits[i]);
+    }
+
+    for(unsigned int i = 0; i < lastSeen.size(); i++) {
+        stream.writeUint32(lastSeen[i]);
+    }
+
+    stream.writeUint32(pendingReveals.size());
+    for(std::deque<Reveal>::const_iterator iter = pendingReveals.begin(); iter != pendingReveals.end(); ++iter) {
+        stream.writeUint32(iter->cycle);
+        stream.writeUint32(iter->houseMask);
+        stream.writeSint32(iter->x);
+        stream.writeSint32(iter->y);
+        stream.writeSint32(iter->radius);
+    }
+}
+
+void FogOfWar::reveal(Uint32 houseMask, const Coord& location, int radius, Uint32 cycle) {
+    if((houseMask == 0) || (radius < 0)) {
+        return;
+    }
+
+    const std::vector<int>& halfWidths = pMap->getCircleStamp(radius);
+
+    int minY = std::max(location.y - radius, 0);
+    int maxY = std::min(location.y + radius, sizeY - 1);
+
+    for(int houseID = 0; houseID < MAX_PLAYERS; houseID++) {
+        if((houseMask & (1 << houseID)) == 0) {
+            continue;
+        }
+
+        for(int y = minY; y <= maxY; y++) {
+            int halfWidth = halfWidths[abs(y - location.y)];
+            int minX = std::max(location.x - halfWidth, 0);
+            int maxX = std::min(location.x + halfWidth, sizeX - 1);
+            if(minX > maxX) {
+                continue;
+            }
+
+            std::vector<Uint32>::iterator rowIter = lastSeen.begin() + (houseID*sizeY + y)*sizeX;
+            std::fill(rowIter + minX, rowIter + maxX + 1, cycle);
+
+            int firstWord = minX >> 5;
+            int lastWord = maxX >> 5;
+            int rowIndex = (houseID*sizeY + y)*wordsPerRow;
+            for(int word = firstWord; word <= lastWord; word++) {
+                Uint32 mask = ~((Uint32) 0);
+                if(word == firstWord) {
+                    mask &= mask << (minX & 31);
+                }
+                if(word == lastWord) {
+                    mask &= ~((Uint32) 0) >> (31 - (maxX & 31));
+                }
+
+                // visible tiles are always explored, so only tiles that are not visible yet change their look
+                Uint32 changedTiles = mask & ~visibleBits[rowIndex + word];
+                exploredBits[rowIndex + word] |= mask;
+                visibleBits[rowIndex + word] |= mask;
+
+                for(int bit = 0; changedTiles != 0; bit++, changedTiles >>= 1) {
+                    if(changedTiles & 1) {
+                        pMap->journalRadarChange(Coord(word*32 + bit, y));
+                    }
+                }
+            }
+        }
+    }
+
+    Reveal r;
+    r.cycle = cycle;
+    r.houseMask = houseMask;
+    r.x = location.x;
+    r.y = location.y;
+    r.radius = radius;
+    pendingReveals.push_back(r);
+}
+
+void FogOfWar::update(Uint32 cycle) {
+    while((pendingReveals.empty() == false) && (cycle - pendingReveals.front().cycle >= FOGTIMEOUT)) {
+        expire(pendingReveals.front(), cycle);
+        pendingReveals.pop_front();
+    }
+}
+
+void FogOfWar::expire(const Reveal& r, Uint32 cycle) {
+    const std::vector<int>& halfWidths = pMap->getCircleStamp(r.radius);
+
+    int minY = std::max(r.y - r.radius, 0);
+    int maxY = std::min(r.y + r.radius, sizeY - 1);
+
+    for(int houseID = 0; houseID < MAX_PLAYERS; houseID++) {
+        if((r.houseMask & (1 << houseID)) == 0) {
+            continue;
+        }
+
+        for(int y = minY; y <= maxY; y++) {
+            int halfWidth = halfWidths[abs(y - r.y)];
+            int minX = std::max(r.x - halfWidth, 0);
+            int maxX = std::min(r.x + halfWidth, sizeX - 1);
+
+            for(int x = minX; x <= maxX; x++) {
+                if(cycle - lastSeen[(houseID*sizeY + y)*sizeX + x] < FOGTIMEOUT) {
+                    // seen again since r
+                    continue;
+                }
+
+                Uint32& word = visibleBits[getWordIndex(houseID, x, y)];
+                if(word & getBit(x)) {
+                    word &= ~getBit(x);
+                    pMap->journalRadarChange(Coord(x, y));
+                }
+            }
+        }
+    }
+}
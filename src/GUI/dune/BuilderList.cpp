@@ -240,14 +240,7 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 				// draw price
 				char text[50];
 				sprintf(text, "%d", iter->price);
-				SDL_Surface* textSurface = pFontManager->createSurfaceWithText(text, COLOR_WHITE, FONT_STD10);
-				SDL_Rect drawLocation;
-				drawLocation.x = dest.x + 2;
-				drawLocation.y = dest.y + BUILDERBTN_HEIGHT - textSurface->h + 3;
-				drawLocation.w = textSurface->w;
-				drawLocation.h = textSurface->h;
-				SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-				SDL_FreeSurface(textSurface);
+				pFontManager->drawText(screen, text, COLOR_WHITE, FONT_STD10, dest.x + 2, dest.y + BUILDERBTN_HEIGHT - pFontManager->getTextHeight(FONT_STD10) + 3);
 
 				if(pStarport != NULL) {
 				    bool soldOut = (pStarport->getOwner()->getChoam().getNumAvailable(iter->ItemID) == 0);
@@ -266,7 +259,7 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 					}
 
 					if(soldOut == true) {
-						SDL_Surface* textSurface = pFontManager->createSurfaceWithMultilineText(pTextManager->getLocalized("SOLD OUT"), COLOR_WHITE, FONT_STD10, true);
+						SDL_Surface* textSurface = pFontManager->getCachedSurfaceWithMultilineText(pTextManager->getLocalized("SOLD OUT"), COLOR_WHITE, FONT_STD10, true);
 
 						SDL_Rect drawLocation;
 						drawLocation.x = dest.x + (BUILDERBTN_WIDTH - textSurface->w)/2;
@@ -275,7 +268,6 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 						drawLocation.h = textSurface->h;
 
 						SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-						SDL_FreeSurface(textSurface);
 					}
 
 				} else if(iter->ItemID == Structure_Palace && pBuilder->getOwner()->getNumItems(Structure_Palace) > 0) {
@@ -290,7 +282,7 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
                             SDL_UnlockSurface(screen);
                     }
 
-                    SDL_Surface* textSurface = pFontManager->createSurfaceWithMultilineText(pTextManager->getLocalized("ALREADY\nBUILT"), COLOR_WHITE, FONT_STD10, true);
+                    SDL_Surface* textSurface = pFontManager->getCachedSurfaceWithMultilineText(pTextManager->getLocalized("ALREADY\nBUILT"), COLOR_WHITE, FONT_STD10, true);
 
                     SDL_Rect drawLocation;
                     drawLocation.x = dest.x + (BUILDERBTN_WIDTH - textSurface->w)/2;
@@ -299,9 +291,8 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
                     drawLocation.h = textSurface->h;
 
                     SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-                    SDL_FreeSurface(textSurface);
 				} else if(iter->ItemID == pBuilder->GetCurrentProducedItem()) {
-					double progress = pBuilder->GetProductionProgress();
+					double progress = pBuilder->GetProductionProgress().toDouble();
 					double price = (double) iter->price;
 					int max_x = lround((progress/price)*(double)BUILDERBTN_WIDTH);
 
@@ -317,7 +308,7 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 					}
 
 					if(pBuilder->IsWaitingToPlace() == true) {
-						SDL_Surface* textSurface = pFontManager->createSurfaceWithMultilineText(pTextManager->getLocalized("PLACE IT"), COLOR_WHITE, FONT_STD10, true);
+						SDL_Surface* textSurface = pFontManager->getCachedSurfaceWithMultilineText(pTextManager->getLocalized("PLACE IT"), COLOR_WHITE, FONT_STD10, true);
 
 						SDL_Rect drawLocation;
 						drawLocation.x = dest.x + (BUILDERBTN_WIDTH - textSurface->w)/2;
@@ -326,9 +317,8 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 						drawLocation.h = textSurface->h;
 
 						SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-						SDL_FreeSurface(textSurface);
 					} else if(pBuilder->IsOnHold() == true) {
-						SDL_Surface* textSurface = pFontManager->createSurfaceWithMultilineText(pTextManager->getLocalized("ON HOLD"), COLOR_WHITE, FONT_STD10, true);
+						SDL_Surface* textSurface = pFontManager->getCachedSurfaceWithMultilineText(pTextManager->getLocalized("ON HOLD"), COLOR_WHITE, FONT_STD10, true);
 
 						SDL_Rect drawLocation;
 						drawLocation.x = dest.x + (BUILDERBTN_WIDTH - textSurface->w)/2;
@@ -337,20 +327,14 @@ void BuilderList::Draw(SDL_Surface* screen, Point Position) {
 						drawLocation.h = textSurface->h;
 
 						SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-						SDL_FreeSurface(textSurface);
 					}
 				}
 
 				if(iter->num > 0) {
 					// draw number of this in build list
 					sprintf(text, "%d", iter->num);
-					textSurface = pFontManager->createSurfaceWithText(text, COLOR_RED, FONT_STD10);
-					drawLocation.x = dest.x + BUILDERBTN_WIDTH - textSurface->w - 2;
-					drawLocation.y = dest.y + BUILDERBTN_HEIGHT - textSurface->h + 3;
-					drawLocation.w = textSurface->w;
-					drawLocation.h = textSurface->h;
-					SDL_BlitSurface(textSurface, NULL, screen, &drawLocation);
-					SDL_FreeSurface(textSurface);
+					pFontManager->drawText(screen, text, COLOR_RED, FONT_STD10, dest.x + BUILDERBTN_WIDTH - pFontManager->getTextWidth(text, FONT_STD10) - 2,
+                                           dest.y + BUILDERBTN_HEIGHT - pFontManager->getTextHeight(FONT_STD10) + 3);
 				}
 			}
 		}
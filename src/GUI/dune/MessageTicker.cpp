@@ -76,7 +76,7 @@ void MessageTicker::Draw(SDL_Surface* screen, Point Position) {
 		if(timer>0)
 			textLocation.y -= SLOWDOWN;
 
-		SDL_Surface *surface = pFontManager->createSurfaceWithText(Messages.front(), COLOR_BLACK, FONT_STD12);
+		SDL_Surface *surface = pFontManager->getCachedSurfaceWithText(Messages.front(), COLOR_BLACK, FONT_STD12);
 
 		SDL_Rect cut;
 		cut.x = 0;
@@ -88,6 +88,5 @@ void MessageTicker::Draw(SDL_Surface* screen, Point Position) {
 		cut.h = surface->h - cut.y;
 		cut.w = surface->w;
 		SDL_BlitSurface(surface, &cut, screen, &textLocation);
-		SDL_FreeSurface(surface);
 	};
 }
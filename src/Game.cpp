@@ -27,6 +27,8 @@
 #include <FileClasses/music/MusicPlayer.h>
 #include <SoundPlayer.h>
 #include <misc/FileStream.h>
+#include <misc/MemoryStream.h>
+#include <misc/lz_util.h>
 #include <misc/fnkdat.h>
 #include <misc/draw_util.h>
 #include <misc/string_util.h>
@@ -40,6 +42,8 @@
 
 #include <House.h>
 #include <MapClass.h>
+#include <TerrainCache.h>
+#include <FogOfWar.h>
 #include <BulletClass.h>
 #include <Explosion.h>
 #include <GameInitSettings.h>
@@ -57,6 +61,8 @@
 #include <iomanip>
 #include <SDL.h>
 
+#define REPLAY_SNAPSHOTS_TAG    0x31504E53      // "SNP1"
+
 
 Game::Game() {
 	whatNextParam = GAME_NOTHING;
@@ -121,7 +127,13 @@ Game::Game() {
 	GameCycleCount = 0;
 	SkipToGameCycle = 0;
 
+	bTakeReplaySnapshots = false;
+	replaySeekCycle = 0;
+
 	fps = 0;
+	drawTime = 0.0;
+	drawTimeSum = 0;
+	numDrawTimeFrames = 0;
 	debug = false;
 
 	powerIndicatorPos.x = 14;
@@ -149,31 +161,40 @@ Game::~Game() {
     delete pInterface;
     pInterface = NULL;
 
-    for(RobustList<StructureClass*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
-        delete *iter;
+    while(structureList.empty() == false) {
+        StructureClass* pStructure = *structureList.begin();
+        structureList.remove(pStructure);
+        delete pStructure;
     }
-    structureList.clear();
 
-    for(RobustList<UnitClass*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
-        delete *iter;
+    while(unitList.empty() == false) {
+        UnitClass* pUnit = *unitList.begin();
+        unitList.remove(pUnit);
+        delete pUnit;
     }
-    unitList.clear();
 
-	for(RobustList<BulletClass*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
-	    delete *iter;
-	}
-	bulletList.clear();
+    while(bulletList.empty() == false) {
+        BulletClass* pBullet = *bulletList.begin();
+        bulletList.remove(pBullet);
+        delete pBullet;
+    }
 
-    for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
-	    delete *iter;
-	}
-	explosionList.clear();
+    while(explosionList.empty() == false) {
+        Explosion* pExplosion = *explosionList.begin();
+        explosionList.remove(pExplosion);
+        delete pExplosion;
+    }
 
 	for(int i=0;i<MAX_PLAYERS;i++) {
 		delete house[i];
 		house[i] = NULL;
 	}
 
+	// all objects are deleted now, so the pools can give their memory back
+	ObjectClass::getMemoryPool().reset();
+	BulletClass::getMemoryPool().reset();
+	Explosion::getMemoryPool().reset();
+
 	delete currentGameMap;
 	currentGameMap = NULL;
 	delete screenborder;
@@ -183,7 +204,7 @@ Game::~Game() {
 }
 
 
-void Game::initGame(const GameInitSettings& newGameInitSettings) {
+void Game::initGame(const GameInitSettings& newGameInitSettings, bool bShowBriefing) {
     gameInitSettings = newGameInitSettings;
 
     switch(gameInitSettings.getGameType()) {
@@ -208,7 +229,7 @@ void Game::initGame(const GameInitSettings& newGameInitSettings) {
             GameINILoader* pGameINILoader = new GameINILoader(this, gameInitSettings.getFilename());
             delete pGameINILoader;
 
-            if(bReplay == false && gameInitSettings.getGameType() != GAMETYPE_CUSTOM) {
+            if(bShowBriefing == true && bReplay == false && gameInitSettings.getGameType() != GAMETYPE_CUSTOM) {
                 /* do briefing */
                 fprintf(stdout,"Briefing...");
                 fflush(stdout);
@@ -226,13 +247,13 @@ void Game::initGame(const GameInitSettings& newGameInitSettings) {
     }
 }
 
-void Game::initReplay(const std::string& filename) {
+void Game::initReplay(const std::string& filename, Uint32 startCycle) {
     bReplay = true;
 
 	FileStream fs;
 
 	if(fs.open(filename, "rb") == false) {
-		perror("Game::loadSaveGame()");
+		perror("Game::initReplay()");
 		exit(EXIT_FAILURE);
 	}
 
@@ -242,7 +263,57 @@ void Game::initReplay(const std::string& filename) {
 	// load all commands
 	CmdManager.load(fs);
 
-	initGame(loadedGameInitSettings);
+	// read the snapshot index and the last snapshot at or before startCycle
+	std::vector<Uint8> snapshot;
+	Uint32 snapshotLength = 0;
+	try {
+		if(fs.readUint32() == REPLAY_SNAPSHOTS_TAG) {
+			Uint32 numSnapshots = fs.readUint32();
+			std::vector<Uint32> compressedLengths(numSnapshots);
+			replaySnapshots.resize(numSnapshots);
+			for(Uint32 i = 0; i < numSnapshots; i++) {
+				replaySnapshots[i].cycle = fs.readUint32();
+				replaySnapshots[i].length = fs.readUint32();
+				compressedLengths[i] = fs.readUint32();
+			}
+
+			int snapshotIndex = -1;
+			for(Uint32 i = 0; i < numSnapshots; i++) {
+				if(replaySnapshots[i].cycle <= startCycle) {
+					snapshotIndex = i;
+				}
+			}
+
+			// the snapshots are stored in the order of the index
+			for(int i = 0; i <= snapshotIndex; i++) {
+				snapshot.resize(compressedLengths[i]);
+				if(snapshot.empty() == false) {
+					fs.readBytes(&snapshot[0], snapshot.size());
+				}
+				snapshotLength = replaySnapshots[i].length;
+			}
+		}
+	} catch (Stream::exception& e) {
+		// replays of older versions have no snapshots
+		replaySnapshots.clear();
+		snapshot.clear();
+	}
+
+	if(snapshot.empty() == false) {
+		std::vector<Uint8> state(snapshotLength);
+		if((snapshotLength == 0) || (lzDecompress(&snapshot[0], snapshot.size(), &state[0], state.size()) == false)) {
+			fprintf(stderr,"Game::initReplay(): The snapshot in %s is corrupt\n", filename.c_str());
+			exit(EXIT_FAILURE);
+		}
+
+		MemoryStream ms;
+		ms.open((const char*) &state[0], state.size());
+		loadGameState(ms, false);
+	} else {
+		initGame(loadedGameInitSettings);
+	}
+
+	SkipToGameCycle = startCycle;
 
 	// fs is closed by its destructor
 }
@@ -257,15 +328,11 @@ void Game::ProcessObjects()
 	// Update the windtrap palette animation
 	pGFXManager->DoWindTrapPalatteAnimation();
 
-	// update all tiles
-    for(int y = 0; y < currentGameMap->sizeY; y++) {
-		for(int x = 0; x < currentGameMap->sizeX; x++) {
-            currentGameMap->cell[x][y].update();
-		}
-	}
+	// update all tiles with tracks or dead units
+	currentGameMap->updateActiveTiles();
 
 
-    for(RobustList<StructureClass*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(IntrusiveList<StructureClass>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureClass* tempStructure = *iter;
         tempStructure->update();
     }
@@ -274,16 +341,16 @@ void Game::ProcessObjects()
 		currentCursorMode = CursorMode_Normal;
 	}
 
-	for(RobustList<UnitClass*>::iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+	for(IntrusiveList<UnitClass>::iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
 		UnitClass* tempUnit = *iter;
 		tempUnit->update();
 	}
 
-    for(RobustList<BulletClass*>::iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+    for(IntrusiveList<BulletClass>::iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
         (*iter)->update();
 	}
 
-    for(RobustList<Explosion*>::iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+    for(IntrusiveList<Explosion>::iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
         (*iter)->update();
 	}
 }
@@ -298,112 +365,25 @@ void Game::drawScreen()
 	/* clear whole screen */
 	SDL_FillRect(screen,NULL,0);
 
-    Coord TopLeftTile = screenborder->getTopLeftTile();
-    Coord BottomRightTile = screenborder->getBottomRightTile();
-
     // extend the view a little bit to avoid graphical glitches
-    TopLeftTile.x = std::max(0, TopLeftTile.x - 1);
-    TopLeftTile.y = std::max(0, TopLeftTile.y - 1);
-    BottomRightTile.x = std::min(currentGameMap->sizeX-1, BottomRightTile.x + 1);
-    BottomRightTile.y = std::min(currentGameMap->sizeY-1, BottomRightTile.y + 1);
-
-    Coord currentTile;
-
-    /* draw ground */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitGround( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                      screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
-
-    /* draw structures */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitStructures( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                          screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
-
-    /* draw underground units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitUndergroundUnits( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                                screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
-
-    /* draw dead objects */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitDeadUnits( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                         screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
-
-    /* draw infantry */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitInfantry( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                        screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
+    Coord TopLeftTile = screenborder->getTopLeftTile() - Coord(1,1);
+    Coord BottomRightTile = screenborder->getBottomRightTile() + Coord(1,1);
 
-    /* draw non-infantry ground units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
+    currentGameMap->getTerrainCache()->draw(TopLeftTile, BottomRightTile);
 
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
+    renderList.build(TopLeftTile, BottomRightTile);
 
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitNonInfantryGroundUnits( screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                                      screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
+    renderList.draw(RenderList::Layer_Structures);
+    renderList.draw(RenderList::Layer_UndergroundUnits);
+    renderList.draw(RenderList::Layer_DeadUnits);
+    renderList.draw(RenderList::Layer_Infantry);
+    renderList.draw(RenderList::Layer_NonInfantryGroundUnits);
 
 	/* draw bullets */
-    for(RobustList<BulletClass*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+    for(IntrusiveList<BulletClass>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
         BulletClass* pBullet = *iter;
 
-		if(screenborder->isInsideScreen( Coord( (int) pBullet->getRealX(), (int) pBullet->getRealY()), pBullet->getImageSize()))
+		if(screenborder->isInsideScreen( Coord( pBullet->getRealX().toInt(), pBullet->getRealY().toInt()), pBullet->getImageSize()))
 		{
 			if(debug) {
 				pBullet->blitToScreen();
@@ -412,8 +392,8 @@ void Game::drawScreen()
 //				int ypos = (int) (*iter)->getRealY()/BLOCKSIZE;
 
 //				if( (currentGameMap->cellExists(xpos,ypos)) &&
-//					(currentGameMap->cell[xpos][ypos].isExplored(pLocalHouse->getPlayerNumber())
-//					|| !currentGameMap->cell[xpos][ypos].isFogged(pLocalHouse->getPlayerNumber()))) {
+//					(currentGameMap->getCell(xpos, ypos)->isExplored(pLocalHouse->getPlayerNumber())
+//					|| !currentGameMap->getCell(xpos, ypos)->isFogged(pLocalHouse->getPlayerNumber()))) {
 					pBullet->blitToScreen();
 //                }
 			}
@@ -422,117 +402,16 @@ void Game::drawScreen()
 
 
 	/* draw explosions */
-	for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+	for(IntrusiveList<Explosion>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
         (*iter)->blitToScreen();
 	}
 
-    /* draw air units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-//				if(debug || cell->isExplored(pLocalHouse->getPlayerNumber())) {
-					cell->blitAirUnits(   screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                          screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-//				}
-			}
-		}
-	}
-
-    /* draw selection rectangles */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->cellExists(currentTile))	{
-				TerrainClass* cell = &currentGameMap->cell[currentTile.x][currentTile.y];
-
-				if(debug || cell->isExplored(pLocalHouse->getHouseID())) {
-					cell->blitSelectionRects(   screenborder->world2screenX(currentTile.x*BLOCKSIZE),
-                                                screenborder->world2screenY(currentTile.y*BLOCKSIZE));
-				}
-			}
-		}
-	}
-
+    renderList.draw(RenderList::Layer_AirUnits);
+    renderList.draw(RenderList::Layer_SelectionRects);
 
 //////////////////////////////draw unexplored/shade
 
-	if(debug == false) {
-		source.y = 0;
-		source.w = source.h = drawLocation.w = drawLocation.h = BLOCKSIZE;
-		for(int x = screenborder->getTopLeftTile().x - 1; x <= screenborder->getBottomRightTile().x + 1; x++) {
-			for (int y = screenborder->getTopLeftTile().y - 1; y <= screenborder->getBottomRightTile().y + 1; y++) {
-
-				if((x >= 0) && (x < currentGameMap->sizeX) && (y >= 0) && (y < currentGameMap->sizeY)) {
-					TerrainClass* cell = &currentGameMap->cell[x][y];
-
-					if(cell->isExplored(pLocalHouse->getHouseID())) {
-					    int hideTile = cell->getHideTile(pLocalHouse->getHouseID());
-
-						if(hideTile != 0) {
-						    SDL_Surface* hiddenSurf = pGFXManager->getObjPic(ObjPic_Terrain_Hidden);
-
-							source.x = hideTile*BLOCKSIZE;
-							drawLocation.x = screenborder->world2screenX(x*BLOCKSIZE);
-							drawLocation.y = screenborder->world2screenY(y*BLOCKSIZE);
-							SDL_BlitSurface(hiddenSurf, &source, screen, &drawLocation);
-						}
-
-						if(gameInitSettings.hasFogOfWar() == true) {
-                            int fogTile = cell->getFogTile(pLocalHouse->getHouseID());
-
-                            if(cell->isFogged(pLocalHouse->getHouseID()) == true) {
-                                fogTile = Terrain_HiddenFull;
-                            }
-
-                            if(fogTile != 0) {
-                                source.x = fogTile*BLOCKSIZE;
-                                drawLocation.x = screenborder->world2screenX(x*BLOCKSIZE);
-                                drawLocation.y = screenborder->world2screenY(y*BLOCKSIZE);
-
-                                SDL_Rect mini = {0, 0, 1, 1};
-                                SDL_Rect drawLoc = {drawLocation.x, drawLocation.y, 0, 0};
-
-                                SDL_Surface* hiddenSurf = pGFXManager->getObjPic(ObjPic_Terrain_Hidden);
-                                SDL_Surface* fogSurf = pGFXManager->getTransparent40Surface();
-
-                                SDL_LockSurface(hiddenSurf);
-                                for(int i=0;i<BLOCKSIZE; i++) {
-                                    for(int j=0;j<BLOCKSIZE; j++) {
-                                        if(getpixel(hiddenSurf,source.x+i,source.y+j) == 12) {
-                                            drawLoc.x = drawLocation.x + i;
-                                            drawLoc.y = drawLocation.y + j;
-                                            SDL_BlitSurface(fogSurf,&mini,screen,&drawLoc);
-                                        }
-                                    }
-                                }
-                                SDL_UnlockSurface(hiddenSurf);
-
-
-                            }
-						}
-					} else {
-					    if(!debug) {
-					        SDL_Surface* hiddenSurf = pGFXManager->getObjPic(ObjPic_Terrain_Hidden);
-                            source.x = BLOCKSIZE*15;
-                            drawLocation.x = screenborder->world2screenX(x*BLOCKSIZE);
-                            drawLocation.y = screenborder->world2screenY(y*BLOCKSIZE);
-                            SDL_BlitSurface(hiddenSurf, &source, screen, &drawLocation);
-					    }
-					}
-				} else {
-                    // we are outside the map => draw complete hidden
-                    SDL_Surface* hiddenSurf = pGFXManager->getObjPic(ObjPic_Terrain_Hidden);
-                    source.x = BLOCKSIZE*15;
-                    drawLocation.x = screenborder->world2screenX(x*BLOCKSIZE);
-                    drawLocation.y = screenborder->world2screenY(y*BLOCKSIZE);
-                    SDL_BlitSurface(hiddenSurf, &source, screen, &drawLocation);
-				}
-			}
-		}
-	}
+    renderList.draw(RenderList::Layer_Shade);
 
 /////////////draw placement position
 
@@ -627,30 +506,37 @@ void Game::drawScreen()
 	pInterface->Draw(screen, Point(0,0));
 	pInterface->DrawOverlay(screen, Point(0,0));
 
-	SDL_Surface* surface;
-
 /////////draw radar
     radarView->draw();
 
 	// draw chat message currently typed
 	if(chatMode) {
-        surface = pFontManager->createSurfaceWithText("Chat: " + typingChatMessage + (((SDL_GetTicks() / 150) % 2 == 0) ? "_" : ""), COLOR_WHITE, FONT_STD12);
-        drawLocation.x = 20;
-        drawLocation.y = screen->h - 40;
-        SDL_BlitSurface(surface, NULL, screen, &drawLocation);
-        SDL_FreeSurface(surface);
+        pFontManager->drawText(screen, "Chat: " + typingChatMessage + (((SDL_GetTicks() / 150) % 2 == 0) ? "_" : ""), COLOR_WHITE, FONT_STD12, 20, screen->h - 40);
 	}
 
 	if(bShowFPS) {
 		char	temp[50];
-		snprintf(temp,50,"fps: %.2f ",fps);
+		snprintf(temp,50,"fps: %.2f  draw: %.1f ms ",fps,drawTime);
+
+		pFontManager->drawText(screen, temp, COLOR_WHITE, FONT_STD12, screen->w - pFontManager->getTextWidth(temp, FONT_STD12), 0);
+
+		// if the number of heap allocations does not increase during a battle all objects come from the pools
+		const MemoryPool* pools[] = { &ObjectClass::getMemoryPool(), &BulletClass::getMemoryPool(), &Explosion::getMemoryPool() };
+		int numObjects = 0;
+		int numAllocations = 0;
+		int numHeapAllocations = 0;
+		for(int i = 0; i < 3; i++) {
+			numObjects += pools[i]->getNumBlocksInUse();
+			numAllocations += pools[i]->getNumAllocations();
+			numHeapAllocations += pools[i]->getNumHeapAllocations();
+		}
+		snprintf(temp,50,"objects: %d  allocs: %d  heap: %d ",numObjects,numAllocations,numHeapAllocations);
 
-		SDL_Surface* fpsSurface = pFontManager->createSurfaceWithText(temp, COLOR_WHITE, FONT_STD12);
+		pFontManager->drawText(screen, temp, COLOR_WHITE, FONT_STD12, screen->w - pFontManager->getTextWidth(temp, FONT_STD12), pFontManager->getTextHeight(FONT_STD12));
 
-		drawLocation.x = screen->w - fpsSurface->w;
-		drawLocation.y = 0;
-		SDL_BlitSurface(fpsSurface, NULL, screen, &drawLocation);
-		SDL_FreeSurface(fpsSurface);
+		snprintf(temp,50,"music: %d KB ",(int) (musicPlayer->getMemoryUsage() / 1024));
+
+		pFontManager->drawText(screen, temp, COLOR_WHITE, FONT_STD12, screen->w - pFontManager->getTextWidth(temp, FONT_STD12), 2*pFontManager->getTextHeight(FONT_STD12));
 	}
 
 	if(bShowTime) {
@@ -658,12 +544,7 @@ void Game::drawScreen()
 		int     seconds = GetGameTime() / 1000;
 		snprintf(temp,50," %.2d:%.2d:%.2d", seconds / 3600, (seconds % 3600)/60, (seconds % 60) );
 
-		SDL_Surface* timeSurface = pFontManager->createSurfaceWithText(temp, COLOR_WHITE, FONT_STD12);
-
-		drawLocation.x = 0;
-		drawLocation.y = screen->h - timeSurface->h;
-		SDL_BlitSurface(timeSurface, NULL, screen, &drawLocation);
-		SDL_FreeSurface(timeSurface);
+		pFontManager->drawText(screen, temp, COLOR_WHITE, FONT_STD12, 0, screen->h - pFontManager->getTextHeight(FONT_STD12));
 	}
 
 	//show ingame menu
@@ -680,7 +561,7 @@ void Game::drawScreen()
 			message = pTextManager->getLocalized("Paused");
 		}
 
-		surface = pFontManager->createSurfaceWithText(message.c_str(), COLOR_WHITE, FONT_STD24);
+		SDL_Surface* surface = pFontManager->getCachedSurfaceWithText(message, COLOR_WHITE, FONT_STD24);
 
 		drawLocation.x = screen->w/2 - surface->w/2;
 		drawLocation.y = screen->h/2 - surface->h/2;
@@ -688,7 +569,6 @@ void Game::drawScreen()
 		drawLocation.h = surface->h;
 
 		SDL_BlitSurface(surface, NULL, screen, &drawLocation);
-		SDL_FreeSurface(surface);
 	}
 
 	if(pInGameMenu != NULL) {
@@ -782,7 +662,7 @@ void Game::doInput()
                                 } else if((bCheatsEnabled == true) && (md5string == "0xCEF1D26CE4B145DE985503CA35232ED8")) {
                                     if (gameType != GAMETYPE_CUSTOM_MULTIPLAYER) {
                                         pInterface->getChatManager().addInfoMessage("You got some credits");
-                                        pLocalHouse->returnCredits(10000.0);
+                                        pLocalHouse->returnCredits(10000);
                                     }
                                 } else {
                                     pInterface->getChatManager().addChatMessage(typingChatMessage, settings.General.PlayerName);
@@ -910,14 +790,22 @@ void Game::doInput()
                                 OnOptions();
                             } break;
 
+                            case SDLK_F4: {
+                                // go back 2 minutes
+                                if(bReplay == true) {
+                                    Uint32 backCycles = (120*1000)/GAMESPEED_DEFAULT;
+                                    seekReplay((GameCycleCount > backCycles) ? GameCycleCount - backCycles : 0);
+                                }
+                            } break;
+
                             case SDLK_F5: {
                                 // skip a 30 seconds
-                                SkipToGameCycle = GameCycleCount + (30*1000)/GAMESPEED_DEFAULT;
+                                seekReplay(GameCycleCount + (30*1000)/GAMESPEED_DEFAULT);
                             } break;
 
                             case SDLK_F6: {
                                 // skip 2 minutes
-                                SkipToGameCycle = GameCycleCount + (120*1000)/GAMESPEED_DEFAULT;
+                                seekReplay(GameCycleCount + (120*1000)/GAMESPEED_DEFAULT);
                             } break;
 
                             case SDLK_F10: {
@@ -1248,7 +1136,7 @@ void Game::doInput()
                                     indicatorFrame = 0;
 
                                     //let unit handle right click on map or target
-                                    double speedCap = -1.0;
+                                    FixPoint speedCap = -1;
                                     ObjectClass	*responder = NULL;
                                     ObjectClass	*tempObject = NULL;
 
@@ -1265,7 +1153,7 @@ void Game::doInput()
 
                                             //find slowest speed of all units
                                             if( (SDL_GetModState() & KMOD_SHIFT) && tempObject->isAUnit()
-                                                 && ((speedCap < 0.0) || (((UnitClass*)tempObject)->getMaxSpeed() < speedCap))) {
+                                                 && ((speedCap < 0) || (((UnitClass*)tempObject)->getMaxSpeed() < speedCap))) {
                                                 speedCap = ((UnitClass*)tempObject)->getMaxSpeed();
                                             }
                                         }
@@ -1355,7 +1243,7 @@ void Game::doInput()
                                         duneTextIndex = DuneText_IsPercentFullAndHarvesting;
                                     }
 
-                                    int percent = lround(pHarvester->getAmountOfSpice() * 100.0 / (double) HARVESTERMAXSPICE);
+                                    int percent = lround(pHarvester->getAmountOfSpice().toDouble() * 100.0 / (double) HARVESTERMAXSPICE);
                                     if(percent > 0) {
                                         harvesterMessage += strprintf(pTextManager->getDuneText(duneTextIndex).c_str(), percent);
                                     } else {
@@ -1531,7 +1419,7 @@ void Game::setupView()
 	//setup start location/view
 	i = j = count = 0;
 
-    RobustList<UnitClass*>::const_iterator unitIterator;
+    IntrusiveList<UnitClass>::const_iterator unitIterator;
 	for(unitIterator = unitList.begin(); unitIterator != unitList.end(); ++unitIterator) {
 		UnitClass* pUnit = *unitIterator;
 		if(pUnit->getOwner() == pLocalHouse) {
@@ -1541,7 +1429,7 @@ void Game::setupView()
 		}
 	}
 
-    RobustList<StructureClass*>::const_iterator structureIterator;
+    IntrusiveList<StructureClass>::const_iterator structureIterator;
 	for(structureIterator = structureList.begin(); structureIterator != structureList.end(); ++structureIterator) {
 		StructureClass* pStructure = *structureIterator;
 		if(pStructure->getOwner() == pLocalHouse) {
@@ -1613,6 +1501,9 @@ void Game::runMainLoop()
 
 		// flush stream
 		pStream->flush();
+
+		// the named replay saved when the game is won contains snapshots to seek in it
+		bTakeReplaySnapshots = true;
 	}
 
 	int		frameStart = SDL_GetTicks();
@@ -1624,7 +1515,16 @@ void Game::runMainLoop()
 //	try
 //	{
 		do {
+			Uint32 drawStart = SDL_GetTicks();
 			drawScreen();
+			drawTimeSum += SDL_GetTicks() - drawStart;
+
+			// SDL_GetTicks() only has a resolution of 1ms => average over a few frames
+			if(++numDrawTimeFrames >= DRAWTIME_FRAMES) {
+				drawTime = ((double) drawTimeSum)/((double) numDrawTimeFrames);
+				drawTimeSum = 0;
+				numDrawTimeFrames = 0;
+			}
 
 			SDL_Flip(screen);
 			frameEnd = SDL_GetTicks();
@@ -1663,41 +1563,7 @@ void Game::runMainLoop()
 
 				if(!finished && !bPause)	{
 				    radarView->update();
-					CmdManager.executeCommands(GameCycleCount);
-
-                    /*
-					if((GameCycleCount % 10) == 0) {
-                        char tmp[20];
-                        sprintf(tmp, "cycle%d.dls", GameCycleCount);
-                        saveGame(tmp);
-					}//*/
-
-                    if((GameCycleCount % 50) == 0) {
-                        // add every 100 gamecycles one test sync command
-                        if(bReplay == false) {
-                            CmdManager.addCommand(Command(CMD_TEST_SYNC, RandomGen.getSeed()));
-                        }
-                    }
-
-					for (int i = 0; i < MAX_PLAYERS; i++) {
-						if (house[i] != NULL) {
-							house[i]->update();
-						}
-					}
-
-					triggerManager.trigger(GameCycleCount);
-
-					ProcessObjects();
-
-					if ((indicatorFrame != NONE) && (--indicatorTimer <= 0)) {
-						indicatorTimer = indicatorTime;
-
-						if (++indicatorFrame > 2) {
-							indicatorFrame = NONE;
-						}
-					}
-
-                    GameCycleCount++;
+					processGameCycle(NULL);
 				}
 
                 if(GameCycleCount <= SkipToGameCycle) {
@@ -1728,9 +1594,10 @@ void Game::runMainLoop()
 		std::string replayname(tmp);
 
 		FileStream* pStream = new FileStream();
-		pStream->open(replayname.c_str(), "wb");
+		pStream->open(replayname.c_str(), "wb", true);
 		gameInitSettings.save(*pStream);
-		CmdManager.save(*pStream);
+		CmdManager.save(*pStream, true);
+		saveReplaySnapshots(*pStream);
         delete pStream;
 	}
 
@@ -1739,6 +1606,108 @@ void Game::runMainLoop()
 	fflush(stdout);
 }
 
+Uint32 Game::runHeadless(Uint32 maxCycles, clock_t* pSubsystemTimes)
+{
+	finished = false;
+	bPause = false;
+	won = false;
+	gameState = BEGUN;
+	finishedLevel = false;
+
+	// Check if a player has lost
+	for(int j = 0; j < MAX_PLAYERS; j++) {
+		if(house[j] != NULL) {
+			if(!house[j]->isAlive()) {
+				house[j]->lose();
+			}
+		}
+	}
+
+	if(bReplay) {
+		CmdManager.setReadOnly(true);
+	}
+
+	Uint32 startCycle = GameCycleCount;
+	while(!finished && !bQuitGame && (GameCycleCount - startCycle < maxCycles)) {
+		processGameCycle(pSubsystemTimes);
+	}
+
+	gameState = DEINITIALIZE;
+
+	return GameCycleCount - startCycle;
+}
+
+/**
+	Adds the time since lastTime to the time of the specified subsystem and sets lastTime to the current time.
+	\param	pSubsystemTimes	the times of all subsystems or NULL if nothing shall be measured
+	\param	subsystem		the subsystem that was processed since lastTime
+	\param	lastTime		the time the subsystem was started
+*/
+static inline void addSubsystemTime(clock_t* pSubsystemTimes, int subsystem, clock_t& lastTime) {
+	if(pSubsystemTimes != NULL) {
+		clock_t currentTime = clock();
+		pSubsystemTimes[subsystem] += currentTime - lastTime;
+		lastTime = currentTime;
+	}
+}
+
+void Game::processGameCycle(clock_t* pSubsystemTimes)
+{
+	clock_t lastTime = (pSubsystemTimes != NULL) ? clock() : 0;
+
+	if(bTakeReplaySnapshots && (GameCycleCount != 0) && ((GameCycleCount % REPLAY_SNAPSHOT_INTERVAL) == 0)) {
+		// a snapshot is taken before the commands of this cycle are executed, like a save game
+		takeReplaySnapshot();
+	}
+
+	CmdManager.executeCommands(GameCycleCount);
+
+	/*
+	if((GameCycleCount % 10) == 0) {
+		char tmp[20];
+		sprintf(tmp, "cycle%d.dls", GameCycleCount);
+		saveGame(tmp);
+	}//*/
+
+	if((GameCycleCount % 50) == 0) {
+		// add every 100 gamecycles one test sync command
+		if(bReplay == false) {
+			CmdManager.addCommand(Command(CMD_TEST_SYNC, RandomGen.getSeed()));
+		}
+	}
+
+	addSubsystemTime(pSubsystemTimes, Subsystem_Commands, lastTime);
+
+	for (int i = 0; i < MAX_PLAYERS; i++) {
+		if (house[i] != NULL) {
+			house[i]->update();
+		}
+	}
+
+	addSubsystemTime(pSubsystemTimes, Subsystem_Houses, lastTime);
+
+	triggerManager.trigger(GameCycleCount);
+
+	addSubsystemTime(pSubsystemTimes, Subsystem_Triggers, lastTime);
+
+	ProcessObjects();
+
+	addSubsystemTime(pSubsystemTimes, Subsystem_Objects, lastTime);
+
+	if ((indicatorFrame != NONE) && (--indicatorTimer <= 0)) {
+		indicatorTimer = indicatorTime;
+
+		if (++indicatorFrame > 2) {
+			indicatorFrame = NONE;
+		}
+	}
+
+	GameCycleCount++;
+
+	// fog all tiles that have not been seen for FOGTIMEOUT cycles
+	currentGameMap->getFogOfWar()->update(GameCycleCount);
+}
+
 /**
     This method resumes the current paused game.
 */
@@ -1824,8 +1793,9 @@ GameInitSettings Game::getNextGameInitSettings()
     GAME_LOAD			 - from inside the game the user requests to load a savegame and you should do this now<br>
     GAME_DEBRIEFING_WIN  - show debriefing (player has won) and call whatNext() again afterwards<br>
     GAME_DEBRIEFING_LOST - show debriefing (player has lost) and call whatNext() again afterwards<br>
+    GAME_REPLAY_SEEK     - the replay shall be restarted at getReplaySeekCycle()<br>
     <br>
-    \return one of GAME_RETURN_TO_MENU, GAME_NEXTMISSION, GAME_LOAD, GAME_DEBRIEFING_WIN, GAME_DEBRIEFING_LOST
+    \return one of GAME_RETURN_TO_MENU, GAME_NEXTMISSION, GAME_LOAD, GAME_DEBRIEFING_WIN, GAME_DEBRIEFING_LOST, GAME_REPLAY_SEEK
 */
 int Game::whatNext()
 {
@@ -1886,10 +1856,6 @@ int Game::whatNext()
 */
 bool Game::loadSaveGame(std::string filename)
 {
-	short	mapSizeX, mapSizeY;
-	int		i, x;
-	Coord		source, destination;
-
 	FileStream fs;
 
 	if(fs.open(filename.c_str(), "rb") == false) {
@@ -1897,8 +1863,6 @@ bool Game::loadSaveGame(std::string filename)
 		exit(EXIT_FAILURE);
 	}
 
-	gameState = LOADING;
-
 	Uint32 magicNum = fs.readUint32();
 	if (magicNum != SAVEMAGIC) {
 		fprintf(stderr,"Game::loadSaveGame(): No valid savegame: %s\n",filename.c_str());
@@ -1913,6 +1877,22 @@ bool Game::loadSaveGame(std::string filename)
 
 	std::string duneVersion = fs.readString();
 
+	// CommandManager is at the very end of the file. DO NOT CHANGE THIS!
+	loadGameState(fs, true);
+
+	fs.close();
+	finished = false;
+
+	return true;
+}
+
+void Game::loadGameState(Stream& fs, bool bLoadCommands)
+{
+	short	mapSizeX, mapSizeY;
+	int		i, x;
+
+	gameState = LOADING;
+
 	//read map size
 	mapSizeX = fs.readUint32();
 	mapSizeY = fs.readUint32();
@@ -1977,13 +1957,9 @@ bool Game::loadSaveGame(std::string filename)
     // load triggers
     triggerManager.load(fs);
 
-    // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
-	CmdManager.load(fs);
-
-	fs.close();
-	finished = false;
-
-	return true;
+    if(bLoadCommands == true) {
+        CmdManager.load(fs);
+    }
 }
 
 /**
@@ -1994,11 +1970,10 @@ bool Game::loadSaveGame(std::string filename)
 bool Game::saveGame(std::string filename)
 {
 	char	temp[256];
-	int	i;
 
 	FileStream fs;
 
-	if( fs.open(filename.c_str(), "wb") == false) {
+	if( fs.open(filename.c_str(), "wb", true) == false) {
 		perror("Game::saveGame()");
 		sprintf(temp, "Game NOT saved: Cannot open \"%s\".", filename.c_str());
 		currentGame->AddToNewsTicker(temp);
@@ -2011,6 +1986,18 @@ bool Game::saveGame(std::string filename)
 
 	fs.writeString("Dune Legacy " VERSION);
 
+    // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
+	saveGameState(fs, true);
+
+	fs.close();
+
+	return true;
+}
+
+void Game::saveGameState(Stream& fs, bool bSaveCommands)
+{
+	int	i;
+
 	//write the map size
 	fs.writeUint32(currentGameMap->sizeX);
 	fs.writeUint32(currentGameMap->sizeY);
@@ -2050,12 +2037,12 @@ bool Game::saveGame(std::string filename)
 	objectManager.save(fs);
 
 	fs.writeUint32(bulletList.size());
-	for(RobustList<BulletClass*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+	for(IntrusiveList<BulletClass>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
 		(*iter)->save(fs);
 	}
 
 	fs.writeUint32(explosionList.size());
-	for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+	for(IntrusiveList<Explosion>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
 		(*iter)->save(fs);
 	}
 
@@ -2075,12 +2062,67 @@ bool Game::saveGame(std::string filename)
     // save triggers
 	triggerManager.save(fs);
 
-    // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
-	CmdManager.save(fs);
+    if(bSaveCommands == true) {
+        CmdManager.save(fs);
+    }
+}
 
-	fs.close();
+void Game::takeReplaySnapshot()
+{
+	MemoryStream ms;
+	ms.open();
+	saveGameState(ms, false);
+
+	ReplaySnapshot snapshot;
+	snapshot.cycle = GameCycleCount;
+	snapshot.length = ms.getDataLength();
+	replaySnapshots.push_back(snapshot);
+	lzCompress((const Uint8*) ms.getData(), ms.getDataLength(), replaySnapshots.back().data);
+}
 
-	return true;
+void Game::saveReplaySnapshots(Stream& stream)
+{
+	stream.writeUint32(REPLAY_SNAPSHOTS_TAG);
+	stream.writeUint32(replaySnapshots.size());
+
+	std::vector<ReplaySnapshot>::const_iterator iter;
+	for(iter = replaySnapshots.begin(); iter != replaySnapshots.end(); ++iter) {
+		stream.writeUint32(iter->cycle);
+		stream.writeUint32(iter->length);
+		stream.writeUint32(iter->data.size());
+	}
+
+	for(iter = replaySnapshots.begin(); iter != replaySnapshots.end(); ++iter) {
+		if(iter->data.empty() == false) {
+			stream.writeBytes(&iter->data[0], iter->data.size());
+		}
+	}
+}
+
+void Game::seekReplay(Uint32 cycle)
+{
+	if(bReplay == false) {
+		SkipToGameCycle = cycle;
+		return;
+	}
+
+	// the snapshot initReplay() would restore
+	Uint32 snapshotCycle = 0;
+	std::vector<ReplaySnapshot>::const_iterator iter;
+	for(iter = replaySnapshots.begin(); iter != replaySnapshots.end(); ++iter) {
+		if((iter->cycle <= cycle) && (iter->cycle > snapshotCycle)) {
+			snapshotCycle = iter->cycle;
+		}
+	}
+
+	if((cycle < GameCycleCount) || (snapshotCycle > GameCycleCount)) {
+		// restart the replay from the snapshot
+		replaySeekCycle = cycle;
+		whatNextParam = GAME_REPLAY_SEEK;
+		quit_Game();
+	} else {
+		SkipToGameCycle = cycle;
+	}
 }
 
 /**
@@ -176,7 +176,7 @@ void GameINILoader::loadMap() {
                         break;
                 }
 
-                currentGameMap->cell[i][j].setType(type);
+                currentGameMap->getCell(i, j)->setType(type);
             }
 
         }
@@ -194,7 +194,7 @@ void GameINILoader::loadMap() {
                     int xpos = getXPos(BloomPos);
                     int ypos = getYPos(BloomPos);
                     if(currentGameMap->cellExists(xpos,ypos) && currentGameMap->getCell(xpos,ypos)->getType() == Terrain_Sand) {
-                        currentGameMap->cell[xpos][ypos].setType(Terrain_SpiceBloom);
+                        currentGameMap->getCell(xpos, ypos)->setType(Terrain_SpiceBloom);
                     } else {
                         fprintf(stderr,"GameINILoader::loadMap(): Cannot set bloom at %d, %d\n",xpos, ypos);
                     }
@@ -214,7 +214,7 @@ void GameINILoader::loadMap() {
                     int xpos = getXPos(SpecialPos);
                     int ypos = getYPos(SpecialPos);
                     if(currentGameMap->cellExists(xpos,ypos) && currentGameMap->getCell(xpos,ypos)->getType() == Terrain_Sand) {
-                        currentGameMap->cell[xpos][ypos].setType(Terrain_SpecialBloom);
+                        currentGameMap->getCell(xpos, ypos)->setType(Terrain_SpecialBloom);
                     } else {
                         fprintf(stderr,"GameINILoader::loadMap(): Cannot set special at %d, %d\n",xpos, ypos);
                     }
@@ -313,7 +313,7 @@ void GameINILoader::loadMap() {
                     } break;
                 }
 
-                currentGameMap->cell[x][y].setType(type);
+                currentGameMap->getCell(x, y)->setType(type);
             }
         }
 
@@ -508,7 +508,7 @@ void GameINILoader::loadUnits()
             }
 		}
 
-		double percentHealth = std::min(((double) atol(health.c_str())) / 256.0, 1.0);
+		FixPoint percentHealth = FixPoint::fromFraction(std::min((int) atol(health.c_str()), 256), 256);
 
 		ATTACKMODE attackmode = getAttackModeByName(mode);
 		if(attackmode == ATTACKMODE_INVALID) {
@@ -520,7 +520,7 @@ void GameINILoader::loadUnits()
 			if(newUnit == NULL) {
 				fprintf(stderr, "GameINILoader::loadUnits(): Invalid or occupied position: %d!\n", pos);
 			} else {
-			    newUnit->setHealth(lround(newUnit->getMaxHealth() * percentHealth));
+			    newUnit->setHealth((newUnit->getMaxHealth() * percentHealth).roundToInt());
                 newUnit->DoSetAttackMode(attackmode);
 			}
 		}
@@ -576,7 +576,7 @@ void GameINILoader::loadStructures()
 				throw std::runtime_error("GameINILoader::loadStructures(): Invalid house string: " + HouseStr);
 			}
 
-			double percentHealth = std::min(((double) atol(health.c_str())) / 256.0, 1.0);
+			FixPoint percentHealth = FixPoint::fromFraction(std::min((int) atol(health.c_str()), 256), 256);
 
 			int itemID = getItemIDByName(BuildingStr);
 
@@ -589,7 +589,7 @@ void GameINILoader::loadStructures()
 				if(newStructure == NULL) {
 					fprintf(stderr,"GameINILoader::loadStructures(): Invalid or occupied position: %s\n",PosStr.c_str());
 				} else {
-				    newStructure->setHealth(lround(newStructure->getMaxHealth() * percentHealth));
+				    newStructure->setHealth((newStructure->getMaxHealth() * percentHealth).roundToInt());
 				}
 			}
 		}
@@ -185,14 +185,14 @@ void House::setProducedPower(int newPower)
 
 
 
-void House::addCredits(double newCredits, bool wasRefined)
+void House::addCredits(FixPoint newCredits, bool wasRefined)
 {
-	if (newCredits > 0.0) {
+	if (newCredits > 0) {
 	    if(wasRefined == true) {
-                harvestedSpice += newCredits;
+                harvestedSpice += newCredits.toDouble();
 	    }
 
-		storedCredits += newCredits;
+		storedCredits += newCredits.toDouble();
 		if (this == pLocalHouse)	{
 			if(((currentGame->winFlags & WINLOSEFLAGS_QUOTA) != 0) && (quota != 0))	{
 				if(storedCredits >= quota) {
@@ -206,33 +206,33 @@ void House::addCredits(double newCredits, bool wasRefined)
 
 
 
-void House::returnCredits(double newCredits)
+void House::returnCredits(FixPoint newCredits)
 {
-	if(newCredits > 0.0) {
-		startingCredits += newCredits;
+	if(newCredits > 0) {
+		startingCredits += newCredits.toDouble();
 	}
 }
 
 
 
 
-double House::takeCredits(double amount)
+FixPoint House::takeCredits(FixPoint amount)
 {
-	double	taken = 0.0;
+	FixPoint taken = 0;
 
 	if(getCredits() >= 1) {
-		if(storedCredits > amount) {
+		if(storedCredits > amount.toDouble()) {
 			taken = amount;
-			storedCredits -= amount;
+			storedCredits -= amount.toDouble();
 		} else {
-			taken = storedCredits;
+			taken = FixPoint::fromDouble(storedCredits);
 			storedCredits = 0.0;
 
-			if(startingCredits > (amount - taken)) {
-				startingCredits -= (amount - taken);
+			if(startingCredits > (amount - taken).toDouble()) {
+				startingCredits -= (amount - taken).toDouble();
 				taken = amount;
 			} else {
-				taken += startingCredits;
+				taken += FixPoint::fromDouble(startingCredits);
 				startingCredits = 0.0;
 			}
 		}
@@ -272,7 +272,7 @@ void House::printStat() const {
 
 void House::checkSelectionLists()
 {
-    RobustList<StructureClass*>::const_iterator iter;
+    IntrusiveList<StructureClass>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 		StructureClass* tempStructure = *iter;
         if(tempStructure->isABuilder() && (tempStructure->getOwner() == this)) {
@@ -307,7 +307,7 @@ void House::update()
 	powerUsageTimer--;
 	if(powerUsageTimer <= 0) {
 	    powerUsageTimer = MILLI2CYCLES(15*1000);
-        takeCredits(((double)getPowerRequirement()) / 32.0);
+        takeCredits(FixPoint::fromFraction(getPowerRequirement(), 32));
 	}
 
 	choam.update();
@@ -348,7 +348,7 @@ void House::decrementUnits(int itemID)
 
 
 
-void House::incrementStructures(int itemID)
+void House::incrementStructures(int itemID, StructureClass* pStructure)
 {
 	numStructures++;
 	numItem[itemID]++;
@@ -382,14 +382,14 @@ void House::incrementStructures(int itemID)
 
     std::list<std::shared_ptr<Player> >::iterator iter;
     for(iter = players.begin(); iter != players.end(); ++iter) {
-        (*iter)->onIncrementStructures(itemID);
+        (*iter)->onIncrementStructures(itemID, pStructure);
     }
 }
 
 
 
 
-void House::decrementStructures(int itemID, const Coord& location)
+void House::decrementStructures(int itemID, const Coord& location, StructureClass* pStructure)
 {
 	numStructures--;
     numItem[itemID]--;
@@ -419,7 +419,7 @@ void House::decrementStructures(int itemID, const Coord& location)
 
     std::list<std::shared_ptr<Player> >::iterator iter;
     for(iter = players.begin(); iter != players.end(); ++iter) {
-        (*iter)->onDecrementStructures(itemID, location);
+        (*iter)->onDecrementStructures(itemID, location, pStructure);
     }
 }
 
@@ -525,7 +525,7 @@ void House::freeHarvester(int xPos, int yPos)
 
 		Carryall* carryall = (Carryall*)createUnit(Unit_Carryall);
 		HarvesterClass* harvester = (HarvesterClass*)createUnit(Unit_Harvester);
-		harvester->setAmountOfSpice(5.0);
+		harvester->setAmountOfSpice(5);
 		carryall->setOwned(false);
 		carryall->giveCargo(harvester);
 		carryall->deploy(closestPos);
@@ -663,7 +663,7 @@ StructureClass* House::placeStructure(Uint32 builderID, int itemID, int xPos, in
 
                 if(itemID == Structure_Palace) {
                     // cancel all other palaces
-                    for(RobustList<StructureClass*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+                    for(IntrusiveList<StructureClass>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
                         if((*iter)->getOwner() == this && (*iter)->getItemID() == Structure_ConstructionYard) {
                             ConstructionYardClass* pConstructionYard = (ConstructionYardClass*) *iter;
 
@@ -787,7 +787,7 @@ Coord House::getCenterOfMainBase() const {
     Coord center;
     int numStructures = 0;
 
-    RobustList<StructureClass*>::const_iterator iter;
+    IntrusiveList<StructureClass>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureClass* tempStructure = *iter;
 
@@ -818,15 +818,15 @@ void House::decrementHarvesters()
             double	closestDistance = INFINITY;
             StructureClass *closestRefinery = NULL;
 
-            RobustList<StructureClass*>::const_iterator iter;
+            IntrusiveList<StructureClass>::const_iterator iter;
             for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
                 StructureClass* tempStructure = *iter;
 
-                if((tempStructure->getItemID() == Structure_Refinery) && (tempStructure->getOwner() == this) && (tempStructure->getHealth() > 0.0)) {
+                if((tempStructure->getItemID() == Structure_Refinery) && (tempStructure->getOwner() == this) && (tempStructure->getHealth() > 0)) {
                     pos = tempStructure->getLocation();
 
                     Coord closestPoint = tempStructure->getClosestPoint(pos);
-                    double refineryDistance = blockDistance(pos, closestPoint);
+                    double refineryDistance = blockDistance(pos, closestPoint).toDouble();
                     if(!closestRefinery || (refineryDistance < closestDistance)) {
                             closestDistance = refineryDistance;
                             closestRefinery = tempStructure;
@@ -22,11 +22,18 @@
 #include <Game.h>
 #include <House.h>
 #include <ScreenBorder.h>
+#include <AStarSearch.h>
+#include <ClusterGraph.h>
+#include <ReachabilityIndex.h>
+#include <ObjectGrid.h>
+#include <TerrainCache.h>
+#include <FogOfWar.h>
 
 #include <units/UnitClass.h>
 #include <structures/StructureClass.h>
 
 #include <stack>
+#include <algorithm>
 
 MapClass::MapClass(int xSize, int ySize)
 {
@@ -35,27 +42,37 @@ MapClass::MapClass(int xSize, int ySize)
 
 	lastSinglySelectedObject = NULL;
 
-	cell = new TerrainClass*[xSize];
-	for (int i = 0; i < xSize; i++) {
-		cell[i] = new TerrainClass[ySize];
-	}
+	tiles = new TerrainClass[xSize*ySize];
+	tileActive.resize(xSize*ySize, false);
+	tileJournaled.resize(xSize*ySize, false);
+	buildRange.resize(MAX_PLAYERS*xSize*ySize, 0);
 
-	for (int i=0; i<xSize; i++) {
-		for (int j=0; j<ySize; j++) {
-			cell[i][j].location.x = i;
-			cell[i][j].location.y = j;
+	for (int j=0; j<ySize; j++) {
+		for (int i=0; i<xSize; i++) {
+			getCell(i, j)->location.x = i;
+			getCell(i, j)->location.y = j;
 		}
 	}
+
+	pAStarSearchWorkspace = new AStarSearchWorkspace(xSize, ySize);
+	pClusterGraph = new ClusterGraph(this);
+	pReachabilityIndex = new ReachabilityIndex(this);
+	pObjectGrid = new ObjectGrid(this);
+	pTerrainCache = new TerrainCache(this);
+	pFogOfWar = new FogOfWar(this);
 }
 
 
 MapClass::~MapClass()
 {
-	for(int i = 0; i < sizeX; i++) {
-		delete[] cell[i];
-	}
-
-	delete[] cell;
+	delete[] tiles;
+
+	delete pAStarSearchWorkspace;
+	delete pClusterGraph;
+	delete pReachabilityIndex;
+	delete pObjectGrid;
+	delete pTerrainCache;
+	delete pFogOfWar;
 }
 
 void MapClass::load(Stream& stream)
@@ -64,9 +81,28 @@ void MapClass::load(Stream& stream)
 	sizeY = stream.readSint32();
 	for (int i = 0; i < sizeX; i++) {
 		for (int j = 0; j < sizeY; j++) {
-			cell[i][j].load(stream);
-			cell[i][j].location.x = i;
-			cell[i][j].location.y = j;
+			getCell(i, j)->load(stream);
+			getCell(i, j)->location.x = i;
+			getCell(i, j)->location.y = j;
+		}
+	}
+
+	pFogOfWar->load(stream);
+
+	pClusterGraph->invalidateAll();
+	pReachabilityIndex->invalidateAll();
+	pTerrainCache->invalidateAll();
+
+	activeTiles.clear();
+	tileActive.assign(sizeX*sizeY, false);
+	buildRange.assign(MAX_PLAYERS*sizeX*sizeY, 0);
+	for (int j = 0; j < sizeY; j++) {
+		for (int i = 0; i < sizeX; i++) {
+			if(getCell(i, j)->needsUpdate()) {
+				activateTile(Coord(i, j));
+			}
+
+			addToBuildRange(Coord(i, j), getCell(i, j)->getOwner(), 1);
 		}
 	}
 }
@@ -78,9 +114,11 @@ void MapClass::save(Stream& stream) const
 
 	for (int i = 0; i < sizeX; i++) {
 		for (int j = 0; j < sizeY; j++) {
-			cell[i][j].save(stream);
+			getCell(i, j)->save(stream);
 		}
 	}
+
+	pFogOfWar->save(stream);
 }
 
 void MapClass::createSandRegions()
@@ -90,15 +128,15 @@ void MapClass::createSandRegions()
 
 	for(int i = 0; i < sizeX; i++) {
 		for(int j = 0; j < sizeY; j++)	{
-			cell[i][j].setSandRegion(NONE);
+			getCell(i, j)->setSandRegion(NONE);
 		}
 	}
 
     int	region = 0;
 	for(int i = 0; i < sizeX; i++) {
 		for(int j = 0; j < sizeY; j++) {
-			if(!cell[i][j].isRock() && !visited[j*sizeX+i]) {
-				terrainQueue.push(&cell[i][j]);
+			if(!getCell(i, j)->isRock() && !visited[j*sizeX+i]) {
+				terrainQueue.push(getCell(i, j));
 
 				while(!terrainQueue.empty()) {
 					TerrainClass* pTerrain = terrainQueue.top();
@@ -157,17 +195,43 @@ bool MapClass::okayToPlaceStructure(int x, int y, int buildingSizeX, int buildin
 
 bool MapClass::isWithinBuildRange(int x, int y, House* pHouse)
 {
+	int houseID = pHouse->getHouseID();
+	if(cellExists(x, y) && (houseID >= 0) && (houseID < MAX_PLAYERS)) {
+		return (buildRange[(houseID*sizeY + y)*sizeX + x] > 0);
+	}
+
 	bool withinBuildRange = false;
 
 	for (int i = x - BUILDRANGE; i <= x + BUILDRANGE; i++)
 		for (int j = y - BUILDRANGE; j <= y + BUILDRANGE; j++)
-			if (cellExists(i, j) && (cell[i][j].getOwner() == pHouse->getHouseID()))
+			if (cellExists(i, j) && (getCell(i, j)->getOwner() == pHouse->getHouseID()))
 				withinBuildRange = true;
 
 	return withinBuildRange;
 }
 
 
+void MapClass::onOwnerChanged(const Coord& pos, int oldOwner, int newOwner)
+{
+	addToBuildRange(pos, oldOwner, -1);
+	addToBuildRange(pos, newOwner, 1);
+}
+
+
+void MapClass::addToBuildRange(const Coord& pos, int houseID, int delta)
+{
+	if((houseID < 0) || (houseID >= MAX_PLAYERS)) {
+		return;
+	}
+
+	for (int j = std::max(pos.y - BUILDRANGE, 0); j <= std::min(pos.y + BUILDRANGE, sizeY - 1); j++) {
+		for (int i = std::max(pos.x - BUILDRANGE, 0); i <= std::min(pos.x + BUILDRANGE, sizeX - 1); i++) {
+			buildRange[(houseID*sizeY + j)*sizeX + i] += delta;
+		}
+	}
+}
+
+
 bool MapClass::okayToBuildExclusive(int x, int y, int buildingSizeX, int buildingSizeY)
 {
 	for (int i = 0; i < buildingSizeX; i++)
@@ -176,7 +240,7 @@ bool MapClass::okayToBuildExclusive(int x, int y, int buildingSizeX, int buildin
 		{
 			if (((cellBlocked(x+i, y+j) == NOTBLOCKED) || ((i == 0) && (j == 0))))
 			{
-				if (!cell[x+i][y+j].isRock())
+				if (!getCell(x+i, y+j)->isRock())
 				{
 					//printf("%d, %d is not rock\n", x+i, y+j);
 					return false;
@@ -233,11 +297,11 @@ BLOCKEDTYPE MapClass::cellBlocked(int xPos, int yPos)
         BLOCKEDTYPE blocked = COMBLOCKED;
         if (cellExists(xPos, yPos))
 		{
-			if (cell[xPos][yPos].getType() == Terrain_Mountain)
+			if (getCell(xPos, yPos)->getType() == Terrain_Mountain)
 				blocked = MOUNTAIN;
-			else if (cell[xPos][yPos].hasAnObject())
+			else if (getCell(xPos, yPos)->hasAnObject())
 			{
-				if (cell[xPos][yPos].getObject()->isInfantry())
+				if (getCell(xPos, yPos)->getObject()->isInfantry())
 					blocked = INFANTRY;
 				else
 					blocked = COMBLOCKED;
@@ -279,6 +343,7 @@ Coord MapClass::findDeploySpot(UnitClass* pUnit, const Coord origin, const Coord
 
 	bool	found = false;
     bool    foundClosest = false;
+    bool    closestReachable = false;
 
 	int	counter = 0;
 	int	depth = 0;
@@ -291,6 +356,8 @@ Coord MapClass::findDeploySpot(UnitClass* pUnit, const Coord origin, const Coord
 	int ranX = origin.x;
 	int ranY = origin.y;
 
+	MOVEMENTCLASS movementClass = pUnit->getMovementClass();
+
 	do {
 		edge = currentGame->RandomGen.rand(0, 3);
 		switch(edge) {
@@ -328,11 +395,15 @@ Coord MapClass::findDeploySpot(UnitClass* pUnit, const Coord origin, const Coord
 				found = true;
 			} else {
 				Coord temp = Coord(ranX, ranY);
-				if(blockDistance(temp, gatherPoint) < closestDistance) {
-					closestDistance = blockDistance(temp, gatherPoint);
+
+				// spots from where the gather point cannot be reached are only used if there is no other spot
+				bool reachable = pReachabilityIndex->isReachable(movementClass, temp, gatherPoint);
+				if((reachable && !closestReachable) || ((reachable == closestReachable) && (blockDistance(temp, gatherPoint).toDouble() < closestDistance))) {
+					closestDistance = blockDistance(temp, gatherPoint).toDouble();
 					closestPoint.x = ranX;
 					closestPoint.y = ranY;
 					foundClosest = true;
+					closestReachable = reachable;
 				}
 			}
 		}
@@ -390,11 +461,71 @@ Coord MapClass::findClosestEdgePoint(const Coord& origin, const Coord& buildingS
 }
 
 
+void MapClass::onTileChanged(const Coord& pos)
+{
+	pClusterGraph->tileChanged(pos);
+	pReachabilityIndex->tileChanged(pos);
+}
+
+void MapClass::activateTile(const Coord& pos)
+{
+	if(!cellExists(pos)) {
+		return;
+	}
+
+	int index = pos.y*sizeX + pos.x;
+	if(!tileActive[index]) {
+		tileActive[index] = true;
+		activeTiles.push_back(getCell(pos));
+	}
+}
+
+void MapClass::updateActiveTiles()
+{
+	// tiles with nothing left to update are removed; the order of the others stays the same
+	unsigned int numActiveTiles = 0;
+	for(unsigned int i = 0; i < activeTiles.size(); i++) {
+		TerrainClass* pTile = activeTiles[i];
+		if(pTile->update()) {
+			activeTiles[numActiveTiles++] = pTile;
+		} else {
+			const Coord& pos = pTile->getLocation();
+			tileActive[pos.y*sizeX + pos.x] = false;
+		}
+	}
+
+	activeTiles.resize(numActiveTiles);
+}
+
+void MapClass::journalRadarChange(const Coord& pos)
+{
+	if(!cellExists(pos)) {
+		return;
+	}
+
+	int index = pos.y*sizeX + pos.x;
+	if(!tileJournaled[index]) {
+		tileJournaled[index] = true;
+		radarJournal.push_back(pos);
+	}
+}
+
+void MapClass::takeRadarJournal(std::vector<Coord>& changedTiles)
+{
+	for(unsigned int i = 0; i < radarJournal.size(); i++) {
+		const Coord& pos = radarJournal[i];
+		tileJournaled[pos.y*sizeX + pos.x] = false;
+	}
+
+	changedTiles.swap(radarJournal);
+	radarJournal.clear();
+}
+
 void MapClass::removeObjectFromMap(Uint32 ObjectID)
 {
 	for(int y = 0; y < sizeY ; y++) {
 		for(int x = 0 ; x < sizeX ; x++) {
-			cell[x][y].unassignObject(ObjectID);
+			getCell(x, y)->unassignObject(ObjectID);
 		}
 	}
 }
@@ -412,8 +543,8 @@ void MapClass::selectObjects(int houseID, int x1, int y1, int x2, int y2, int re
 
 	if((x1 == x2) && (y1 == y2) && cellExists(x1, y1)) {
 
-        if(cell[x1][y1].isExplored(houseID) || debug) {
-            lastCheckedObject = cell[x1][y1].getObjectAt(realX, realY);
+        if(getCell(x1, y1)->isExplored(houseID) || debug) {
+            lastCheckedObject = getCell(x1, y1)->getObjectAt(realX, realY);
         } else {
 		    lastCheckedObject = NULL;
 		}
@@ -422,8 +553,8 @@ void MapClass::selectObjects(int houseID, int x1, int y1, int x2, int y2, int re
 			if((lastCheckedObject == lastSinglySelectedObject) && ( !lastCheckedObject->isAStructure())) {
                 for(int i = screenborder->getTopLeftTile().x; i <= screenborder->getBottomRightTile().x; i++) {
                     for(int j = screenborder->getTopLeftTile().y; j <= screenborder->getBottomRightTile().y; j++) {
-                        if(cellExists(i, j) && cell[i][j].hasAnObject()) {
-                            cell[i][j].selectAllPlayersUnitsOfType(houseID, lastSinglySelectedObject->getItemID(), &lastCheckedObject, &lastSelectedObject);
+                        if(cellExists(i, j) && getCell(i, j)->hasAnObject()) {
+                            getCell(i, j)->selectAllPlayersUnitsOfType(houseID, lastSinglySelectedObject->getItemID(), &lastCheckedObject, &lastSelectedObject);
                         }
                     }
 				}
@@ -450,10 +581,10 @@ void MapClass::selectObjects(int houseID, int x1, int y1, int x2, int y2, int re
 		lastSinglySelectedObject = NULL;
 		for (int i = std::min(x1, x2); i <= std::max(x1, x2); i++)
 		for (int j = std::min(y1, y2); j <= std::max(y1, y2); j++)
-			if (cellExists(i, j) && cell[i][j].hasAnObject()
-				&& cell[i][j].isExplored(houseID)
-				&& !cell[i][j].isFogged(houseID) )
-					cell[i][j].selectAllPlayersUnits(houseID, &lastCheckedObject, &lastSelectedObject);
+			if (cellExists(i, j) && getCell(i, j)->hasAnObject()
+				&& getCell(i, j)->isExplored(houseID)
+				&& !getCell(i, j)->isFogged(houseID) )
+					getCell(i, j)->selectAllPlayersUnits(houseID, &lastCheckedObject, &lastSelectedObject);
 	}
 
 	//select an enemy unit if none of your units found
@@ -490,7 +621,7 @@ bool MapClass::findSpice(Coord* destination, Coord* origin)
 			ranY = currentGame->RandomGen.rand(y-depth, y + depth);
 		} while (((ranX >= (x+1 - depth)) && (ranX < (x + depth))) && ((ranY >= (y+1 - depth)) && (ranY < (y + depth))));
 
-		if (cellExists(ranX,ranY) && !cell[ranX][ranY].hasAGroundObject() && cell[ranX][ranY].hasSpice())
+		if (cellExists(ranX,ranY) && !getCell(ranX, ranY)->hasAGroundObject() && getCell(ranX, ranY)->hasSpice())
 		{
 			found = true;
 			destination->x = ranX;
@@ -507,7 +638,7 @@ bool MapClass::findSpice(Coord* destination, Coord* origin)
 			return false;	//there is possibly no spice left anywhere on map
 	} while (!found);
 
-	if ((depth > 1) && (cell[origin->x][origin->y].hasSpice()))
+	if ((depth > 1) && (getCell(origin->x, origin->y)->hasSpice()))
 	{
 		destination->x = origin->x;
 		destination->y = origin->y;
@@ -523,17 +654,17 @@ bool MapClass::findSpice(Coord* destination, Coord* origin)
 void MapClass::removeSpice(const Coord& coord)
 {
 	if(cellExists(coord)) {	//this is the centre cell
-		if (cell[coord.x][coord.y].getType() == Terrain_ThickSpice) {
-			cell[coord.x][coord.y].setType(Terrain_Spice);
+		if (getCell(coord.x, coord.y)->getType() == Terrain_ThickSpice) {
+			getCell(coord.x, coord.y)->setType(Terrain_Spice);
 		} else {
-			cell[coord.x][coord.y].setType(Terrain_Sand);
+			getCell(coord.x, coord.y)->setType(Terrain_Sand);
 
 			//thickspice tiles cant handle non-(thick)spice tiles next to them, if there is after changes, make it non thick
 			for(int i = coord.x-1; i <= coord.x+1; i++) {
                 for(int j = coord.y-1; j <= coord.y+1; j++) {
-                    if (cellExists(i, j) && (((i==coord.x) && (j!=coord.y)) || ((i!=coord.x) && (j==coord.y))) && cell[i][j].isThickSpice()) {
+                    if (cellExists(i, j) && (((i==coord.x) && (j!=coord.y)) || ((i!=coord.x) && (j==coord.y))) && getCell(i, j)->isThickSpice()) {
                         //only check cell, right, up, left and down of this one
-                        cell[i][j].setType(Terrain_Spice);
+                        getCell(i, j)->setType(Terrain_Spice);
                     }
                 }
 			}
@@ -543,39 +674,14 @@ void MapClass::removeSpice(const Coord& coord)
 
 void MapClass::viewMap(int playerTeam, const Coord& location, int maxViewRange)
 {
-	int			i;
-    Coord   check;
-
-//makes map viewable in an area like as shown below
-
-//				       *****
-//                   *********
-//                  *****T*****
-//                   *********
-//                     *****
-
-	check.x = location.x - maxViewRange;
-	if (check.x < 0)
-		check.x = 0;
-
-	while ((check.x < sizeX) && ((check.x - location.x) <=  maxViewRange))
-	{
-		check.y = (location.y - lookDist[abs(check.x - location.x)]);
-		if (check.y < 0) check.y = 0;
-
-		while ((check.y < sizeY) && ((check.y - location.y) <= lookDist[abs(check.x - location.x)]))
-		{
-			if (distance_from(location, check) <= maxViewRange)
-			for (i = 0; i < MAX_PLAYERS; i++)
-				if (currentGame->house[i] && (currentGame->house[i]->getTeam() == playerTeam))
-					cell[check.x][check.y].setExplored(i,currentGame->GetGameCycleCount());
-
-			check.y++;
+	Uint32 houseMask = 0;
+	for (int i = 0; i < MAX_PLAYERS; i++) {
+		if (currentGame->house[i] && (currentGame->house[i]->getTeam() == playerTeam)) {
+			houseMask |= (1 << i);
 		}
-
-		check.x++;
-		check.y = location.y;
 	}
+
+	pFogOfWar->reveal(houseMask, location, maxViewRange, currentGame->GetGameCycleCount());
 }
 
 void MapClass::viewMap(int playerTeam, int x, int y, int maxViewRange)
@@ -583,6 +689,26 @@ void MapClass::viewMap(int playerTeam, int x, int y, int maxViewRange)
 	viewMap(playerTeam, Coord(x,y), maxViewRange);
 }
 
+const std::vector<int>& MapClass::getCircleStamp(int radius)
+{
+	while((int) circleStamps.size() <= radius) {
+		int r = circleStamps.size();
+		std::vector<int> halfWidths(r + 1);
+
+		int halfWidth = r;
+		for(int dy = 0; dy <= r; dy++) {
+			while(halfWidth*halfWidth + dy*dy > r*r) {
+				halfWidth--;
+			}
+			halfWidths[dy] = halfWidth;
+		}
+
+		circleStamps.push_back(halfWidths);
+	}
+
+	return circleStamps[radius];
+}
+
 
 ObjectClass* MapClass::findObjectWidthID(int objectID, int lx, int ly)
 {
@@ -608,7 +734,7 @@ ObjectClass* MapClass::findObjectWidthID(int objectID, int lx, int ly)
 		    //object wasn't found in surrounding cells
             //search lists
 
-            RobustList<UnitClass*>::const_iterator iter;
+            IntrusiveList<UnitClass>::const_iterator iter;
             for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 				if((*iter)->hasObjectID(objectID)) {
                     object = *iter;
@@ -618,7 +744,7 @@ ObjectClass* MapClass::findObjectWidthID(int objectID, int lx, int ly)
 
 			if(object == NULL) {
 			    //object wasn't found in units
-                RobustList<StructureClass*>::const_iterator iter;
+                IntrusiveList<StructureClass>::const_iterator iter;
                 for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
                     if((*iter)->hasObjectID(objectID)) {
                         object = *iter;
@@ -69,7 +69,7 @@ int on_left(int cellX, int cellY, int type) {
 	cellX--;
 	fix_cell(cellX, cellY);
 
-	if (currentGameMap->cell[cellX][cellY].getType() == type)
+	if (currentGameMap->getCell(cellX, cellY)->getType() == type)
 		return 1;
 
 	return 0;
@@ -86,7 +86,7 @@ int on_right(int cellX, int cellY, int tile) {
 	cellX++;
 	fix_cell(cellX, cellY);
 
-	if (currentGameMap->cell[cellX][cellY].getType() == tile)
+	if (currentGameMap->getCell(cellX, cellY)->getType() == tile)
 		return 1;
 
 	return 0;
@@ -103,7 +103,7 @@ int on_up(int cellX, int cellY, int tile) {
 	cellY--;
 	fix_cell(cellX, cellY);
 
-	if (currentGameMap->cell[cellX][cellY].getType() == tile)
+	if (currentGameMap->getCell(cellX, cellY)->getType() == tile)
 		return 1;
 
 	return 0;
@@ -120,7 +120,7 @@ int on_down(int cellX, int cellY, int tile) {
 	cellY++;
 	fix_cell(cellX, cellY);
 
-	if (currentGameMap->cell[cellX][cellY].getType() == tile)
+	if (currentGameMap->getCell(cellX, cellY)->getType() == tile)
 		return 1;
 
 	return 0;
@@ -161,15 +161,15 @@ int side4(int cellX, int cellY, int tile) {
 void thick_spots(int tpe) {
     for (int i = 0; i < currentGameMap->sizeX; i++) {
         for (int j = 0; j < currentGameMap->sizeY; j++) {
-            if (currentGameMap->cell[i][j].getType() != tpe) {
+            if (currentGameMap->getCell(i, j)->getType() != tpe) {
                 // Found something else than what thickining
 				if (side4(i, j, tpe) >= 3)
-					currentGameMap->cell[i][j].setType(tpe);                // Seems enough of the type around it so make this rock
+					currentGameMap->getCell(i, j)->setType(tpe);                // Seems enough of the type around it so make this rock
 
 				if (side4(i, j, tpe) == 2) {
                     // Gamble, fifty fifty... rock or not?
 					if (getRandomInt(0,1) == 1)
-						currentGameMap->cell[i][j].setType(tpe);
+						currentGameMap->getCell(i, j)->setType(tpe);
 				}
 			}
 		}
@@ -199,11 +199,11 @@ void make_spot(int cellX, int cellY, int tpe) {
 		fix_cell(cellX, cellY);
 
 		if(tpe == Terrain_Spice) {
-			if (currentGameMap->cell[cellX][cellY].getType() == Terrain_Rock)
+			if (currentGameMap->getCell(cellX, cellY)->getType() == Terrain_Rock)
                 continue;		// Do not place the spice spot, priority is ROCK!
 		}
 
-		currentGameMap->cell[cellX][cellY].setType(tpe);
+		currentGameMap->getCell(cellX, cellY)->setType(tpe);
 	}
 }
 
@@ -219,8 +219,8 @@ void add_rock_bits(int amount) {
 		spotX = getRandomInt(0, currentGameMap->sizeX-1);
 		spotY = getRandomInt(0, currentGameMap->sizeY-1);
 
-		if(currentGameMap->cell[spotX][spotY].getType() == Terrain_Sand) {
-			currentGameMap->cell[spotX][spotY].setType(Terrain_Rock);
+		if(currentGameMap->getCell(spotX, spotY)->getType() == Terrain_Sand) {
+			currentGameMap->getCell(spotX, spotY)->setType(Terrain_Rock);
             done++;
 		}
 	}
@@ -236,8 +236,8 @@ void add_blooms(int amount) {
 	while(done < amount) {
 		spotX = getRandomInt(0, currentGameMap->sizeX-1);
 		spotY = getRandomInt(0, currentGameMap->sizeY-1);
-		if(currentGameMap->cell[spotX][spotY].getType() == Terrain_Sand) {
-			currentGameMap->cell[spotX][spotY].setType(Terrain_SpiceBloom);      // Spice bloom
+		if(currentGameMap->getCell(spotX, spotY)->getType() == Terrain_Sand) {
+			currentGameMap->getCell(spotX, spotY)->setType(Terrain_SpiceBloom);      // Spice bloom
             done++;
         }
 	}
@@ -259,7 +259,7 @@ void make_random_map(int sizeX, int sizeY) {
     // set whole map to type Terrain_Sand
 	for (int i = 0; i < currentGameMap->sizeX; i++) {
 		for (int j = 0; j < currentGameMap->sizeY; j++) {
-			currentGameMap->cell[i][j].setType(Terrain_Sand);
+			currentGameMap->getCell(i, j)->setType(Terrain_Sand);
 		}
 	}
 
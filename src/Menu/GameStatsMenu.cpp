@@ -456,7 +456,7 @@ void GameStatsMenu::calculateScore(int level)
 
 	totalScore += ((int) totalHumanCredits) / 100;
 
-    for(RobustList<StructureClass*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(IntrusiveList<StructureClass>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureClass* pStructure = *iter;
         if(pStructure->getOwner()->isAI() == false) {
             totalScore += currentGame->objectData.data[pStructure->getItemID()].price / 100;
@@ -465,14 +465,14 @@ void GameStatsMenu::calculateScore(int level)
 
     totalScore -= ((totalTime/60) + 1);
 
-    for(RobustList<UnitClass*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+    for(IntrusiveList<UnitClass>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
         UnitClass* pUnit = *iter;
         if(pUnit->getItemID() == Unit_Harvester) {
             HarvesterClass* pHarvester = (HarvesterClass*) pUnit;
             if(pHarvester->getOwner()->isAI() == true) {
-                AI_SpiceHarvested += pHarvester->getAmountOfSpice();
+                AI_SpiceHarvested += pHarvester->getAmountOfSpice().toDouble();
             } else {
-                Human_SpiceHarvested += pHarvester->getAmountOfSpice();
+                Human_SpiceHarvested += pHarvester->getAmountOfSpice().toDouble();
             }
         }
     }
@@ -27,6 +27,7 @@
 #include <misc/Stream.h>
 #include <SoundPlayer.h>
 #include <MapClass.h>
+#include <ObjectGrid.h>
 #include <ScreenBorder.h>
 #include <GUI/ObjectInterfaces/DefaultObjectInterface.h>
 
@@ -71,6 +72,10 @@
 #include <units/TrikeClass.h>
 #include <units/TrooperClass.h>
 
+#include <algorithm>
+
+MemoryPool ObjectClass::memoryPool;
+
 ObjectClass::ObjectClass(House* newOwner) : owner(newOwner)
 {
     ObjectClass::init();
@@ -79,6 +84,7 @@ ObjectClass::ObjectClass(House* newOwner) : owner(newOwner)
 
     health = 0;
     badlyDamaged = false;
+    gridBucket = INVALID;
 
 	location.x = INVALID_POS;
 	location.y = INVALID_POS;
@@ -86,8 +92,8 @@ ObjectClass::ObjectClass(House* newOwner) : owner(newOwner)
 	oldLocation.y = INVALID_POS;
 	destination.x = INVALID_POS;
 	destination.y = INVALID_POS;
-	realX = 0.0;
-	realY = 0.0;
+	realX = 0;
+	realY = 0;
 
     drawnAngle = 0;
 	angle = drawnAngle;
@@ -110,8 +116,9 @@ ObjectClass::ObjectClass(Stream& stream)
 
     ObjectClass::init();
 
-    health = stream.readDouble();
+    health = stream.readFixPoint();
     badlyDamaged = stream.readBool();
+    gridBucket = INVALID;
 
 	location.x = stream.readSint32();
 	location.y = stream.readSint32();
@@ -119,10 +126,10 @@ ObjectClass::ObjectClass(Stream& stream)
 	oldLocation.y = stream.readSint32();
 	destination.x = stream.readSint32();
 	destination.y = stream.readSint32();
-	realX = stream.readDouble();
-	realY = stream.readDouble();
+	realX = stream.readFixPoint();
+	realY = stream.readFixPoint();
 
-    angle = stream.readDouble();
+    angle = stream.readFixPoint();
     drawnAngle = stream.readSint8();
 
     active = stream.readBool();
@@ -161,13 +168,16 @@ void ObjectClass::init() {
 }
 
 ObjectClass::~ObjectClass() {
+    if(gridBucket != INVALID) {
+        currentGameMap->getObjectGrid()->remove(this);
+    }
 }
 
 void ObjectClass::save(Stream& stream) const
 {
     stream.writeUint32(owner->getHouseID());
 
-    stream.writeDouble(health);
+    stream.writeFixPoint(health);
     stream.writeBool(badlyDamaged);
 
 	stream.writeSint32(location.x);
@@ -176,10 +186,10 @@ void ObjectClass::save(Stream& stream) const
 	stream.writeSint32(oldLocation.y);
 	stream.writeSint32(destination.x);
 	stream.writeSint32(destination.y);
-	stream.writeDouble(realX);
-	stream.writeDouble(realY);
+	stream.writeFixPoint(realX);
+	stream.writeFixPoint(realY);
 
-    stream.writeDouble(angle);
+    stream.writeFixPoint(angle);
     stream.writeSint8(drawnAngle);
 
 	stream.writeBool(active);
@@ -216,7 +226,7 @@ void ObjectClass::blitToScreen()
 */
 Coord ObjectClass::getCenterPoint() const
 {
-    return Coord(lround(realX), lround(realY));
+    return Coord(realX.roundToInt(), realY.roundToInt());
 }
 
 Coord ObjectClass::getClosestCenterPoint(const Coord& objectLocation) const
@@ -233,7 +243,7 @@ int ObjectClass::getMaxHealth() const
 void ObjectClass::handleDamage(int damage, Uint32 damagerID, House* damagerOwner)
 {
     if(damage >= 0) {
-        double newHealth = getHealth();
+        FixPoint newHealth = getHealth();
 
         newHealth -= damage;
 
@@ -284,12 +294,12 @@ void ObjectClass::setDestination(int newX, int newY)
 	}
 }
 
-void ObjectClass::setHealth(double newHealth)
+void ObjectClass::setHealth(FixPoint newHealth)
 {
 	if ((newHealth >= 0) && (newHealth <= getMaxHealth()))
 	{
 		health = newHealth;
-        badlyDamaged = (health/(double)getMaxHealth() < HEAVILYDAMAGEDRATIO);
+        badlyDamaged = (health/getMaxHealth() < HEAVILYDAMAGEDRATIO);
 	}
 }
 
@@ -306,6 +316,8 @@ void ObjectClass::setLocation(int xPos, int yPos)
 
 		assignToMap(location);
 	}
+
+	currentGameMap->getObjectGrid()->update(this);
 }
 
 void ObjectClass::setObjectID(int newObjectID)
@@ -352,7 +364,7 @@ bool ObjectClass::canAttack(const ObjectClass* object) const
 
 bool ObjectClass::isOnScreen() const
 {
-	if(screenborder->isInsideScreen(Coord((int) getRealX(), (int) getRealY()),
+	if(screenborder->isInsideScreen(Coord(getRealX().toInt(), getRealY().toInt()),
                                     Coord(getImageW(), getImageH())) == true)
     {
 		return true;
@@ -382,9 +394,9 @@ bool ObjectClass::isVisible() const
 
 int ObjectClass::getHealthColor() const
 {
-	double healthPercent = (double)health/(double)getMaxHealth();
+	FixPoint healthPercent = health/getMaxHealth();
 
-	if (healthPercent >= 0.7) {
+	if (healthPercent >= FixPoint::fromFraction(7, 10)) {
 		return COLOR_LIGHTGREEN;
 	} else if (healthPercent >= HEAVILYDAMAGEDRATIO) {
 		return COLOR_YELLOW;
@@ -400,53 +412,20 @@ Coord ObjectClass::getClosestPoint(const Coord& point) const
 
 StructureClass* ObjectClass::findClosestTargetStructure(ObjectClass* object)
 {
+    ObjectGrid* pObjectGrid = currentGameMap->getObjectGrid();
 
-	StructureClass	*closestStructure = NULL;
-	double			closestDistance = 100000000.0;
-
-    RobustList<StructureClass*>::const_iterator iter;
-    for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
-        StructureClass* tempStructure = *iter;
-
-        if(object->canAttack(tempStructure)) {
-			Coord closestPoint = tempStructure->getClosestPoint(object->getLocation());
-			double structureDistance = blockDistance(object->getLocation(), closestPoint);
-
-			if(tempStructure->getItemID() == Structure_Wall) {
-					structureDistance += 20000000.0; //so that walls are targeted very last
-            }
-
-            if(structureDistance < closestDistance)	{
-                closestDistance = structureDistance;
-                closestStructure = tempStructure;
-            }
-        }
-	}
+    // walls are targeted very last
+    ObjectClass* pClosestStructure = pObjectGrid->findClosestTarget(object, true, false);
+    if(pClosestStructure == NULL) {
+        pClosestStructure = pObjectGrid->findClosestTarget(object, true, true);
+    }
 
-	return closestStructure;
+	return static_cast<StructureClass*>(pClosestStructure);
 }
 
 UnitClass* ObjectClass::findClosestTargetUnit(ObjectClass* object)
 {
-	UnitClass	*closestUnit = NULL;
-	double		closestDistance = 100000000.0;
-
-    RobustList<UnitClass*>::const_iterator iter;
-    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
-        UnitClass* tempUnit = *iter;
-
-		if(object->canAttack(tempUnit)) {
-			Coord closestPoint = tempUnit->getClosestPoint(object->getLocation());
-			double unitDistance = blockDistance(object->getLocation(), closestPoint);
-
-			if(unitDistance < closestDistance) {
-                closestDistance = unitDistance;
-				closestUnit = tempUnit;
-            }
-        }
-	}
-
-	return closestUnit;
+	return static_cast<UnitClass*>(currentGameMap->getObjectGrid()->findClosestTarget(object, false, false));
 }
 
 ObjectClass* ObjectClass::findTarget()
@@ -496,29 +475,27 @@ ObjectClass* ObjectClass::findTarget()
         } break;
     }
 
-	int xCheck = xPos - checkRange;
+	const std::vector<int>& halfHeights = currentGameMap->getCircleStamp(checkRange);
 
-	if (xCheck < 0)
-		xCheck = 0;
+	int xCheck = std::max(xPos - checkRange, 0);
 
 	int yCheck;
 
 	while ((xCheck < currentGameMap->sizeX) && ((xCheck - xPos) <=  checkRange))
 	{
-		yCheck = (yPos - lookDist[abs(xCheck - xPos)]);
+		int halfHeight = halfHeights[abs(xCheck - xPos)];
 
-		if (yCheck < 0)
-			yCheck = 0;
+		yCheck = std::max(yPos - halfHeight, 0);
 
-		while ((yCheck < currentGameMap->sizeY) && ((yCheck - yPos) <=  lookDist[abs(xCheck - xPos)]))
+		while ((yCheck < currentGameMap->sizeY) && ((yCheck - yPos) <=  halfHeight))
 		{
-			if(currentGameMap->cell[xCheck][yCheck].hasAnObject())
+			if(currentGameMap->getCell(xCheck, yCheck)->hasAnObject())
 			{
-				tempTarget = currentGameMap->cell[xCheck][yCheck].getObject();
+				tempTarget = currentGameMap->getCell(xCheck, yCheck)->getObject();
 
 				if (((tempTarget->getItemID() != Structure_Wall) || (closestTarget == NULL)) && canAttack(tempTarget))
 				{
-					double targetDistance = blockDistance(location, tempTarget->getLocation());
+					double targetDistance = blockDistance(location, tempTarget->getLocation()).toDouble();
 					if (targetDistance < closestDistance)
 					{
 						closestTarget = tempTarget;
@@ -681,7 +658,7 @@ ObjectClass* ObjectClass::loadObject(Stream& stream, int ItemID, Uint32 ObjectID
 
 bool ObjectClass::targetInWeaponRange() const {
     Coord coord = (target.getObjPointer())->getClosestPoint(location);
-    double dist = blockDistance(location,coord);
+    FixPoint dist = blockDistance(location,coord);
     return ( dist <= currentGame->objectData.data[itemID].weaponrange);
 }
 
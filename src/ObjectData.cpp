@@ -37,8 +37,8 @@ ObjectData::ObjectData()
         data[i].capacity = 0;
         data[i].weapondamage = 0;
         data[i].weaponrange = 0;
-        data[i].maxspeed = 0.0;
-        data[i].turnspeed = 0.0;
+        data[i].maxspeed = 0;
+        data[i].turnspeed = 0;
         data[i].radius = 0;
         data[i].buildtime = 0;
     }
@@ -63,8 +63,8 @@ void ObjectData::loadFromINIFile(std::string filename)
     structureDefaultData.capacity = objectDataFile.getIntValue("default structure", "Capacity");
     structureDefaultData.weapondamage = objectDataFile.getIntValue("default structure", "WeaponDamage");
     structureDefaultData.weaponrange = objectDataFile.getIntValue("default structure", "WeaponRange");
-    structureDefaultData.maxspeed = objectDataFile.getDoubleValue("default structure", "MaxSpeed");
-    structureDefaultData.turnspeed = objectDataFile.getDoubleValue("default structure", "TurnSpeed");
+    structureDefaultData.maxspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue("default structure", "MaxSpeed"));
+    structureDefaultData.turnspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue("default structure", "TurnSpeed"));
     structureDefaultData.radius = objectDataFile.getIntValue("default structure", "Radius");
     structureDefaultData.buildtime = objectDataFile.getIntValue("default structure", "BuildTime");
 
@@ -77,8 +77,8 @@ void ObjectData::loadFromINIFile(std::string filename)
     unitDefaultData.capacity = objectDataFile.getIntValue("default unit", "Capacity");
     unitDefaultData.weapondamage = objectDataFile.getIntValue("default unit", "WeaponDamage");
     unitDefaultData.weaponrange = objectDataFile.getIntValue("default unit", "WeaponRange");
-    unitDefaultData.maxspeed = objectDataFile.getDoubleValue("default unit", "MaxSpeed");
-    unitDefaultData.turnspeed = objectDataFile.getDoubleValue("default unit", "TurnSpeed");
+    unitDefaultData.maxspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue("default unit", "MaxSpeed"));
+    unitDefaultData.turnspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue("default unit", "TurnSpeed"));
     unitDefaultData.radius = objectDataFile.getIntValue("default unit", "Radius");
     unitDefaultData.buildtime = objectDataFile.getIntValue("default unit", "BuildTime");
 
@@ -115,8 +115,8 @@ void ObjectData::loadFromINIFile(std::string filename)
         data[itemID].capacity = objectDataFile.getIntValue(sectionName, "Capacity", defaultData.capacity);
         data[itemID].weapondamage = objectDataFile.getIntValue(sectionName, "WeaponDamage", defaultData.weapondamage);
         data[itemID].weaponrange = objectDataFile.getIntValue(sectionName, "WeaponRange", defaultData.weaponrange);
-        data[itemID].maxspeed = objectDataFile.getDoubleValue(sectionName, "MaxSpeed", defaultData.maxspeed);
-        data[itemID].turnspeed = objectDataFile.getDoubleValue(sectionName, "TurnSpeed", defaultData.turnspeed);
+        data[itemID].maxspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue(sectionName, "MaxSpeed", defaultData.maxspeed.toDouble()));
+        data[itemID].turnspeed = FixPoint::fromDouble(objectDataFile.getDoubleValue(sectionName, "TurnSpeed", defaultData.turnspeed.toDouble()));
         data[itemID].radius = objectDataFile.getIntValue(sectionName, "Radius", defaultData.radius);
         data[itemID].buildtime = objectDataFile.getIntValue(sectionName, "BuildTime", defaultData.buildtime);
     }
@@ -132,8 +132,8 @@ void ObjectData::save(Stream& stream) const
         stream.writeSint32(data[i].capacity);
         stream.writeSint32(data[i].weapondamage);
         stream.writeSint32(data[i].weaponrange);
-        stream.writeDouble(data[i].maxspeed);
-        stream.writeDouble(data[i].turnspeed);
+        stream.writeFixPoint(data[i].maxspeed);
+        stream.writeFixPoint(data[i].turnspeed);
         stream.writeSint32(data[i].radius);
         stream.writeSint32(data[i].buildtime);
     }
@@ -149,8 +149,8 @@ void ObjectData::load(Stream& stream)
         data[i].capacity = stream.readSint32();
         data[i].weapondamage = stream.readSint32();
         data[i].weaponrange = stream.readSint32();
-        data[i].maxspeed = stream.readDouble();
-        data[i].turnspeed = stream.readDouble();
+        data[i].maxspeed = stream.readFixPoint();
+        data[i].turnspeed = stream.readFixPoint();
         data[i].radius = stream.readSint32();
         data[i].buildtime = stream.readSint32();
     }
@@ -0,0 +1,150 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ObjectGrid.h>
+
+#include <globals.h>
+
+#include <Game.h>
+#include <House.h>
+#include <MapClass.h>
+#include <ObjectClass.h>
+
+#include <algorithm>
+
+/// Structures are stored by their upper left tile; their other tiles might lie in the neighbouring cells
+#define STRUCTURE_CELL_MARGIN   1
+
+ObjectGrid::ObjectGrid(MapClass* pMap) {
+    this->pMap = pMap;
+
+    numCellsX = (pMap->sizeX + CELLSIZE - 1) / CELLSIZE;
+    numCellsY = (pMap->sizeY + CELLSIZE - 1) / CELLSIZE;
+
+    buckets.resize(2*NUM_SLOTS*numCellsX*numCellsY);
+}
+
+ObjectGrid::~ObjectGrid() {
+}
+
+void ObjectGrid::update(ObjectClass* pObject) {
+    int newBucket = INVALID;
+
+    const Coord& location = pObject->getLocation();
+    if(pMap->cellExists(location) && (pObject->getOwner() != NULL)) {
+        int slot = (pObject->getItemID() == Unit_Sandworm) ? NUM_HOUSES : pObject->getOwner()->getHouseID();
+        newBucket = getBucketIndex(pObject->isAStructure(), slot, location.x / CELLSIZE, location.y / CELLSIZE);
+    }
+
+    if(newBucket == pObject->gridBucket) {
+        return;
+    }
+
+    remove(pObject);
+
+    if(newBucket != INVALID) {
+        buckets[newBucket].push_back(pObject);
+        pObject->gridBucket = newBucket;
+    }
+}
+
+void ObjectGrid::remove(ObjectClass* pObject) {
+    if(pObject->gridBucket == INVALID) {
+        return;
+    }
+
+    std::vector<ObjectClass*>& bucket = buckets[pObject->gridBucket];
+    std::vector<ObjectClass*>::iterator iter = std::find(bucket.begin(), bucket.end(), pObject);
+    if(iter != bucket.end()) {
+        *iter = bucket.back();
+        bucket.pop_back();
+    }
+
+    pObject->gridBucket = INVALID;
+}
+
+ObjectClass* ObjectGrid::findClosestTarget(const ObjectClass* pAttacker, bool bStructures, bool bWalls) const {
+    const Coord& location = pAttacker->getLocation();
+    int team = pAttacker->getOwner()->getTeam();
+
+    // objects outside the map have to look at every cell
+    bool bOnMap = pMap->cellExists(location);
+    int centerX = bOnMap ? location.x / CELLSIZE : 0;
+    int centerY = bOnMap ? location.y / CELLSIZE : 0;
+    int margin = bStructures ? STRUCTURE_CELL_MARGIN : 0;
+    int numSlots = bStructures ? NUM_HOUSES : NUM_SLOTS;
+
+    // the houses of the same team can be skipped except for sandworms which are in their own slot
+    bool bSkipSlot[NUM_SLOTS];
+    for(int slot = 0; slot < NUM_SLOTS; slot++) {
+        House* pHouse = (slot < NUM_HOUSES) ? currentGame->house[slot] : NULL;
+        bSkipSlot[slot] = (slot < NUM_HOUSES) && ((pHouse == NULL) || (pHouse->getTeam() == team));
+    }
+
+    ObjectClass* pClosestObject = NULL;
+    double closestDistance = 0.0;
+
+    int maxRing = std::max(numCellsX, numCellsY);
+    for(int ring = 0; ring <= maxRing; ring++) {
+        if(bOnMap && (pClosestObject != NULL)) {
+            // every tile in this ring is at least this far away
+            int minDistance = (ring - 1 - margin)*CELLSIZE + 1;
+            if(minDistance > closestDistance) {
+                break;
+            }
+        }
+
+        for(int cellY = centerY - ring; cellY <= centerY + ring; cellY++) {
+            if((cellY < 0) || (cellY >= numCellsY)) {
+                continue;
+            }
+
+            // only the first and the last row contain the whole ring, the other rows only the two outer cells
+            int step = ((cellY == centerY - ring) || (cellY == centerY + ring)) ? 1 : 2*ring;
+            for(int cellX = centerX - ring; cellX <= centerX + ring; cellX += step) {
+                if((cellX < 0) || (cellX >= numCellsX)) {
+                    continue;
+                }
+
+                for(int slot = 0; slot < numSlots; slot++) {
+                    if(bSkipSlot[slot]) {
+                        continue;
+                    }
+
+                    const std::vector<ObjectClass*>& bucket = buckets[getBucketIndex(bStructures, slot, cellX, cellY)];
+                    std::vector<ObjectClass*>::const_iterator iter;
+                    for(iter = bucket.begin(); iter != bucket.end(); ++iter) {
+                        ObjectClass* pObject = *iter;
+
+                        if((bStructures && ((pObject->getItemID() == Structure_Wall) != bWalls)) || (pAttacker->canAttack(pObject) == false)) {
+                            continue;
+                        }
+
+                        double distance = blockDistance(location, pObject->getClosestPoint(location)).toDouble();
+                        if((pClosestObject == NULL) || (distance < closestDistance)
+                            || ((distance == closestDistance) && (pObject->getObjectID() < pClosestObject->getObjectID()))) {
+                            closestDistance = distance;
+                            pClosestObject = pObject;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return pClosestObject;
+}
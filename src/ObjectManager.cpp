@@ -21,20 +21,55 @@
 
 #include <Game.h>
 #include <ObjectClass.h>
+#include <MapClass.h>
+#include <ObjectGrid.h>
+
+#include <algorithm>
 
 void ObjectManager::save(Stream& stream) const {
-    stream.writeUint32(nextFreeObjectID);
+    stream.writeUint32(slots.size());
+    for(unsigned int i = 0; i < slots.size(); i++) {
+        stream.writeUint16(slots[i].generation);
+    }
+
+    stream.writeUint32(freeSlots.size());
+    std::deque<Uint32>::const_iterator freeIter;
+    for(freeIter = freeSlots.begin(); freeIter != freeSlots.end(); ++freeIter) {
+        stream.writeUint32(*freeIter);
+    }
 
-    stream.writeUint32(objectMap.size());
-    ObjectMap::const_iterator iter;
-    for(iter = objectMap.begin(); iter != objectMap.end(); ++iter) {
-        stream.writeUint32(iter->second->getObjectID());
-        currentGame->SaveObject(stream, iter->second);
+    // the objects are saved in the order they were created, so they are loaded in the same order into the unit and structure lists
+    std::vector< std::pair<Uint32,Uint32> > serialsAndIndices;
+    for(unsigned int i = 0; i < slots.size(); i++) {
+        if(slots[i].pObject != NULL) {
+            serialsAndIndices.push_back(std::make_pair(slots[i].serial, i));
+        }
+    }
+    std::sort(serialsAndIndices.begin(), serialsAndIndices.end());
+
+    stream.writeUint32(serialsAndIndices.size());
+    for(unsigned int i = 0; i < serialsAndIndices.size(); i++) {
+        ObjectClass* pObject = slots[serialsAndIndices[i].second].pObject;
+        stream.writeUint32(pObject->getObjectID());
+        currentGame->SaveObject(stream, pObject);
     }
 }
 
 void ObjectManager::load(Stream& stream) {
-    nextFreeObjectID = stream.readUint32();
+    clear();
+
+    Uint32 numSlots = stream.readUint32();
+    slots.resize(numSlots);
+    for(Uint32 i = 0; i < numSlots; i++) {
+        slots[i].pObject = NULL;
+        slots[i].generation = stream.readUint16();
+        slots[i].serial = 0;
+    }
+
+    Uint32 numFreeSlots = stream.readUint32();
+    for(Uint32 i = 0; i < numFreeSlots; i++) {
+        freeSlots.push_back(stream.readUint32());
+    }
 
     Uint32 numObjects = stream.readUint32();
     for(Uint32 i=0;i<numObjects;i++) {
@@ -45,19 +80,63 @@ void ObjectManager::load(Stream& stream) {
 			fprintf(stderr,"ObjectManager::load(): The loaded object has a different ID than expected (%d!=%d)!\n",objectID,pObject->getObjectID());
 		}
 
-        objectMap.insert( std::pair<Uint32,ObjectClass*>(objectID, pObject) );
+        Uint32 index = objectID & INDEX_MASK;
+        if((index >= slots.size()) || (slots[index].generation != (objectID >> INDEX_BITS)) || (slots[index].pObject != NULL)) {
+			fprintf(stderr,"ObjectManager::load(): The ObjectID %d does not fit to the loaded slots!\n",objectID);
+			continue;
+        }
+
+        slots[index].pObject = pObject;
+        slots[index].serial = nextSerial++;
+
+        currentGameMap->getObjectGrid()->update(pObject);
     }
 }
 
 Uint32 ObjectManager::AddObject(ObjectClass* pObject) {
-    std::pair<ObjectMap::iterator,bool> insertPosition;
-
-    insertPosition = objectMap.insert( std::pair<Uint32,ObjectClass*>(nextFreeObjectID, pObject) );
+    Uint32 index;
 
-    if(insertPosition.second == false) {
-        // there is already such an object in the list
-        return NONE;
+    if((freeSlots.size() > MIN_FREE_SLOTS) || ((slots.size() > INDEX_MASK) && (freeSlots.empty() == false))) {
+        index = freeSlots.front();
+        freeSlots.pop_front();
+    } else if(slots.size() <= INDEX_MASK) {
+        index = slots.size();
+        Slot newSlot;
+        newSlot.generation = 0;
+        slots.push_back(newSlot);
     } else {
-        return nextFreeObjectID++;  // Caution: Old value is returned but value is incremented afterwards
+        fprintf(stderr,"ObjectManager::AddObject(): There are no free slots left!\n");
+        return NONE;
+    }
+
+    slots[index].pObject = pObject;
+    slots[index].serial = nextSerial++;
+
+    return (slots[index].generation << INDEX_BITS) | index;
+}
+
+bool ObjectManager::RemoveObject(Uint32 ObjectID) {
+    if(getObject(ObjectID) == NULL) {
+        return false;
     }
+
+    Uint32 index = ObjectID & INDEX_MASK;
+    slots[index].pObject = NULL;
+    slots[index].generation = (slots[index].generation < MAX_GENERATION) ? slots[index].generation + 1 : 0;
+    freeSlots.push_back(index);
+
+    return true;
+}
+
+void ObjectManager::clear() {
+    slots.clear();
+    freeSlots.clear();
+    nextSerial = 0;
+
+    // slot 0 is reserved
+    Slot reservedSlot;
+    reservedSlot.pObject = NULL;
+    reservedSlot.generation = MAX_GENERATION;
+    reservedSlot.serial = 0;
+    slots.push_back(reservedSlot);
 }
@@ -29,6 +29,8 @@
 
 #include <misc/draw_util.h>
 
+#include <stdexcept>
+
 
 #define NUM_STATIC_FRAMES 21
 #define NUM_STATIC_FRAME_TIME 5
@@ -38,7 +40,8 @@
 SDL_Rect RadarPosition = { 14, RADARVIEW_BORDERTHICKNESS, 128, 128 };
 
 RadarView::RadarView(int x, int y)
-	: currentRadarMode(Mode_RadarOff), animFrame(NUM_STATIC_FRAMES - 1), animCounter(NUM_STATIC_FRAME_TIME)
+	: currentRadarMode(Mode_RadarOff), animFrame(NUM_STATIC_FRAMES - 1), animCounter(NUM_STATIC_FRAME_TIME),
+	  radarSurface(NULL), pRadarMap(NULL), bRadarOn(false), bDebug(false), scale(1), offsetX(0), offsetY(0)
 {
     radarStaticAnimation = pGFXManager->getUIGraphic(UI_RadarAnimation);
 
@@ -51,6 +54,9 @@ RadarView::RadarView(int x, int y)
 
 RadarView::~RadarView()
 {
+    if(radarSurface != NULL) {
+        SDL_FreeSurface(radarSurface);
+    }
 }
 
 void RadarView::switchRadarMode(bool bOn)
@@ -75,7 +81,7 @@ void RadarView::setRadarMode(bool bStatus)
     }
 }
 
-void RadarView::draw() const
+void RadarView::draw()
 {
     switch(currentRadarMode) {
         case Mode_RadarOff:
@@ -84,36 +90,11 @@ void RadarView::draw() const
             int MapSizeX = currentGameMap->sizeX;
             int MapSizeY = currentGameMap->sizeY;
 
-            int scale = 1;
-            int offsetX = 0;
-            int offsetY = 0;
-
-            calculateScaleAndOffsets(MapSizeX, MapSizeY, scale, offsetX, offsetY);
-
-            // Lock the screen for direct access to the pixels
-            if (!SDL_MUSTLOCK(screen) || (SDL_LockSurface(screen) == 0)) {
-                for (int x = 0; x <  MapSizeX; x++) {
-                    for (int y = 0; y <  MapSizeY; y++) {
+            updateRadarSurface();
 
-                        TerrainClass* tempTerrain = &currentGameMap->cell[x][y];
-
-                        /* Selecting the right color is handled in TerrainClass::getRadarColor() */
-                        Uint32 color = tempTerrain->getRadarColor(pLocalHouse, pLocalHouse->hasRadarOn());
-
-                        for(int i = 0; i < scale; i++) {
-                            for(int j = 0; j < scale; j++) {
-                                putpixel(   screen,
-                                            radarPosition.x + offsetX + scale*x + i,
-                                            radarPosition.y + offsetY + scale*y + j,
-                                            color);
-                            }
-                        }
-                    }
-                }
-
-				if (SDL_MUSTLOCK(screen))
-					SDL_UnlockSurface(screen);
-            }
+            SDL_Rect source = { offsetX, offsetY, MapSizeX*scale, MapSizeY*scale };
+            SDL_Rect dest = { radarPosition.x + offsetX, radarPosition.y + offsetY, source.w, source.h };
+            SDL_BlitSurface(radarSurface, &source, screen, &dest);
 
             SDL_Rect RadarRect;
             RadarRect.x = (screenborder->getLeft() * MapSizeX*scale) / (MapSizeX*BLOCKSIZE) + offsetX;
@@ -199,6 +180,53 @@ void RadarView::update()
     }
 }
 
+void RadarView::updateRadarSurface()
+{
+    if(radarSurface == NULL) {
+        if((radarSurface = SDL_CreateRGBSurface(SDL_HWSURFACE, 128, 128, 8, 0, 0, 0, 0)) == NULL) {
+            throw std::runtime_error("RadarView::updateRadarSurface(): Cannot create radar surface!");
+        }
+        SDL_SetColors(radarSurface, screen->format->palette->colors, 0, screen->format->palette->ncolors);
+        pRadarMap = NULL;
+    }
+
+    int MapSizeX = currentGameMap->sizeX;
+    int MapSizeY = currentGameMap->sizeY;
+
+    if((pRadarMap != currentGameMap) || (bRadarOn != pLocalHouse->hasRadarOn()) || (bDebug != debug)) {
+        // draw everything again
+        pRadarMap = currentGameMap;
+        bRadarOn = pLocalHouse->hasRadarOn();
+        bDebug = debug;
+        calculateScaleAndOffsets(MapSizeX, MapSizeY, scale, offsetX, offsetY);
+
+        currentGameMap->takeRadarJournal(changedTiles);
+
+        for(int y = 0; y < MapSizeY; y++) {
+            for(int x = 0; x < MapSizeX; x++) {
+                updateTile(x, y);
+            }
+        }
+        return;
+    }
+
+    currentGameMap->takeRadarJournal(changedTiles);
+    for(std::vector<Coord>::const_iterator iter = changedTiles.begin(); iter != changedTiles.end(); ++iter) {
+        updateTile(iter->x, iter->y);
+    }
+}
+
+void RadarView::updateTile(int x, int y)
+{
+    TerrainClass* pTile = currentGameMap->getCell(x, y);
+
+    /* Selecting the right color is handled in TerrainClass::getRadarColor() */
+    Uint32 color = pTile->getRadarColor(pLocalHouse, bRadarOn);
+
+    SDL_Rect dest = { offsetX + scale*x, offsetY + scale*y, scale, scale };
+    SDL_FillRect(radarSurface, &dest, color);
+}
+
 Coord RadarView::getWorldCoords(int mouseX, int mouseY) const
 {
     Coord positionOnRadar(mouseX - radarPosition.x, mouseY - radarPosition.y);
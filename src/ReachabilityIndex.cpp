@@ -0,0 +1,313 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ReachabilityIndex.h>
+
+#include <MapClass.h>
+#include <ClusterGraph.h>
+#include <mmath.h>
+
+#include <algorithm>
+
+#define NO_COMPONENT    (-1)
+#define UNLABELED       (-2)
+
+ReachabilityIndex::ReachabilityIndex(MapClass* pMap) {
+    this->pMap = pMap;
+    sizeX = pMap->sizeX;
+    sizeY = pMap->sizeY;
+
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        labellings[i].bBuilt = false;
+    }
+}
+
+ReachabilityIndex::~ReachabilityIndex() {
+}
+
+void ReachabilityIndex::tileChanged(const Coord& pos) {
+    if(pMap->cellExists(pos) == false) {
+        return;
+    }
+
+    int index = getIndex(pos.x, pos.y);
+
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        MOVEMENTCLASS movementClass = (MOVEMENTCLASS) i;
+        if((movementClass == MOVEMENTCLASS_WHEELED) || (movementClass == MOVEMENTCLASS_AIR)) {
+            // wheeled units share the labelling of tracked units and air units can reach everything
+            continue;
+        }
+
+        Labelling& labelling = labellings[i];
+        if(labelling.bBuilt == false) {
+            continue;
+        }
+
+        bool bPassable = pMap->getClusterGraph()->isPassable(movementClass, pos.x, pos.y);
+        int oldLabel = labelling.labels[index];
+
+        // the labels of the neighbours in the order of their angles; consecutive neighbours are adjacent to each other
+        int neighbourLabels[NUM_ANGLES];
+        int neighbourIndices[NUM_ANGLES];
+        for(int angle = 0; angle < NUM_ANGLES; angle++) {
+            Coord next = pMap->getMapPos(angle, pos);
+            if(pMap->cellExists(next)) {
+                neighbourIndices[angle] = getIndex(next.x, next.y);
+                neighbourLabels[angle] = labelling.labels[neighbourIndices[angle]];
+            } else {
+                neighbourIndices[angle] = -1;
+                neighbourLabels[angle] = NO_COMPONENT;
+            }
+        }
+
+        if((bPassable == true) && (oldLabel == NO_COMPONENT)) {
+            // merge all neighbouring components into the biggest one
+            int newLabel = NO_COMPONENT;
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                int label = neighbourLabels[angle];
+                if((label != NO_COMPONENT) && ((newLabel == NO_COMPONENT) || (labelling.componentSizes[label] > labelling.componentSizes[newLabel]))) {
+                    newLabel = label;
+                }
+            }
+
+            if(newLabel == NO_COMPONENT) {
+                newLabel = labelling.componentSizes.size();
+                labelling.componentSizes.push_back(0);
+            }
+
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                if(neighbourIndices[angle] < 0) {
+                    continue;
+                }
+
+                // read the label again as it might have changed by relabelling another neighbour
+                int label = labelling.labels[neighbourIndices[angle]];
+                if((label != NO_COMPONENT) && (label != newLabel)) {
+                    int numRelabelled = relabel(labelling, neighbourIndices[angle], label, newLabel);
+                    labelling.componentSizes[newLabel] += numRelabelled;
+                    labelling.componentSizes[label] -= numRelabelled;
+                }
+            }
+
+            labelling.labels[index] = newLabel;
+            labelling.componentSizes[newLabel]++;
+        } else if((bPassable == false) && (oldLabel != NO_COMPONENT)) {
+            labelling.labels[index] = NO_COMPONENT;
+            labelling.componentSizes[oldLabel]--;
+
+            // group the passable neighbours by their connections around this tile. Neighbours with consecutive
+            // angles are adjacent and so are the straight neighbours on both sides of a diagonal one.
+            int group[NUM_ANGLES];
+            int numGroups = 0;
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                group[angle] = (neighbourLabels[angle] != NO_COMPONENT) ? numGroups++ : -1;
+            }
+
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                int partners[2] = { (angle + 1) % NUM_ANGLES, (angle % 2 == 0) ? (angle + 2) % NUM_ANGLES : -1 };
+                for(int j = 0; j < 2; j++) {
+                    int partner = partners[j];
+                    if((partner < 0) || (group[angle] < 0) || (group[partner] < 0) || (group[angle] == group[partner])) {
+                        continue;
+                    }
+
+                    int oldGroup = std::max(group[angle], group[partner]);
+                    int newGroup = std::min(group[angle], group[partner]);
+                    for(int k = 0; k < NUM_ANGLES; k++) {
+                        if(group[k] == oldGroup) {
+                            group[k] = newGroup;
+                        }
+                    }
+                }
+            }
+
+            // all neighbours of one group stay connected. If there is more than one group the component might have been split,
+            // so every group except the last one gets a new label if it is not connected to a previous group
+            int lastGroup = -1;
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                lastGroup = std::max(lastGroup, group[angle]);
+            }
+
+            for(int angle = 0; angle < NUM_ANGLES; angle++) {
+                if((group[angle] < 0) || (group[angle] == lastGroup) || (labelling.labels[neighbourIndices[angle]] != oldLabel)) {
+                    continue;
+                }
+
+                int newLabel = labelling.componentSizes.size();
+                labelling.componentSizes.push_back(0);
+                int numRelabelled = relabel(labelling, neighbourIndices[angle], oldLabel, newLabel);
+                labelling.componentSizes[newLabel] = numRelabelled;
+                labelling.componentSizes[oldLabel] -= numRelabelled;
+            }
+        }
+
+        if(labelling.componentSizes.size() > (unsigned int) (sizeX*sizeY)) {
+            // too many unused labels => start again from scratch on the next query
+            labelling.bBuilt = false;
+            labelling.labels.clear();
+            labelling.componentSizes.clear();
+        }
+    }
+}
+
+void ReachabilityIndex::invalidateAll() {
+    for(int i = 0; i < NUM_MOVEMENTCLASSES; i++) {
+        labellings[i].bBuilt = false;
+        labellings[i].labels.clear();
+        labellings[i].componentSizes.clear();
+    }
+}
+
+bool ReachabilityIndex::isReachable(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination) {
+    if((movementClass == MOVEMENTCLASS_AIR) || (pMap->cellExists(start) == false) || (pMap->cellExists(destination) == false)) {
+        return true;
+    }
+
+    Labelling& labelling = getLabelling(movementClass);
+
+    int startLabel = labelling.labels[getIndex(start.x, start.y)];
+    if(startLabel == NO_COMPONENT) {
+        return true;
+    }
+
+    int destinationLabel = labelling.labels[getIndex(destination.x, destination.y)];
+    if(destinationLabel == startLabel) {
+        return true;
+    } else if(destinationLabel != NO_COMPONENT) {
+        return false;
+    }
+
+    // the destination is impassable => it is enough to get next to it
+    for(int angle = 0; angle < NUM_ANGLES; angle++) {
+        Coord next = pMap->getMapPos(angle, destination);
+        if(pMap->cellExists(next) && (labelling.labels[getIndex(next.x, next.y)] == startLabel)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Coord ReachabilityIndex::findClosestReachableTile(MOVEMENTCLASS movementClass, const Coord& start, const Coord& destination) {
+    if((movementClass == MOVEMENTCLASS_AIR) || (pMap->cellExists(start) == false)) {
+        return destination;
+    }
+
+    Labelling& labelling = getLabelling(movementClass);
+
+    int startLabel = labelling.labels[getIndex(start.x, start.y)];
+    if(startLabel == NO_COMPONENT) {
+        return destination;
+    }
+
+    Coord bestCoord = start;
+    FixPoint bestDistance = blockDistance(start, destination);
+
+    // search in growing squares around the destination; the tiles on the square with radius r are at least r away
+    int maxRadius = std::max(sizeX, sizeY);
+    for(int r = 0; (r < bestDistance) && (r <= maxRadius); r++) {
+        for(int y = destination.y - r; y <= destination.y + r; y++) {
+            int step = ((y == destination.y - r) || (y == destination.y + r)) ? 1 : std::max(1, 2*r);
+            for(int x = destination.x - r; x <= destination.x + r; x += step) {
+                if((pMap->cellExists(x, y) == false) || (labelling.labels[getIndex(x, y)] != startLabel)) {
+                    continue;
+                }
+
+                Coord pos(x, y);
+                FixPoint distance = blockDistance(pos, destination);
+                if(distance < bestDistance) {
+                    bestDistance = distance;
+                    bestCoord = pos;
+                }
+            }
+        }
+    }
+
+    return bestCoord;
+}
+
+ReachabilityIndex::Labelling& ReachabilityIndex::getLabelling(MOVEMENTCLASS movementClass) {
+    if(movementClass == MOVEMENTCLASS_WHEELED) {
+        // wheeled and tracked units can pass the same terrain
+        movementClass = MOVEMENTCLASS_TRACKED;
+    }
+
+    Labelling& labelling = labellings[movementClass];
+    if(labelling.bBuilt == false) {
+        build(movementClass);
+    }
+
+    return labelling;
+}
+
+void ReachabilityIndex::build(MOVEMENTCLASS movementClass) {
+    Labelling& labelling = labellings[movementClass];
+
+    ClusterGraph* pClusterGraph = pMap->getClusterGraph();
+
+    labelling.labels.assign(sizeX*sizeY, NO_COMPONENT);
+    labelling.componentSizes.clear();
+
+    for(int y = 0; y < sizeY; y++) {
+        for(int x = 0; x < sizeX; x++) {
+            if(pClusterGraph->isPassable(movementClass, x, y)) {
+                labelling.labels[getIndex(x, y)] = UNLABELED;
+            }
+        }
+    }
+
+    for(int index = 0; index < sizeX*sizeY; index++) {
+        if(labelling.labels[index] == UNLABELED) {
+            int newLabel = labelling.componentSizes.size();
+            labelling.componentSizes.push_back(0);
+            labelling.componentSizes[newLabel] = relabel(labelling, index, UNLABELED, newLabel);
+        }
+    }
+
+    labelling.bBuilt = true;
+}
+
+int ReachabilityIndex::relabel(Labelling& labelling, int startIndex, int oldLabel, int newLabel) {
+    int numRelabelled = 1;
+
+    labelling.labels[startIndex] = newLabel;
+    stack.clear();
+    stack.push_back(startIndex);
+
+    while(stack.empty() == false) {
+        int index = stack.back();
+        stack.pop_back();
+
+        Coord current(index % sizeX, index / sizeX);
+        for(int angle = 0; angle < NUM_ANGLES; angle++) {
+            Coord next = pMap->getMapPos(angle, current);
+            if(pMap->cellExists(next) == false) {
+                continue;
+            }
+
+            int nextIndex = getIndex(next.x, next.y);
+            if(labelling.labels[nextIndex] == oldLabel) {
+                labelling.labels[nextIndex] = newLabel;
+                numRelabelled++;
+                stack.push_back(nextIndex);
+            }
+        }
+    }
+
+    return numRelabelled;
+}
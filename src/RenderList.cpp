@@ -0,0 +1,169 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <RenderList.h>
+
+#include <globals.h>
+
+#include <FileClasses/GFXManager.h>
+#include <misc/draw_util.h>
+
+#include <Game.h>
+#include <House.h>
+#include <MapClass.h>
+#include <ScreenBorder.h>
+#include <TerrainClass.h>
+
+RenderList::RenderList() {
+}
+
+RenderList::~RenderList() {
+}
+
+void RenderList::build(const Coord& topLeftTile, const Coord& bottomRightTile) {
+    for(int i = 0; i < NUM_LAYERS; i++) {
+        layers[i].clear();
+    }
+
+    int houseID = pLocalHouse->getHouseID();
+
+    for(int y = topLeftTile.y; y <= bottomRightTile.y; y++) {
+        for(int x = topLeftTile.x; x <= bottomRightTile.x; x++) {
+            TileCommand tileCommand;
+            tileCommand.pCell = currentGameMap->cellExists(x, y) ? currentGameMap->getCell(x, y) : NULL;
+            tileCommand.screenX = screenborder->world2screenX(x*BLOCKSIZE);
+            tileCommand.screenY = screenborder->world2screenY(y*BLOCKSIZE);
+
+            if(debug == false) {
+                layers[Layer_Shade].push_back(tileCommand);
+            }
+
+            TerrainClass* pCell = tileCommand.pCell;
+            if(pCell == NULL) {
+                continue;
+            }
+
+            bool bFogged = pCell->isFogged(houseID);
+
+            if(pCell->hasANonInfantryGroundObject()) {
+                if(pCell->getNonInfantryGroundObject()->isAStructure()) {
+                    layers[Layer_Structures].push_back(tileCommand);
+                }
+
+                if(bFogged == false) {
+                    layers[Layer_NonInfantryGroundUnits].push_back(tileCommand);
+                }
+            }
+
+            if(bFogged == false) {
+                if(pCell->hasAnUndergroundUnit()) {
+                    layers[Layer_UndergroundUnits].push_back(tileCommand);
+                }
+
+                if(pCell->hasDeadUnits()) {
+                    layers[Layer_DeadUnits].push_back(tileCommand);
+                }
+
+                if(pCell->hasInfantry()) {
+                    layers[Layer_Infantry].push_back(tileCommand);
+                }
+            }
+
+            if(pCell->hasAnAirUnit()) {
+                layers[Layer_AirUnits].push_back(tileCommand);
+            }
+
+            if((debug || pCell->isExplored(houseID)) && (bFogged == false)) {
+                if(pCell->hasAnUndergroundUnit() || pCell->hasInfantry() || pCell->hasANonInfantryGroundObject() || pCell->hasAnAirUnit()) {
+                    layers[Layer_SelectionRects].push_back(tileCommand);
+                }
+            }
+        }
+    }
+}
+
+void RenderList::draw(Layer layer) const {
+    std::vector<TileCommand>::const_iterator iter;
+    for(iter = layers[layer].begin(); iter != layers[layer].end(); ++iter) {
+        TerrainClass* pCell = iter->pCell;
+
+        switch(layer) {
+            case Layer_Structures:              pCell->blitStructures(iter->screenX, iter->screenY);                break;
+            case Layer_UndergroundUnits:        pCell->blitUndergroundUnits(iter->screenX, iter->screenY);          break;
+            case Layer_DeadUnits:               pCell->blitDeadUnits(iter->screenX, iter->screenY);                 break;
+            case Layer_Infantry:                pCell->blitInfantry(iter->screenX, iter->screenY);                  break;
+            case Layer_NonInfantryGroundUnits:  pCell->blitNonInfantryGroundUnits(iter->screenX, iter->screenY);    break;
+            case Layer_AirUnits:                pCell->blitAirUnits(iter->screenX, iter->screenY);                  break;
+            case Layer_SelectionRects:          pCell->blitSelectionRects(iter->screenX, iter->screenY);            break;
+            case Layer_Shade:                   drawShade(*iter);                                                   break;
+            default:                                                                                                break;
+        }
+    }
+}
+
+void RenderList::drawShade(const TileCommand& tileCommand) const {
+    SDL_Surface* hiddenSurf = pGFXManager->getObjPic(ObjPic_Terrain_Hidden);
+
+    SDL_Rect source = { 0, 0, BLOCKSIZE, BLOCKSIZE };
+    SDL_Rect drawLocation = { tileCommand.screenX, tileCommand.screenY, BLOCKSIZE, BLOCKSIZE };
+
+    TerrainClass* pCell = tileCommand.pCell;
+    int houseID = pLocalHouse->getHouseID();
+
+    if((pCell == NULL) || (pCell->isExplored(houseID) == false)) {
+        // unexplored or outside the map => draw complete hidden
+        source.x = BLOCKSIZE*15;
+        SDL_BlitSurface(hiddenSurf, &source, screen, &drawLocation);
+        return;
+    }
+
+    int hideTile = pCell->getHideTile(houseID);
+
+    if(hideTile != 0) {
+        source.x = hideTile*BLOCKSIZE;
+        SDL_BlitSurface(hiddenSurf, &source, screen, &drawLocation);
+    }
+
+    if(currentGame->getGameInitSettings().hasFogOfWar() == true) {
+        int fogTile = pCell->getFogTile(houseID);
+
+        if(pCell->isFogged(houseID) == true) {
+            fogTile = Terrain_HiddenFull;
+        }
+
+        if(fogTile != 0) {
+            source.x = fogTile*BLOCKSIZE;
+
+            SDL_Rect mini = {0, 0, 1, 1};
+            SDL_Rect drawLoc = {drawLocation.x, drawLocation.y, 0, 0};
+
+            SDL_Surface* fogSurf = pGFXManager->getTransparent40Surface();
+
+            SDL_LockSurface(hiddenSurf);
+            for(int i=0;i<BLOCKSIZE; i++) {
+                for(int j=0;j<BLOCKSIZE; j++) {
+                    if(getpixel(hiddenSurf,source.x+i,source.y+j) == 12) {
+                        drawLoc.x = drawLocation.x + i;
+                        drawLoc.y = drawLocation.y + j;
+                        SDL_BlitSurface(fogSurf,&mini,screen,&drawLoc);
+                    }
+                }
+            }
+            SDL_UnlockSurface(hiddenSurf);
+        }
+    }
+}
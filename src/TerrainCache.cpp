@@ -0,0 +1,117 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <TerrainCache.h>
+
+#include <globals.h>
+
+#include <House.h>
+#include <MapClass.h>
+#include <ScreenBorder.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+TerrainCache::TerrainCache(MapClass* pMap) {
+    this->pMap = pMap;
+    sizeX = pMap->sizeX;
+    sizeY = pMap->sizeY;
+    pSurface = NULL;
+
+    tileStates.assign(sizeX*sizeY, TileState_Dirty);
+}
+
+TerrainCache::~TerrainCache() {
+    if(pSurface != NULL) {
+        SDL_FreeSurface(pSurface);
+    }
+}
+
+void TerrainCache::invalidate(const Coord& pos) {
+    for(int y = std::max(0, pos.y - REACH_LEFT_UP); y <= std::min(sizeY - 1, pos.y + REACH_RIGHT_DOWN); y++) {
+        for(int x = std::max(0, pos.x - REACH_LEFT_UP); x <= std::min(sizeX - 1, pos.x + REACH_RIGHT_DOWN); x++) {
+            tileStates[getIndex(x, y)] |= TileState_Dirty;
+        }
+    }
+}
+
+void TerrainCache::invalidateAll() {
+    for(unsigned int i = 0; i < tileStates.size(); i++) {
+        tileStates[i] |= TileState_Dirty;
+    }
+}
+
+void TerrainCache::draw(const Coord& topLeftTile, const Coord& bottomRightTile) {
+    if(pSurface == NULL) {
+        if((pSurface = SDL_CreateRGBSurface(SDL_HWSURFACE, sizeX*BLOCKSIZE, sizeY*BLOCKSIZE, 8, 0, 0, 0, 0)) == NULL) {
+            throw std::runtime_error("TerrainCache::draw(): Cannot create terrain cache surface!");
+        }
+        SDL_SetColors(pSurface, screen->format->palette->colors, 0, screen->format->palette->ncolors);
+    }
+
+    int x1 = std::max(0, topLeftTile.x);
+    int y1 = std::max(0, topLeftTile.y);
+    int x2 = std::min(sizeX - 1, bottomRightTile.x);
+    int y2 = std::min(sizeY - 1, bottomRightTile.y);
+
+    if((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+
+    // tracks and damage are not drawn on fogged tiles. The surrounding tiles are checked too as their damage may reach into the drawn tiles.
+    int houseID = pLocalHouse->getHouseID();
+    for(int y = std::max(0, y1 - REACH_RIGHT_DOWN); y <= std::min(sizeY - 1, y2 + REACH_LEFT_UP); y++) {
+        for(int x = std::max(0, x1 - REACH_RIGHT_DOWN); x <= std::min(sizeX - 1, x2 + REACH_LEFT_UP); x++) {
+            Uint8& tileState = tileStates[getIndex(x, y)];
+            bool bFogged = pMap->getCell(x, y)->isFogged(houseID);
+            if(bFogged != ((tileState & TileState_Fogged) != 0)) {
+                tileState ^= TileState_Fogged;
+                invalidate(Coord(x, y));
+            }
+        }
+    }
+
+    for(int y = y1; y <= y2; y++) {
+        for(int x = x1; x <= x2; x++) {
+            if(tileStates[getIndex(x, y)] & TileState_Dirty) {
+                redrawTile(x, y);
+            }
+        }
+    }
+
+    SDL_Rect source = { x1*BLOCKSIZE, y1*BLOCKSIZE, (x2 - x1 + 1)*BLOCKSIZE, (y2 - y1 + 1)*BLOCKSIZE };
+    SDL_Rect drawLocation = { screenborder->world2screenX(x1*BLOCKSIZE), screenborder->world2screenY(y1*BLOCKSIZE), source.w, source.h };
+    SDL_BlitSurface(pSurface, &source, screen, &drawLocation);
+}
+
+void TerrainCache::redrawTile(int x, int y) {
+    SDL_Rect tileRect = { x*BLOCKSIZE, y*BLOCKSIZE, BLOCKSIZE, BLOCKSIZE };
+
+    SDL_SetClipRect(pSurface, &tileRect);
+    SDL_FillRect(pSurface, &tileRect, 0);
+
+    // draw in the same order as the tiles are drawn row by row
+    for(int j = std::max(0, y - REACH_RIGHT_DOWN); j <= std::min(sizeY - 1, y + REACH_LEFT_UP); j++) {
+        for(int i = std::max(0, x - REACH_RIGHT_DOWN); i <= std::min(sizeX - 1, x + REACH_LEFT_UP); i++) {
+            pMap->getCell(i, j)->blitGround(pSurface, i*BLOCKSIZE, j*BLOCKSIZE);
+        }
+    }
+
+    SDL_SetClipRect(pSurface, NULL);
+
+    tileStates[getIndex(x, y)] &= ~TileState_Dirty;
+}
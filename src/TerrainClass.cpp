@@ -26,6 +26,8 @@
 #include <House.h>
 #include <SoundPlayer.h>
 #include <ScreenBorder.h>
+#include <TerrainCache.h>
+#include <FogOfWar.h>
 #include <ConcatIterator.h>
 
 #include <structures/StructureClass.h>
@@ -37,17 +39,12 @@
 TerrainClass::TerrainClass() {
 	type = Terrain_Sand;
 
-	for(int i = 0; i < MAX_PLAYERS; i++) {
-		explored[i] = false;
-		lastAccess[i] = 0;
-	}
-
 	fogColor = COLOR_BLACK;
 
 	owner = INVALID;
 	sandRegion = NONE;
 
-	spice = 0.0;
+	spice = 0;
 
 	sprite = pGFXManager->getObjPic(ObjPic_Terrain);
 
@@ -68,20 +65,12 @@ TerrainClass::~TerrainClass() {
 void TerrainClass::load(Stream& stream) {
 	type = stream.readUint32();
 
-	for(int i=0;i<MAX_PLAYERS;i++) {
-        explored[i] = stream.readBool();
-	}
-
-    for(int i=0;i<MAX_PLAYERS;i++) {
-        lastAccess[i] = stream.readUint32();
-	}
-
 	fogColor = stream.readUint32();
 
 	owner = stream.readSint32();
 	sandRegion = stream.readUint32();
 
-	spice = stream.readDouble();
+	spice = stream.readFixPoint();
 
 	Uint32 numDamage = stream.readUint32();
 	for(Uint32 i=0; i<numDamage; i++) {
@@ -113,29 +102,25 @@ void TerrainClass::load(Stream& stream) {
         tracksCounter[i] = stream.readSint16();
     }
 
-	assignedAirUnitList = stream.readUint32List();
-	assignedInfantryList = stream.readUint32List();
-	assignedUndergroundUnitList = stream.readUint32List();
-	assignedNonInfantryGroundObjectList = stream.readUint32List();
+	std::list<Uint32> assignedAirUnitIDs = stream.readUint32List();
+	assignedAirUnitList.assign(assignedAirUnitIDs.begin(), assignedAirUnitIDs.end());
+	std::list<Uint32> assignedInfantryIDs = stream.readUint32List();
+	assignedInfantryList.assign(assignedInfantryIDs.begin(), assignedInfantryIDs.end());
+	std::list<Uint32> assignedUndergroundUnitIDs = stream.readUint32List();
+	assignedUndergroundUnitList.assign(assignedUndergroundUnitIDs.begin(), assignedUndergroundUnitIDs.end());
+	std::list<Uint32> assignedNonInfantryGroundObjectIDs = stream.readUint32List();
+	assignedNonInfantryGroundObjectList.assign(assignedNonInfantryGroundObjectIDs.begin(), assignedNonInfantryGroundObjectIDs.end());
 }
 
 void TerrainClass::save(Stream& stream) const {
 	stream.writeUint32(type);
 
-    for(int i=0;i<MAX_PLAYERS;i++) {
-        stream.writeBool(explored[i]);
-	}
-
-    for(int i=0;i<MAX_PLAYERS;i++) {
-        stream.writeUint32(lastAccess[i]);
-	}
-
 	stream.writeUint32(fogColor);
 
 	stream.writeUint32(owner);
 	stream.writeUint32(sandRegion);
 
-	stream.writeDouble(spice);
+	stream.writeFixPoint(spice);
 
 	stream.writeUint32(damage.size());
     for(std::vector<DAMAGETYPE>::const_iterator iter = damage.begin(); iter != damage.end(); ++iter) {
@@ -161,18 +146,25 @@ void TerrainClass::save(Stream& stream) const {
         stream.writeSint16(tracksCounter[i]);
     }
 
-	stream.writeUint32List(assignedAirUnitList);
-	stream.writeUint32List(assignedInfantryList);
-	stream.writeUint32List(assignedUndergroundUnitList);
-	stream.writeUint32List(assignedNonInfantryGroundObjectList);
+	stream.writeUint32List(std::list<Uint32>(assignedAirUnitList.begin(), assignedAirUnitList.end()));
+	stream.writeUint32List(std::list<Uint32>(assignedInfantryList.begin(), assignedInfantryList.end()));
+	stream.writeUint32List(std::list<Uint32>(assignedUndergroundUnitList.begin(), assignedUndergroundUnitList.end()));
+	stream.writeUint32List(std::list<Uint32>(assignedNonInfantryGroundObjectList.begin(), assignedNonInfantryGroundObjectList.end()));
 }
 
 void TerrainClass::assignAirUnit(Uint32 newObjectID) {
 	assignedAirUnitList.push_back(newObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
 void TerrainClass::assignNonInfantryGroundObject(Uint32 newObjectID) {
 	assignedNonInfantryGroundObjectList.push_back(newObjectID);
+	currentGameMap->journalRadarChange(location);
+
+	if(assignedNonInfantryGroundObjectList.size() == 1) {
+		// the ground is not drawn below structures
+		currentGameMap->getTerrainCache()->invalidate(location);
+	}
 }
 
 int TerrainClass::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
@@ -185,7 +177,7 @@ int TerrainClass::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
 			used[i] = false;
 
 
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			InfantryClass* infant = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
 			if(infant == NULL) {
@@ -208,15 +200,17 @@ int TerrainClass::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
 	}
 
 	assignedInfantryList.push_back(newObjectID);
+	currentGameMap->journalRadarChange(location);
 	return i;
 }
 
 
 void TerrainClass::assignUndergroundUnit(Uint32 newObjectID) {
 	assignedUndergroundUnitList.push_back(newObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
-void TerrainClass::blitGround(int xPos, int yPos) {
+void TerrainClass::blitGround(SDL_Surface* pSurface, int xPos, int yPos) {
 	SDL_Rect	source = { getTerrainTile()*BLOCKSIZE, 0, BLOCKSIZE, BLOCKSIZE };
 	SDL_Rect    drawLocation = { xPos, yPos, BLOCKSIZE, BLOCKSIZE };
 
@@ -224,13 +218,13 @@ void TerrainClass::blitGround(int xPos, int yPos) {
 
 		//draw terrain
 		if(destroyedStructureTile == DestroyedStructure_None || destroyedStructureTile == DestroyedStructure_Wall) {
-            SDL_BlitSurface(sprite, &source, screen, &drawLocation);
+            SDL_BlitSurface(sprite, &source, pSurface, &drawLocation);
 		}
 
 		if(destroyedStructureTile != DestroyedStructure_None) {
 		    SDL_Surface* pDestroyedStructureSurface = pGFXManager->getObjPic(ObjPic_DestroyedStructure);
 		    SDL_Rect source2 = { destroyedStructureTile*BLOCKSIZE, 0, BLOCKSIZE, BLOCKSIZE };
-            SDL_BlitSurface(pDestroyedStructureSurface, &source2, screen, &drawLocation);
+            SDL_BlitSurface(pDestroyedStructureSurface, &source2, pSurface, &drawLocation);
 		}
 
 		if(!isFogged(pLocalHouse->getHouseID())) {
@@ -238,19 +232,19 @@ void TerrainClass::blitGround(int xPos, int yPos) {
 		    for(int i=0;i<NUM_ANGLES;i++) {
                 if(tracksCounter[i] > 0) {
                     source.x = ((10-i)%8)*BLOCKSIZE;
-                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_Terrain_Tracks), &source, screen, &drawLocation);
+                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_Terrain_Tracks), &source, pSurface, &drawLocation);
                 }
 		    }
 
             // damage
 		    for(std::vector<DAMAGETYPE>::const_iterator iter = damage.begin(); iter != damage.end(); ++iter) {
                 source.x = iter->tile*BLOCKSIZE;
-                drawLocation.x = screenborder->world2screenX(iter->realPos.x) - BLOCKSIZE/2;
-                drawLocation.y = screenborder->world2screenY(iter->realPos.y) - BLOCKSIZE/2;
+                drawLocation.x = xPos + iter->realPos.x - location.x*BLOCKSIZE - BLOCKSIZE/2;
+                drawLocation.y = yPos + iter->realPos.y - location.y*BLOCKSIZE - BLOCKSIZE/2;
                 if(iter->damageType == Terrain_RockDamage) {
-                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_RockDamage), &source, screen, &drawLocation);
+                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_RockDamage), &source, pSurface, &drawLocation);
                 } else {
-                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_SandDamage), &source, screen, &drawLocation);
+                    SDL_BlitSurface(pGFXManager->getObjPic(ObjPic_SandDamage), &source, pSurface, &drawLocation);
                 }
 		    }
 		}
@@ -354,7 +348,7 @@ void TerrainClass::blitDeadUnits(int xPos, int yPos) {
 
 void TerrainClass::blitInfantry(int xPos, int yPos) {
 	if(hasInfantry() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			InfantryClass* current = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
 
@@ -373,7 +367,7 @@ void TerrainClass::blitInfantry(int xPos, int yPos) {
 
 void TerrainClass::blitNonInfantryGroundUnits(int xPos, int yPos) {
 	if(hasANonInfantryGroundObject() && !isFogged(pLocalHouse->getHouseID())) {
-        std::list<Uint32>::const_iterator iter;
+        ObjectIDList::const_iterator iter;
 		for(iter = assignedNonInfantryGroundObjectList.begin(); iter != assignedNonInfantryGroundObjectList.end() ;++iter) {
 			ObjectClass* current =  currentGame->getObjectManager().getObject(*iter);
 
@@ -389,7 +383,7 @@ void TerrainClass::blitNonInfantryGroundUnits(int xPos, int yPos) {
 
 void TerrainClass::blitAirUnits(int xPos, int yPos) {
 	if(hasAnAirUnit()) {
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedAirUnitList.begin(); iter != assignedAirUnitList.end() ;++iter) {
 			AirUnit* airUnit = (AirUnit*) currentGame->getObjectManager().getObject(*iter);
 
@@ -423,7 +417,7 @@ void TerrainClass::blitSelectionRects(int xPos, int yPos) {
 
     // draw infantry selection rectangles
     if(hasInfantry() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			InfantryClass* current = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
 
@@ -441,7 +435,7 @@ void TerrainClass::blitSelectionRects(int xPos, int yPos) {
 
     // draw non infantry ground object selection rectangles
 	if(hasANonInfantryGroundObject() && !isFogged(pLocalHouse->getHouseID())) {
-	    std::list<Uint32>::const_iterator iter;
+	    ObjectIDList::const_iterator iter;
 		for(iter = assignedNonInfantryGroundObjectList.begin(); iter != assignedNonInfantryGroundObjectList.end() ;++iter) {
             ObjectClass* current = currentGame->getObjectManager().getObject(*iter);
 
@@ -455,7 +449,7 @@ void TerrainClass::blitSelectionRects(int xPos, int yPos) {
 
     // draw air unit selection rectangles
 	if(hasAnAirUnit() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedAirUnitList.begin(); iter != assignedAirUnitList.end() ;++iter) {
 			AirUnit* airUnit = (AirUnit*) currentGame->getObjectManager().getObject(*iter);
 
@@ -472,10 +466,14 @@ void TerrainClass::blitSelectionRects(int xPos, int yPos) {
 	}
 }
 
-void TerrainClass::update() {
+bool TerrainClass::update() {
     for(int i=0;i<NUM_ANGLES;i++) {
         if(tracksCounter[i] > 0) {
             tracksCounter[i]--;
+
+            if(tracksCounter[i] == 0) {
+                currentGameMap->getTerrainCache()->invalidate(location);
+            }
         }
     }
 
@@ -487,9 +485,49 @@ void TerrainClass::update() {
             deadUnits[i].timer--;
         }
     }
+
+    return needsUpdate();
+}
+
+bool TerrainClass::needsUpdate() const {
+    for(int i=0;i<NUM_ANGLES;i++) {
+        if(tracksCounter[i] > 0) {
+            return true;
+        }
+    }
+
+    return !deadUnits.empty();
+}
+
+void TerrainClass::setTrack(Uint8 direction) {
+    if(type == Terrain_Sand || type == Terrain_Dunes
+        || type == Terrain_Spice || type == Terrain_ThickSpice) {
+        if(tracksCounter[direction] == 0) {
+            currentGameMap->getTerrainCache()->invalidate(location);
+        }
+
+        tracksCounter[direction] = 5000;
+        currentGameMap->activateTile(location);
+    }
+}
+
+void TerrainClass::assignDeadUnit(Uint8 type, Uint8 house, const Coord& position) {
+    DEADUNITTYPE newDeadUnit;
+    newDeadUnit.type = type;
+    newDeadUnit.house = house;
+    newDeadUnit.onSand = isSand() || isDunes();
+    newDeadUnit.realPos = position;
+    newDeadUnit.timer = 2000;
+
+    deadUnits.push_back(newDeadUnit);
+    currentGameMap->activateTile(location);
 }
 
 void TerrainClass::clearTerrain() {
+    if(damage.empty() == false) {
+        currentGameMap->getTerrainCache()->invalidate(location);
+    }
+
     damage.clear();
     deadUnits.clear();
 }
@@ -499,15 +537,18 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 	TerrainClass* cell;
 
 	if (bulletType == Bullet_Sandworm) {
-		ConcatIterator<Uint32> iterator;
-		iterator.addList(assignedInfantryList);
-		iterator.addList(assignedNonInfantryGroundObjectList);
+		// damaged objects might be destroyed and removed from the lists, so iterate over copies
+		ObjectIDList infantry = assignedInfantryList;
+		ObjectIDList groundObjects = assignedNonInfantryGroundObjectList;
+		ConcatIterator<Uint32, ObjectIDList> iterator;
+		iterator.addList(infantry);
+		iterator.addList(groundObjects);
 
 		ObjectClass* object;
 		while(!iterator.IterationFinished()) {
 
 			object = currentGame->getObjectManager().getObject(*iterator);
-			if ((object->getX() == location.x) && (object->getY() == location.y)) {
+			if ((object != NULL) && (object->getX() == location.x) && (object->getY() == location.y)) {
 				object->setVisible(VIS_ALL, false);
 				object->handleDamage(bulletDamage, damagerID, damagerOwner);
 			}
@@ -515,7 +556,7 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 		}
 	} else {
 		int			distance;
-		double		damageProp;
+		FixPoint	damageProp;
 
 		if (air == true) {
 			// air damage
@@ -523,15 +564,16 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 			{
 				AirUnit*	airUnit;
 
-				std::list<Uint32>::const_iterator iter;
-				for(iter = assignedAirUnitList.begin(); iter != assignedAirUnitList.end() ;++iter) {
+				ObjectIDList airUnits = assignedAirUnitList;
+				ObjectIDList::const_iterator iter;
+				for(iter = airUnits.begin(); iter != airUnits.end() ;++iter) {
 					airUnit = (AirUnit*) currentGame->getObjectManager().getObject(*iter);
 
 					if(airUnit == NULL)
 						continue;
 
 					Coord centerPoint = airUnit->getCenterPoint();
-					distance = lround(distance_from(centerPoint, realPos));
+					distance = distance_from(centerPoint, realPos).roundToInt();
 					if (distance <= 0) {
 						distance = 1;
 					}
@@ -541,30 +583,38 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 							((UnitClass*)airUnit)->deviate(damagerOwner);
 						}
 
-						damageProp = ((double)(damageRadius + airUnit->getRadius() - distance))/((double)distance);
+						damageProp = FixPoint::fromFraction(damageRadius + airUnit->getRadius() - distance, distance);
 						if (damageProp > 0)	{
-							if (damageProp > 1.0) {
-								damageProp = 1.0;
+							if (damageProp > 1) {
+								damageProp = 1;
 							}
-							airUnit->handleDamage(lround((double)bulletDamage * damageProp), damagerID, damagerOwner);
+							airUnit->handleDamage((damageProp * bulletDamage).roundToInt(), damagerID, damagerOwner);
 						}
 					}
 				}
 			}
 		} else {
 			// non air damage
-			ConcatIterator<Uint32> iterator;
-			iterator.addList(assignedNonInfantryGroundObjectList);
-			iterator.addList(assignedInfantryList);
-			iterator.addList(assignedUndergroundUnitList);
+			ObjectIDList groundObjects = assignedNonInfantryGroundObjectList;
+			ObjectIDList infantry = assignedInfantryList;
+			ObjectIDList undergroundUnits = assignedUndergroundUnitList;
+			ConcatIterator<Uint32, ObjectIDList> iterator;
+			iterator.addList(groundObjects);
+			iterator.addList(infantry);
+			iterator.addList(undergroundUnits);
 
 			ObjectClass* object;
 			while(!iterator.IterationFinished()) {
 
 				object = currentGame->getObjectManager().getObject(*iterator);
+				if(object == NULL) {
+					// already destroyed
+					++iterator;
+					continue;
+				}
 
 				Coord centerPoint = object->getClosestCenterPoint(location);
-				distance = lround(distance_from(centerPoint, realPos));
+				distance = distance_from(centerPoint, realPos).roundToInt();
 				if (distance <= 0) {
 					distance = 1;
 				}
@@ -574,10 +624,10 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 						((UnitClass*)object)->deviate(damagerOwner);
 					}
 
-					damageProp = ((double)(damageRadius + object->getRadius() - distance))/(double)distance;
+					damageProp = FixPoint::fromFraction(damageRadius + object->getRadius() - distance, distance);
 					if (damageProp > 0)	{
-						if (damageProp > 1.0) {
-							damageProp = 1.0;
+						if (damageProp > 1) {
+							damageProp = 1;
 						}
 
 						if((bulletType == Bullet_Sonic) && object->isAStructure()) {
@@ -586,7 +636,7 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
                             damageProp = damageProp/(((pStructure->getStructureSizeX()*pStructure->getStructureSizeY())+1)/2);
 						}
 
-						object->handleDamage(lround((double) bulletDamage * damageProp), damagerID, damagerOwner);
+						object->handleDamage((damageProp * bulletDamage).roundToInt(), damagerID, damagerOwner);
 
 
 						if( (bulletType == Bullet_LargeRocket || bulletType == Bullet_Rocket || bulletType == Bullet_SmallRocket || bulletType == Bullet_SmallRocketHeavy)
@@ -629,6 +679,7 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
                                 newDamage.realPos.y = realPos.y;
 
                                 damage.push_back(newDamage);
+                                currentGameMap->getTerrainCache()->invalidate(location);
 							}
 						} else if((cell->getType() == Terrain_Sand) || (cell->getType() == Terrain_Spice)) {
 							if(damage.size() < DAMAGEPERCELL) {
@@ -639,6 +690,7 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
                                 newDamage.realPos.y = realPos.y;
 
                                 damage.push_back(newDamage);
+                                currentGameMap->getTerrainCache()->invalidate(location);
 							}
 						}
 					}
@@ -650,7 +702,7 @@ void TerrainClass::damageCell(Uint32 damagerID, House* damagerOwner, const Coord
 
 
 void TerrainClass::selectAllPlayersUnits(int houseID, ObjectClass** lastCheckedObject, ObjectClass** lastSelectedObject) {
-	ConcatIterator<Uint32> iterator;
+	ConcatIterator<Uint32, ObjectIDList> iterator;
 	iterator.addList(assignedInfantryList);
 	iterator.addList(assignedNonInfantryGroundObjectList);
 	iterator.addList(assignedUndergroundUnitList);
@@ -673,7 +725,7 @@ void TerrainClass::selectAllPlayersUnits(int houseID, ObjectClass** lastCheckedO
 
 
 void TerrainClass::selectAllPlayersUnitsOfType(int houseID, int itemID, ObjectClass** lastCheckedObject, ObjectClass** lastSelectedObject) {
-	ConcatIterator<Uint32> iterator;
+	ConcatIterator<Uint32, ObjectIDList> iterator;
 	iterator.addList(assignedInfantryList);
 	iterator.addList(assignedNonInfantryGroundObjectList);
 	iterator.addList(assignedUndergroundUnitList);
@@ -696,19 +748,28 @@ void TerrainClass::selectAllPlayersUnitsOfType(int houseID, int itemID, ObjectCl
 
 void TerrainClass::unassignAirUnit(Uint32 ObjectID) {
 	assignedAirUnitList.remove(ObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
 
 void TerrainClass::unassignNonInfantryGroundObject(Uint32 ObjectID) {
+	if(hasANonInfantryGroundObject() && (assignedNonInfantryGroundObjectList.front() == ObjectID)) {
+		// the ground is not drawn below structures
+		currentGameMap->getTerrainCache()->invalidate(location);
+	}
+
 	assignedNonInfantryGroundObjectList.remove(ObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
 void TerrainClass::unassignUndergroundUnit(Uint32 ObjectID) {
 	assignedUndergroundUnitList.remove(ObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
 void TerrainClass::unassignInfantry(Uint32 ObjectID, int currentPosition) {
 	assignedInfantryList.remove(ObjectID);
+	currentGameMap->journalRadarChange(location);
 }
 
 void TerrainClass::unassignObject(Uint32 ObjectID) {
@@ -733,38 +794,33 @@ void TerrainClass::setType(int newType) {
 		if (isRock()) {
 			sandRegion = NONE;
 			if (hasAnUndergroundUnit())	{
-				ObjectClass* current;
-				std::list<Uint32>::const_iterator iter;
-				iter = assignedUndergroundUnitList.begin();
-
-				do {
-					current = currentGame->getObjectManager().getObject(*iter);
-					++iter;
+				// destroying the units modifies the list, so iterate over a copy
+				ObjectIDList undergroundUnits = assignedUndergroundUnitList;
+				ObjectIDList::const_iterator iter;
+				for(iter = undergroundUnits.begin(); iter != undergroundUnits.end(); ++iter) {
+					ObjectClass* current = currentGame->getObjectManager().getObject(*iter);
 
 					if(current == NULL)
 						continue;
 
 					unassignUndergroundUnit(current->getObjectID());
 					current->destroy();
-				} while(iter != assignedUndergroundUnitList.end());
+				}
 			}
 
 			if(type == Terrain_Mountain) {
 				if(hasANonInfantryGroundObject()) {
-					ObjectClass* current;
-					std::list<Uint32>::const_iterator iter;
-					iter = assignedNonInfantryGroundObjectList.begin();
-
-					do {
-						current = currentGame->getObjectManager().getObject(*iter);
-						++iter;
+					ObjectIDList groundObjects = assignedNonInfantryGroundObjectList;
+					ObjectIDList::const_iterator iter;
+					for(iter = groundObjects.begin(); iter != groundObjects.end(); ++iter) {
+						ObjectClass* current = currentGame->getObjectManager().getObject(*iter);
 
 						if(current == NULL)
 							continue;
 
 						unassignNonInfantryGroundObject(current->getObjectID());
 						current->destroy();
-					} while(iter != assignedNonInfantryGroundObjectList.end());
+					}
 				}
 			}
 		}
@@ -777,24 +833,26 @@ void TerrainClass::setType(int newType) {
 			}
 		}
 	}
+
+	currentGameMap->getTerrainCache()->invalidate(location);
+	currentGameMap->journalRadarChange(location);
+	currentGameMap->onTileChanged(location);
 }
 
 
 void TerrainClass::squash() {
 	if(hasInfantry()) {
-		InfantryClass* current;
-		std::list<Uint32>::const_iterator iter;
-		iter = assignedInfantryList.begin();
-
-		do {
-			current = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
-			++iter;
+		// squashed infantry is removed from the list, so iterate over a copy
+		ObjectIDList infantry = assignedInfantryList;
+		ObjectIDList::const_iterator iter;
+		for(iter = infantry.begin(); iter != infantry.end(); ++iter) {
+			InfantryClass* current = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
 
 			if(current == NULL)
 				continue;
 
 			current->squash();
-		} while(iter != assignedInfantryList.end());
+		}
 	}
 }
 
@@ -807,8 +865,8 @@ int TerrainClass::getInfantryTeam() {
 }
 
 
-double TerrainClass::harvestSpice() {
-	double oldSpice = spice;
+FixPoint TerrainClass::harvestSpice() {
+	FixPoint oldSpice = spice;
 
 	if ((spice - HARVESTSPEED) >= 0)
 		spice -= HARVESTSPEED;
@@ -819,7 +877,9 @@ double TerrainClass::harvestSpice() {
 }
 
 
-void TerrainClass::setSpice(double newSpice) {
+void TerrainClass::setSpice(FixPoint newSpice) {
+	Uint32 oldType = type;
+
 	if(newSpice <= 0) {
 		type = Terrain_Sand;
 	} else if(newSpice >= RANDOMTHICKSPICEMIN) {
@@ -828,6 +888,24 @@ void TerrainClass::setSpice(double newSpice) {
 		type = Terrain_Spice;
 	}
 	spice = newSpice;
+
+	if(type != oldType) {
+		currentGameMap->getTerrainCache()->invalidate(location);
+		currentGameMap->journalRadarChange(location);
+	}
+}
+
+void TerrainClass::setOwner(int newOwner) {
+	if(newOwner != owner) {
+		int oldOwner = owner;
+		owner = newOwner;
+		currentGameMap->onOwnerChanged(location, oldOwner, newOwner);
+	}
+}
+
+void TerrainClass::setDestroyedStructureTile(int newDestroyedStructureTile) {
+	destroyedStructureTile = newDestroyedStructureTile;
+	currentGameMap->getTerrainCache()->invalidate(location);
 }
 
 
@@ -849,7 +927,7 @@ InfantryClass* TerrainClass::getInfantry() {
 }
 
 std::list<Uint32> TerrainClass::getInfantryList() const {
-	return assignedInfantryList;
+	return std::list<Uint32>(assignedInfantryList.begin(), assignedInfantryList.end());
 }
 
 ObjectClass* TerrainClass::getNonInfantryGroundObject() {
@@ -902,15 +980,15 @@ ObjectClass* TerrainClass::getObjectAt(int x, int y) {
 		atPos.x = x;
 		atPos.y = y;
 
-		std::list<Uint32>::const_iterator iter;
+		ObjectIDList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			infantry = (InfantryClass*) currentGame->getObjectManager().getObject(*iter);
 			if(infantry == NULL)
 				continue;
 
 			centerPoint = infantry->getCenterPoint();
-			if ((closestDistance == NONE) || (distance_from(atPos, centerPoint) < closestDistance)) {
-				closestDistance = distance_from(atPos, centerPoint);
+			if ((closestDistance == NONE) || (distance_from(atPos, centerPoint).toDouble() < closestDistance)) {
+				closestDistance = distance_from(atPos, centerPoint).toDouble();
 				temp = infantry;
 			}
 		}
@@ -923,7 +1001,7 @@ ObjectClass* TerrainClass::getObjectAt(int x, int y) {
 
 
 ObjectClass* TerrainClass::getObjectWithID(Uint32 objectID) {
-	ConcatIterator<Uint32> iterator;
+	ConcatIterator<Uint32, ObjectIDList> iterator;
 	iterator.addList(assignedInfantryList);
 	iterator.addList(assignedNonInfantryGroundObjectList);
 	iterator.addList(assignedUndergroundUnitList);
@@ -1050,16 +1128,18 @@ void TerrainClass::triggerSpecialBloom(House* pTrigger) {
     }
 }
 
-bool TerrainClass::isFogged(int houseID) {
+bool TerrainClass::isExplored(int houseID) const {
+	return currentGameMap->getFogOfWar()->isExplored(houseID, location.x, location.y);
+}
+
+bool TerrainClass::isFogged(int houseID) const {
 	if(debug)
 		return false;
 
 	if(currentGame->getGameInitSettings().hasFogOfWar() == false) {
 		return false;
-	} else if((currentGame->GetGameCycleCount() - lastAccess[houseID]) >= MILLI2CYCLES(10*1000)) {
-		return true;
 	} else {
-		return false;
+		return !currentGameMap->getFogOfWar()->isVisible(houseID, location.x, location.y);
 	}
 }
 
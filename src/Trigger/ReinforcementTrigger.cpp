@@ -184,9 +184,9 @@ void ReinforcementTrigger::trigger()
             // try 32 times
             for(int i=0;i<32;i++) {
                 int r = currentGame->RandomGen.rand(0,7);
-                double angle = 2*M_PI*currentGame->RandomGen.randDouble();
+                FixPoint angle = FixPoint::fromRaw(currentGame->RandomGen.rand(0, 256*FixPoint::ONE - 1));
 
-                dropCoord += Coord( (int) (r*sin(angle)), (int) (-r*cos(angle)));
+                dropCoord += Coord( (r*FixPoint::sin(angle)).toInt(), (-r*FixPoint::cos(angle)).toInt());
 
                 if(currentGameMap->cellExists(dropCoord) && currentGameMap->getCell(dropCoord)->hasAGroundObject() == false) {
                     // found the an empty drop location => drop here
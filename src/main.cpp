@@ -22,6 +22,7 @@
 #include <config.h>
 
 #include <FileClasses/FileManager.h>
+#include <FileClasses/AssetLoader.h>
 #include <FileClasses/GFXManager.h>
 #include <FileClasses/SFXManager.h>
 #include <FileClasses/FontManager.h>
@@ -41,6 +42,7 @@
 #include <misc/FileSystem.h>
 
 #include <SoundPlayer.h>
+#include <sand.h>
 
 #include <CutScenes/Intro.h>
 
@@ -231,6 +233,39 @@ void PrintMissingFilesToScreen() {
 	}
 }
 
+/**
+    Draws a progress bar while the graphics and sounds are loaded. This is called by the AssetLoader.
+    \param stage       what is loaded (e.g. "graphics")
+    \param numFinished the number of loaded assets
+    \param numTasks    the number of all assets
+*/
+void drawLoadingProgress(const std::string& stage, int numFinished, int numTasks) {
+    if((screen == NULL) || (numTasks <= 0)) {
+        return;
+    }
+
+    SDL_FillRect(screen, NULL, COLOR_BLACK);
+
+    SDL_Surface* pSurface = pFontManager->createSurfaceWithText("Loading " + stage + "...", COLOR_WHITE, FONT_STD12);
+    SDL_Rect textDest = { (screen->w - pSurface->w) / 2, screen->h / 2 - pSurface->h - 10, pSurface->w, pSurface->h };
+    SDL_BlitSurface(pSurface, NULL, screen, &textDest);
+    SDL_FreeSurface(pSurface);
+
+    SDL_Rect border = { screen->w / 4, screen->h / 2, screen->w / 2, 12 };
+    SDL_FillRect(screen, &border, COLOR_WHITE);
+
+    SDL_Rect background = { border.x + 1, border.y + 1, border.w - 2, border.h - 2 };
+    SDL_FillRect(screen, &background, COLOR_BLACK);
+
+    SDL_Rect bar = { background.x + 1, background.y + 1, ((background.w - 2) * numFinished) / numTasks, background.h - 2 };
+    SDL_FillRect(screen, &bar, COLOR_LIGHTGREY);
+
+    SDL_Flip(screen);
+
+    // keep the window responsive
+    SDL_PumpEvents();
+}
+
 int GetUserLanguage() {
     const char* pLang = NULL;
 
@@ -280,10 +315,43 @@ int main(int argc, char *argv[])
 	}
 
 	bool bShowDebug = false;
+	bool bBenchmarkPathfinding = false;
+	bool bBenchmarkStartup = false;
+	bool bBenchmarkMusic = false;
+	bool bBenchmarkLists = false;
+	std::string headlessFilename = "";
+	bool bHeadlessReplay = false;
+	Uint32 headlessMaxCycles = 100000;
     for(int i=1; i < argc; i++) {
 	    //check for overiding params
 		if (strcmp(argv[i], "--showlog") == 0)
 			bShowDebug = true;
+		else if (strcmp(argv[i], "--benchmark-pathfinding") == 0)
+			bBenchmarkPathfinding = true;
+		else if (strcmp(argv[i], "--benchmark-startup") == 0)
+			bBenchmarkStartup = true;
+		else if (strcmp(argv[i], "--benchmark-music") == 0)
+			bBenchmarkMusic = true;
+		else if (strcmp(argv[i], "--benchmark-lists") == 0)
+			bBenchmarkLists = true;
+		else if ((strcmp(argv[i], "--headless-replay") == 0) && (i+1 < argc)) {
+			headlessFilename = argv[++i];
+			bHeadlessReplay = true;
+		} else if ((strcmp(argv[i], "--headless-scenario") == 0) && (i+1 < argc)) {
+			headlessFilename = argv[++i];
+			bHeadlessReplay = false;
+		} else if ((strcmp(argv[i], "--headless-cycles") == 0) && (i+1 < argc))
+			headlessMaxCycles = atoi(argv[++i]);
+	}
+
+	bool bHeadless = (headlessFilename.empty() == false);
+	if(bHeadless == true) {
+	    // the results should go to the console and no window or sound device is needed
+	    bShowDebug = true;
+	    char videoDriver[] = "SDL_VIDEODRIVER=dummy";
+	    SDL_putenv(videoDriver);
+	    char audioDriver[] = "SDL_AUDIODRIVER=dummy";
+	    SDL_putenv(audioDriver);
 	}
 
 	if(bShowDebug == false) {
@@ -396,8 +464,6 @@ int main(int argc, char *argv[])
             settings.General.setLanguage(LNG_ENG);
 		}
 
-		lookDist[0] = 10;lookDist[1] = 10;lookDist[2] = 9;lookDist[3] = 9;lookDist[4] = 9;lookDist[5] = 8;lookDist[6] = 8;lookDist[7] = 7;lookDist[8] = 6;lookDist[9] = 4;lookDist[10] = 1;
-
 
 		for(int i=1; i < argc; i++) {
 		    //check for overiding params
@@ -440,6 +506,11 @@ int main(int argc, char *argv[])
 			} else {
 				fprintf(stdout, "allocated %d channels.\n", Mix_AllocateChannels(4)); fflush(stdout);
 			}
+
+			if(bHeadless == true) {
+			    // nothing is played in headless mode, so the music synthesis shall not steal any time from the simulation
+			    SDL_PauseAudio(1);
+			}
 		}
 
         pFileManager = new FileManager( (MissingFiles.size() > 0) );
@@ -479,6 +550,13 @@ int main(int argc, char *argv[])
             houseColor[HOUSE_FREMEN]    =   COLOR_FREMEN;
             houseColor[HOUSE_MERCENARY] =   COLOR_MERCENARY;
 
+            // the startup benchmark decodes everything from the data files and prints the decode time of every asset
+            AssetLoader::setBenchmark(bBenchmarkStartup);
+            if(bHeadless == false) {
+                AssetLoader::setProgressCallback(drawLoadingProgress);
+            }
+            Uint32 startupStartTime = SDL_GetTicks();
+
             fprintf(stdout, "loading graphics....."); fflush(stdout);
             if((pGFXManager = new GFXManager()) == NULL) {
                 fprintf(stderr,"main: Cannot create GFXManager!\n");
@@ -500,6 +578,11 @@ int main(int argc, char *argv[])
             }
             fprintf(stdout, "\t\tfinished\n"); fflush(stdout);
 
+            AssetLoader::setProgressCallback(NULL);
+            if(bBenchmarkStartup == true) {
+                fprintf(stdout, "Loading graphics, sounds and texts took %u ms\n", SDL_GetTicks() - startupStartTime); fflush(stdout);
+            }
+
             GUIStyle::SetGUIStyle(new DuneStyle);
 
             if(FirstInit == true) {
@@ -526,7 +609,7 @@ int main(int argc, char *argv[])
             }
 
             // Playing intro
-            if(((FirstGamestart == true) || (settings.General.PlayIntro == true)) && (FirstInit==true)) {
+            if(((FirstGamestart == true) || (settings.General.PlayIntro == true)) && (FirstInit==true) && (bHeadless == false) && (bBenchmarkStartup == false)) {
                 fprintf(stdout, "playing intro.....");fflush(stdout);
                 Intro* pIntro = new Intro();
 
@@ -538,16 +621,32 @@ int main(int argc, char *argv[])
 
             FirstInit = false;
 
-            fprintf(stdout, "starting main menu.......");fflush(stdout);
+            if(bBenchmarkStartup == true) {
+                ExitGame = true;
+            } else if(bBenchmarkPathfinding == true) {
+                runPathfindingBenchmark();
+                ExitGame = true;
+            } else if(bBenchmarkMusic == true) {
+                runMusicBenchmark();
+                ExitGame = true;
+            } else if(bBenchmarkLists == true) {
+                runListBenchmark();
+                ExitGame = true;
+            } else if(bHeadless == true) {
+                runHeadlessSimulation(headlessFilename, bHeadlessReplay, headlessMaxCycles);
+                ExitGame = true;
+            } else {
+                fprintf(stdout, "starting main menu.......");fflush(stdout);
 
-            MainMenu * myMenu = new MainMenu();
+                MainMenu * myMenu = new MainMenu();
 
-            fprintf(stdout, "\tfinished\n"); fflush(stdout);
+                fprintf(stdout, "\tfinished\n"); fflush(stdout);
 
-            if(myMenu->showMenu() == -1) {
-                ExitGame = true;
+                if(myMenu->showMenu() == -1) {
+                    ExitGame = true;
+                }
+                delete myMenu;
             }
-            delete myMenu;
 
             fprintf(stdout, "Deinitialize....."); fflush(stdout);
 
@@ -16,48 +16,92 @@
  */
 
 #include <misc/FileStream.h>
+#include <misc/lz_util.h>
 
 #include <string.h>
 #include <SDL_endian.h>
+#include <algorithm>
 
 FileStream::FileStream()
 {
 	fp = NULL;
+	bWriting = false;
+	bCompressed = false;
+	bufferPos = 0;
+	bufferLength = 0;
 }
 
 FileStream::~FileStream()
 {
-	close();
+	if(fp != NULL) {
+		// errors cannot be reported from here; call close() to get them
+		if(bWriting == true) {
+			writeBuffer();
+		}
+		fclose(fp);
+	}
 }
 
-bool FileStream::open(const char* filename, const char* mode)
+bool FileStream::open(const char* filename, const char* mode, bool bCompressed)
 {
 	if(fp != NULL) {
-		fclose(fp);
+		close();
 	}
 
 	if( (fp = fopen(filename,mode)) == NULL) {
 		return false;
+	}
+
+	bWriting = (mode[0] == 'w') || (mode[0] == 'a');
+	buffer.resize(BUFFER_SIZE);
+	bufferPos = 0;
+	bufferLength = 0;
+
+	if(bWriting == true) {
+		this->bCompressed = bCompressed;
+		if(bCompressed == true) {
+			Uint32 magic = SDL_SwapLE32(COMPRESSED_MAGIC);
+			if(fwrite(&magic,sizeof(Uint32),1,fp) != 1) {
+				fclose(fp);
+				fp = NULL;
+				return false;
+			}
+		}
 	} else {
-		return true;
+		// compressed files are recognized by their magic number; other files are read from the beginning
+		Uint32 magic = 0;
+		this->bCompressed = (fread(&magic,sizeof(Uint32),1,fp) == 1) && (SDL_SwapLE32(magic) == COMPRESSED_MAGIC);
+		if(this->bCompressed == false) {
+			rewind(fp);
+		}
 	}
+
+	return true;
 }
 
-bool FileStream::open(std::string filename, const char* mode)
+bool FileStream::open(std::string filename, const char* mode, bool bCompressed)
 {
-	return open(filename.c_str(), mode);
+	return open(filename.c_str(), mode, bCompressed);
 }
 
 void FileStream::close()
 {
 	if(fp != NULL) {
+		bool bSuccess = (bWriting == false) || writeBuffer();
 		fclose(fp);
 		fp = NULL;
+
+		if(bSuccess == false) {
+			throw Stream::error("FileStream::close(): An I/O-Error occurred!");
+		}
 	}
 }
 
 void FileStream::flush() {
-    if(fp != NULL) {
+    if((fp != NULL) && (bWriting == true)) {
+        if(writeBuffer() == false) {
+            throw Stream::error("FileStream::flush(): An I/O-Error occurred!");
+        }
         fflush(fp);
     }
 }
@@ -67,43 +111,35 @@ void FileStream::writeString(const std::string& str)
 	writeUint32(str.length());
 
     if(!str.empty()) {
-        if(fwrite(str.c_str(),str.length(),1,fp) != 1) {
-            throw Stream::error("FileStream::writeString(): An I/O-Error occurred!");
-        }
+        writeBytes(str.c_str(), str.length());
     }
 }
 
 void FileStream::writeUint8(Uint8 x)
 {
-	if(fwrite(&x,sizeof(Uint8),1,fp) != 1) {
-		throw Stream::error("FileStream::writeUint8(): An I/O-Error occurred!");
+	if(bufferPos < buffer.size()) {
+		buffer[bufferPos++] = x;
+	} else {
+		writeBytes(&x, sizeof(Uint8));
 	}
 }
 
 void FileStream::writeUint16(Uint16 x)
 {
 	x = SDL_SwapLE16(x);
-
-	if(fwrite(&x,sizeof(Uint16),1,fp) != 1) {
-		throw Stream::error("FileStream::writeUint16(): An I/O-Error occurred!");
-	}
+	writeBytes(&x, sizeof(Uint16));
 }
 
 void FileStream::writeUint32(Uint32 x)
 {
 	x = SDL_SwapLE32(x);
-
-	if(fwrite(&x,sizeof(Uint32),1,fp) != 1) {
-		throw Stream::error("FileStream::writeUint32(): An I/O-Error occurred!");
-	}
+	writeBytes(&x, sizeof(Uint32));
 }
 
 void FileStream::writeUint64(Uint64 x)
 {
 	x = SDL_SwapLE64(x);
-	if(fwrite(&x,sizeof(Uint64),1,fp) != 1) {
-		throw Stream::error("FileStream::writeUint64(): An I/O-Error occurred!");
-	}
+	writeBytes(&x, sizeof(Uint64));
 }
 
 void FileStream::writeBool(bool x)
@@ -121,6 +157,25 @@ void FileStream::writeDouble(double x)
 	writeUint64(tmp);
 }
 
+void FileStream::writeBytes(const void* pData, size_t length)
+{
+	const Uint8* pBytes = (const Uint8*) pData;
+
+	while(length > 0) {
+		if(bufferPos == buffer.size()) {
+			if(writeBuffer() == false) {
+				throw Stream::error("FileStream::writeBytes(): An I/O-Error occurred!");
+			}
+		}
+
+		size_t numBytes = std::min(length, buffer.size() - bufferPos);
+		memcpy(&buffer[bufferPos], pBytes, numBytes);
+		bufferPos += numBytes;
+		pBytes += numBytes;
+		length -= numBytes;
+	}
+}
+
 std::string FileStream::readString()
 {
 	Uint32 length;
@@ -134,13 +189,7 @@ std::string FileStream::readString()
 
         str.resize(length);
 
-        if(fread(&str[0],length,1,fp) != 1) {
-            if(feof(fp) != 0) {
-                throw Stream::eof("FileStream::readString(): End-of-File reached!");
-            } else {
-                throw Stream::error("FileStream::readString(): An I/O-Error occurred!");
-            }
-        }
+        readBytes(&str[0], length);
 
         return str;
     }
@@ -148,56 +197,33 @@ std::string FileStream::readString()
 
 Uint8 FileStream::readUint8()
 {
-	Uint8 tmp;
-	if(fread(&tmp,sizeof(Uint8),1,fp) != 1) {
-		if(feof(fp) != 0) {
-			throw Stream::eof("FileStream::readUint8(): End-of-File reached!");
-		} else {
-			throw Stream::error("FileStream::readUint8(): An I/O-Error occurred!");
-		}
+	if(bufferPos < bufferLength) {
+		return buffer[bufferPos++];
 	}
 
+	Uint8 tmp;
+	readBytes(&tmp, sizeof(Uint8));
 	return tmp;
 }
 
 Uint16 FileStream::readUint16()
 {
 	Uint16 tmp;
-	if(fread(&tmp,sizeof(Uint16),1,fp) != 1) {
-		if(feof(fp) != 0) {
-			throw Stream::eof("FileStream::readUint16(): End-of-File reached!");
-		} else {
-			throw Stream::error("FileStream::readUint16(): An I/O-Error occurred!");
-		}
-	}
-
+	readBytes(&tmp, sizeof(Uint16));
 	return SDL_SwapLE16(tmp);
 }
 
 Uint32 FileStream::readUint32()
 {
 	Uint32 tmp;
-	if(fread(&tmp,sizeof(Uint32),1,fp) != 1) {
-		if(feof(fp) != 0) {
-			throw Stream::eof("FileStream::readUint32(): End-of-File reached!");
-		} else {
-			throw Stream::error("FileStream::readUint32(): An I/O-Error occurred!");
-		}
-	}
-
+	readBytes(&tmp, sizeof(Uint32));
 	return SDL_SwapLE32(tmp);
 }
 
 Uint64 FileStream::readUint64()
 {
 	Uint64 tmp;
-	if(fread(&tmp,sizeof(Uint64),1,fp) != 1) {
-		if(feof(fp) != 0) {
-			throw Stream::eof("FileStream::readUint64(): End-of-File reached!");
-		} else {
-			throw Stream::error("FileStream::readUint64(): An I/O-Error occurred!");
-		}
-	}
+	readBytes(&tmp, sizeof(Uint64));
 	return SDL_SwapLE64(tmp);
 }
 
@@ -217,3 +243,111 @@ double FileStream::readDouble()
 	memcpy(&tmp2,&tmp,sizeof(Uint64)); // workaround for a strange optimization in gcc 4.1
 	return tmp2;
 }
+
+void FileStream::readBytes(void* pData, size_t length)
+{
+	Uint8* pBytes = (Uint8*) pData;
+
+	while(length > 0) {
+		if(bufferPos == bufferLength) {
+			readBuffer();
+		}
+
+		size_t numBytes = std::min(length, bufferLength - bufferPos);
+		memcpy(pBytes, &buffer[bufferPos], numBytes);
+		bufferPos += numBytes;
+		pBytes += numBytes;
+		length -= numBytes;
+	}
+}
+
+bool FileStream::writeBuffer()
+{
+	if((fp == NULL) || (bWriting == false)) {
+		return false;
+	}
+
+	if(bufferPos == 0) {
+		return true;
+	}
+
+	size_t length = bufferPos;
+	bufferPos = 0;
+
+	if(bCompressed == false) {
+		return (fwrite(&buffer[0],length,1,fp) == 1);
+	}
+
+	compressedBuffer.clear();
+	lzCompress(&buffer[0], length, compressedBuffer);
+
+	// a frame that does not get smaller is stored uncompressed and marked by a compressed length of 0
+	bool bStored = (compressedBuffer.size() >= length);
+	Uint32 header[2];
+	header[0] = SDL_SwapLE32((Uint32) length);
+	header[1] = SDL_SwapLE32((Uint32) (bStored ? 0 : compressedBuffer.size()));
+	if(fwrite(header,sizeof(header),1,fp) != 1) {
+		return false;
+	}
+
+	if(bStored == true) {
+		return (fwrite(&buffer[0],length,1,fp) == 1);
+	} else {
+		return (fwrite(&compressedBuffer[0],compressedBuffer.size(),1,fp) == 1);
+	}
+}
+
+void FileStream::readBuffer()
+{
+	bufferPos = 0;
+	bufferLength = 0;
+
+	if((fp == NULL) || (bWriting == true)) {
+		throw Stream::error("FileStream::readBuffer(): The file is not opened for reading!");
+	}
+
+	if(bCompressed == false) {
+		bufferLength = fread(&buffer[0],1,buffer.size(),fp);
+		if(bufferLength == 0) {
+			if(feof(fp) != 0) {
+				throw Stream::eof("FileStream::readBuffer(): End-of-File reached!");
+			} else {
+				throw Stream::error("FileStream::readBuffer(): An I/O-Error occurred!");
+			}
+		}
+		return;
+	}
+
+	Uint32 header[2];
+	if(fread(header,sizeof(header),1,fp) != 1) {
+		if(feof(fp) != 0) {
+			throw Stream::eof("FileStream::readBuffer(): End-of-File reached!");
+		} else {
+			throw Stream::error("FileStream::readBuffer(): An I/O-Error occurred!");
+		}
+	}
+
+	Uint32 length = SDL_SwapLE32(header[0]);
+	Uint32 compressedLength = SDL_SwapLE32(header[1]);
+	if((length == 0) || (length > (Uint32) BUFFER_SIZE) || (compressedLength > length)) {
+		throw Stream::error("FileStream::readBuffer(): Invalid compressed frame!");
+	}
+
+	if(compressedLength == 0) {
+		// stored uncompressed
+		if(fread(&buffer[0],length,1,fp) != 1) {
+			throw Stream::error("FileStream::readBuffer(): Truncated compressed frame!");
+		}
+	} else {
+		compressedBuffer.resize(compressedLength);
+		if(fread(&compressedBuffer[0],compressedLength,1,fp) != 1) {
+			throw Stream::error("FileStream::readBuffer(): Truncated compressed frame!");
+		}
+
+		if(lzDecompress(&compressedBuffer[0], compressedLength, &buffer[0], length) == false) {
+			throw Stream::error("FileStream::readBuffer(): Corrupt compressed frame!");
+		}
+	}
+
+	bufferLength = length;
+}
@@ -208,6 +208,57 @@ std::list<FileInfo> GetFileList(std::string directory, std::string extension, bo
 
 }
 
+std::list<std::string> GetDirectoryEntries(std::string directory)
+{
+    std::list<std::string> Entries;
+
+#ifdef _WIN32
+
+	long hFile;
+
+	_finddata_t fdata;
+
+	std::string searchString = directory + "/*";
+
+	if ((hFile = (long)_findfirst(searchString.c_str(), &fdata)) != -1L) {
+		do {
+			std::string Filename = fdata.name;
+			if((Filename != ".") && (Filename != "..")) {
+				Entries.push_back(Filename);
+			}
+		} while(_findnext(hFile, &fdata) == 0);
+
+		_findclose(hFile);
+	}
+
+#else
+
+	DIR * dir = opendir(directory.c_str());
+	dirent *curEntry;
+
+	if(dir == NULL) {
+		return Entries;
+	}
+
+	errno = 0;
+	while((curEntry = readdir(dir)) != NULL) {
+		std::string Filename = curEntry->d_name;
+		if((Filename != ".") && (Filename != "..")) {
+			Entries.push_back(Filename);
+		}
+	}
+
+	if(errno != 0) {
+		perror("readdir()");
+	}
+
+	closedir(dir);
+
+#endif
+
+	return Entries;
+}
+
 bool GetCaseInsensitiveFilename(std::string& filepath) {
 
 #ifdef _WIN32
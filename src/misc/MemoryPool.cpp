@@ -0,0 +1,106 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/MemoryPool.h>
+
+#include <algorithm>
+#include <new>
+
+MemoryPool::MemoryPool()
+ : freeLists(MAX_BLOCK_SIZE/GRANULARITY, (FreeBlock*) NULL), pChunkPos(NULL), chunkBytesLeft(0),
+   numAllocations(0), numHeapAllocations(0), numBlocksInUse(0) {
+}
+
+MemoryPool::~MemoryPool() {
+	// objects that still live at program exit keep their memory
+	if(numBlocksInUse == 0) {
+		reset();
+	}
+}
+
+void* MemoryPool::allocate(size_t size) {
+	numAllocations++;
+	numBlocksInUse++;
+
+	if(size > MAX_BLOCK_SIZE) {
+		numHeapAllocations++;
+		return ::operator new(size);
+	}
+
+	size_t sizeClass = (size == 0) ? 0 : (size - 1)/GRANULARITY;
+	FreeBlock* pBlock = freeLists[sizeClass];
+	if(pBlock != NULL) {
+		freeLists[sizeClass] = pBlock->pNext;
+		return pBlock;
+	}
+
+	size_t blockSize = (sizeClass + 1) * GRANULARITY;
+	if(chunkBytesLeft < blockSize) {
+		// put the rest of the current chunk into the free lists
+		while(chunkBytesLeft >= GRANULARITY) {
+			size_t restClass = ((chunkBytesLeft > MAX_BLOCK_SIZE) ? MAX_BLOCK_SIZE : chunkBytesLeft)/GRANULARITY - 1;
+			FreeBlock* pRest = (FreeBlock*) pChunkPos;
+			pRest->pNext = freeLists[restClass];
+			freeLists[restClass] = pRest;
+			pChunkPos += (restClass + 1) * GRANULARITY;
+			chunkBytesLeft -= (restClass + 1) * GRANULARITY;
+		}
+
+		numHeapAllocations++;
+		pChunkPos = (char*) ::operator new(CHUNK_SIZE);
+		chunks.push_back(pChunkPos);
+		chunkBytesLeft = CHUNK_SIZE;
+	}
+
+	void* p = pChunkPos;
+	pChunkPos += blockSize;
+	chunkBytesLeft -= blockSize;
+	return p;
+}
+
+void MemoryPool::deallocate(void* p, size_t size) {
+	if(p == NULL) {
+		return;
+	}
+
+	numBlocksInUse--;
+
+	if(size > MAX_BLOCK_SIZE) {
+		::operator delete(p);
+		return;
+	}
+
+	size_t sizeClass = (size == 0) ? 0 : (size - 1)/GRANULARITY;
+	FreeBlock* pBlock = (FreeBlock*) p;
+	pBlock->pNext = freeLists[sizeClass];
+	freeLists[sizeClass] = pBlock;
+}
+
+void MemoryPool::reset() {
+	if(numBlocksInUse != 0) {
+		return;
+	}
+
+	for(std::vector<char*>::iterator iter = chunks.begin(); iter != chunks.end(); ++iter) {
+		::operator delete(*iter);
+	}
+	chunks.clear();
+
+	std::fill(freeLists.begin(), freeLists.end(), (FreeBlock*) NULL);
+	pChunkPos = NULL;
+	chunkBytesLeft = 0;
+}
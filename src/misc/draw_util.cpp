@@ -265,8 +265,8 @@ SDL_Surface* DoublePicture(SDL_Surface* inputPic, bool bFreeInputPic) {
 
 	SDL_Surface *returnPic;
 
-	// create new picture surface
-	if((returnPic = SDL_CreateRGBSurface(SDL_HWSURFACE,inputPic->w * 2,inputPic->h * 2,8,0,0,0,0))== NULL) {
+	// create new picture surface (a software surface, as this is also called on the threads of the AssetLoader)
+	if((returnPic = SDL_CreateRGBSurface(SDL_SWSURFACE,inputPic->w * 2,inputPic->h * 2,8,0,0,0,0))== NULL) {
 	    if(bFreeInputPic) SDL_FreeSurface(inputPic);
 		throw std::runtime_error("DoublePicture(): Cannot create new Picture!");
 	}
@@ -0,0 +1,168 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <misc/lz_util.h>
+
+#include <string.h>
+#include <algorithm>
+
+/*
+	Every sequence starts with a token byte. Its high nibble is the number of literals, its low nibble the match length
+	minus MIN_MATCH. A nibble of 15 is followed by extension bytes that are added to it until one is not 255.
+	After the token follow the extended literal count, the literals, the 16-bit little endian offset of the match and the
+	extended match length. The last sequence only consists of literals and ends the data.
+*/
+
+#define MIN_MATCH		4
+#define MAX_OFFSET		65535
+#define HASH_BITS		12
+
+static inline Uint32 read32(const Uint8* p) {
+	Uint32 x;
+	memcpy(&x, p, sizeof(Uint32));
+	return x;
+}
+
+static inline Uint32 hash(Uint32 sequence) {
+	return (sequence * 2654435761U) >> (32 - HASH_BITS);
+}
+
+static void appendLength(std::vector<Uint8>& dest, size_t length) {
+	length -= 15;
+	while(length >= 255) {
+		dest.push_back(255);
+		length -= 255;
+	}
+	dest.push_back((Uint8) length);
+}
+
+static void appendSequence(std::vector<Uint8>& dest, const Uint8* pLiterals, size_t numLiterals, size_t offset, size_t matchLength) {
+	size_t matchCode = (matchLength >= MIN_MATCH) ? matchLength - MIN_MATCH : 0;
+
+	Uint8 token = (Uint8) ((std::min(numLiterals, (size_t) 15) << 4) | std::min(matchCode, (size_t) 15));
+	dest.push_back(token);
+
+	if(numLiterals >= 15) {
+		appendLength(dest, numLiterals);
+	}
+	dest.insert(dest.end(), pLiterals, pLiterals + numLiterals);
+
+	if(matchLength >= MIN_MATCH) {
+		dest.push_back((Uint8) (offset & 0xFF));
+		dest.push_back((Uint8) (offset >> 8));
+
+		if(matchCode >= 15) {
+			appendLength(dest, matchCode);
+		}
+	}
+}
+
+static bool readLength(const Uint8* pSrc, size_t srcLength, size_t& srcPos, size_t& length) {
+	Uint8 x;
+	do {
+		if(srcPos >= srcLength) {
+			return false;
+		}
+		x = pSrc[srcPos++];
+		length += x;
+	} while(x == 255);
+
+	return true;
+}
+
+void lzCompress(const Uint8* pSrc, size_t srcLength, std::vector<Uint8>& dest) {
+	long hashTable[1 << HASH_BITS];
+	for(int i = 0; i < (1 << HASH_BITS); i++) {
+		hashTable[i] = -1;
+	}
+
+	size_t anchor = 0;
+	size_t pos = 0;
+	while(pos + MIN_MATCH <= srcLength) {
+		Uint32 sequence = read32(pSrc + pos);
+		Uint32 h = hash(sequence);
+		long ref = hashTable[h];
+		hashTable[h] = pos;
+
+		if((ref < 0) || (pos - ref > MAX_OFFSET) || (read32(pSrc + ref) != sequence)) {
+			pos++;
+			continue;
+		}
+
+		size_t matchLength = MIN_MATCH;
+		while((pos + matchLength < srcLength) && (pSrc[ref + matchLength] == pSrc[pos + matchLength])) {
+			matchLength++;
+		}
+
+		appendSequence(dest, pSrc + anchor, pos - anchor, pos - ref, matchLength);
+		pos += matchLength;
+		anchor = pos;
+	}
+
+	appendSequence(dest, pSrc + anchor, srcLength - anchor, 0, 0);
+}
+
+bool lzDecompress(const Uint8* pSrc, size_t srcLength, Uint8* pDest, size_t destLength) {
+	size_t srcPos = 0;
+	size_t destPos = 0;
+
+	while(srcPos < srcLength) {
+		Uint8 token = pSrc[srcPos++];
+
+		size_t numLiterals = token >> 4;
+		if((numLiterals == 15) && (readLength(pSrc, srcLength, srcPos, numLiterals) == false)) {
+			return false;
+		}
+
+		if((numLiterals > srcLength - srcPos) || (numLiterals > destLength - destPos)) {
+			return false;
+		}
+		memcpy(pDest + destPos, pSrc + srcPos, numLiterals);
+		srcPos += numLiterals;
+		destPos += numLiterals;
+
+		if(srcPos == srcLength) {
+			// the last sequence has no match
+			break;
+		}
+
+		if(srcPos + 2 > srcLength) {
+			return false;
+		}
+		size_t offset = pSrc[srcPos] | (pSrc[srcPos+1] << 8);
+		srcPos += 2;
+
+		size_t matchLength = token & 0x0F;
+		if((matchLength == 15) && (readLength(pSrc, srcLength, srcPos, matchLength) == false)) {
+			return false;
+		}
+		matchLength += MIN_MATCH;
+
+		if((offset == 0) || (offset > destPos) || (matchLength > destLength - destPos)) {
+			return false;
+		}
+
+		// the match may overlap with the bytes it produces
+		const Uint8* pMatch = pDest + destPos - offset;
+		for(size_t i = 0; i < matchLength; i++) {
+			pDest[destPos + i] = pMatch[i];
+		}
+		destPos += matchLength;
+	}
+
+	return (destPos == destLength);
+}
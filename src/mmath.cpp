@@ -24,15 +24,6 @@
 #include <algorithm>
 
 
-double fixDouble(double number)
-{
-	if (fabs(number - (double)((int)number)) < 0.00001)
-		number = (double)((int)number);
-
-	return number;
-}
-
-
 int getRandomInt(int min, int max)
 {
 	max++;
@@ -59,67 +50,33 @@ int getRandomOf(int numParam, ...) {
 
 
 
-double dest_angle(const Coord& p1, const Coord& p2)
+FixPoint dest_angle(const Coord& p1, const Coord& p2)
 {
-        double  destAngle = 0.0;
-
-        double  diffX = p2.x - p1.x,
-                diffY = p2.y - p1.y;
-
-        if (diffX != 0)
-        {
-                if ((diffX >= 0) && (diffY >= 0))  //if x2 >= x1 && y2 >= y1
-                {
-                        destAngle = 2*M_PI - atan(fabs(diffY/diffX));
-                }
-                else if ((diffX < 0) && (diffY >= 0))  //if x2 < x1 && y2 >= y1
-                {
-                        destAngle = atan(fabs(diffY/diffX)) + M_PI;
-                }
-                else if ((diffX < 0) && (diffY < 0))  //if x2 < x1 && y2 < y1
-                {
-                        destAngle = M_PI - atan(fabs(diffY/diffX));
-                }
-                else if ((diffX >= 0) && (diffY < 0))  //if x2 >= x1 && y2 < y1
-                {
-                        destAngle = atan(fabs(diffY/diffX));
-                }
-        }
-        else if (diffY <= 0)
-        {
-                destAngle = M_PI/2;
-        }
-        else destAngle = 3*M_PI/2;
-
-        if (destAngle == 2*M_PI) destAngle = 0;
-
-        return (destAngle*256.0/(2*M_PI));
+	if(p1 == p2) {
+		return FixPoint(64);
+	}
+
+	// the y-axis of the map points downwards
+	return FixPoint::atan2(p1.y - p2.y, p2.x - p1.x);
 }
 
 
-double distance_from(const Coord& p1, const Coord& p2)
+FixPoint distance_from(const Coord& p1, const Coord& p2)
 {
-	double	first = (p1.x - p2.x),
-			second = (p1.y - p2.y);
-
-	return(sqrt(first*first + second*second));
+	return FixPoint::hypot(p1.x - p2.x, p1.y - p2.y);
 }
 
-double distance_from(double x, double y, double to_x, double to_y)
+FixPoint distance_from(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y)
 {
-	double	first = (x - to_x),
-			second = (y - to_y);
-
-	return(sqrt(first*first + second*second));
+	return FixPoint::hypot(x - to_x, y - to_y);
 }
 
-double blockDistance(const Coord& p1, const Coord& p2)
+FixPoint blockDistance(const Coord& p1, const Coord& p2)
 {
 	int xDis = abs(p1.x - p2.x),
 		yDis = abs(p1.y - p2.y),
 
 		minDis = std::min(xDis, yDis);
 
-	return ((double)std::max(xDis, yDis) + (double)minDis*(DIAGONALCOST - 1.0));
-	//return (((double)minDis)*DIAGONALCOST + max(xDis, yDis) - minDis);
+	return (FixPoint(std::max(xDis, yDis)) + minDis*(FIX_DIAGONALCOST - 1));
 }
@@ -33,6 +33,48 @@
 #include <structures/StarPortClass.h>
 #include <units/UnitClass.h>
 
+#include <vector>
+
+namespace {
+	/// One step of the order in which the construction yard builds structures
+	struct BuildOrderStep {
+		int itemID;         ///< the structure to build
+		int limit;          ///< build it while the house has less than this number of them (wind traps: while it produces less power than this)
+		int minTechLevel;   ///< the tech level needed to build it
+	};
+
+	/// The first step whose structure is needed and can be built is chosen
+	const BuildOrderStep buildOrder[] = {
+		{ Structure_WindTrap,           50,     0 },
+		{ Structure_Refinery,           2,      0 },
+		{ Structure_WindTrap,           150,    0 },
+		{ Structure_Radar,              1,      2 },
+		{ Structure_WOR,                1,      2 },
+		{ Structure_RocketTurret,       2,      6 },
+		{ Structure_WindTrap,           250,    0 },
+		{ Structure_LightFactory,       1,      3 },
+		{ Structure_Refinery,           3,      0 },
+		{ Structure_RocketTurret,       4,      6 },
+		{ Structure_HeavyFactory,       1,      4 },
+		{ Structure_WindTrap,           350,    0 },
+		{ Structure_HighTechFactory,    1,      5 },
+		{ Structure_RocketTurret,       6,      6 },
+		{ Structure_RepairYard,         1,      5 },
+		{ Structure_WindTrap,           450,    0 },
+		{ Structure_StarPort,           1,      6 },
+		{ Structure_IX,                 1,      7 },
+		{ Structure_Palace,             1,      8 },
+		{ Structure_RocketTurret,       10,     6 },
+		{ Structure_WindTrap,           550,    0 },
+		{ Structure_WOR,                2,      2 },
+		{ Structure_LightFactory,       2,      3 },
+		{ Structure_HeavyFactory,       2,      4 },
+		{ Structure_Palace,             2,      8 },
+		{ Structure_WindTrap,           650,    0 },
+		{ Structure_RocketTurret,       20,     6 }
+	};
+}
+
 
 
 AIPlayer::AIPlayer(House* associatedHouse, DIFFICULTYTYPE difficulty) : Player(associatedHouse) {
@@ -83,210 +125,150 @@ void AIPlayer::save(Stream& stream) const {
 
 
 void AIPlayer::update() {
-	bool bConstructionYardChecked = false;
 	if(buildTimer == 0) {
 
-		RobustList<StructureClass*>::const_iterator iter;
-		for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
+		std::list<StructureClass*>::const_iterator iter;
+		for(iter = structures.begin(); iter != structures.end(); ++iter) {
             StructureClass* tempStructure = *iter;
 
-            //if this players structure, and its a heavy factory, build something
-            if(tempStructure->getOwner() == getHouse()) {
+            if((tempStructure->IsRepairing() == false) && (tempStructure->getHealth() < tempStructure->getMaxHealth())) {
+                tempStructure->DoRepair();
+            }
+		}
 
-                if((tempStructure->IsRepairing() == false) && (tempStructure->getHealth() < tempStructure->getMaxHealth())) {
-                    tempStructure->DoRepair();
-                }
+		bool bConstructionYardChecked = false;
+		for(iter = builders.begin(); iter != builders.end(); ++iter) {
+            BuilderClass* builder = (BuilderClass*) *iter;
+
+            if((builder->getHealth() >= builder->getMaxHealth()) && (builder->IsUpgrading() == false) && (builder->CurrentUpgradeLevel() < builder->MaxUpgradeLevel())) {
+                builder->DoUpgrade();
+            }
 
-                BuilderClass* builder = dynamic_cast<BuilderClass*>(tempStructure);
-                if(builder != NULL) {
+            switch (builder->getItemID()) {
 
-                    if((builder->getHealth() >= builder->getMaxHealth()) && (builder->IsUpgrading() == false) && (builder->CurrentUpgradeLevel() < builder->MaxUpgradeLevel())) {
-                        builder->DoUpgrade();
+                case Structure_Barracks:
+                case Structure_LightFactory:
+                case Structure_WOR: {
+                    if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
+                        builder->buildRandom();
                     }
+                } break;
 
-                    switch (tempStructure->getItemID()) {
+                case Structure_ConstructionYard: {
+                    if(bConstructionYardChecked == false) {
+                        bConstructionYardChecked = true;
+                        if(getHouse()->getCredits() > 100) {
+                            if((builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
+                                Uint32 itemID = chooseStructureToBuild(builder);
+
+                                if(itemID != NONE) {
+                                    Coord	placeLocation, location;
+                                    location = findPlaceLocation(itemID);
+
+                                    if(location.x >= 0) {
+                                        placeLocation = location;
+                                        if(currentGame->getGameInitSettings().isConcreteRequired()) {
+                                            int i, j,
+                                                incI, incJ,
+                                                startI, startJ;
+
+                                            if(currentGameMap->isWithinBuildRange(location.x, location.y, getHouse())) {
+                                                startI = location.x, startJ = location.y, incI = 1, incJ = 1;
+                                            } else if(currentGameMap->isWithinBuildRange(location.x + getStructureSize(itemID).x - 1, location.y, getHouse())) {
+                                                startI = location.x + getStructureSize(itemID).x - 1, startJ = location.y, incI = -1, incJ = 1;
+                                            } else if(currentGameMap->isWithinBuildRange(location.x, location.y + getStructureSize(itemID).y - 1, getHouse())) {
+                                                startI = location.x, startJ = location.y + getStructureSize(itemID).y - 1, incI = 1, incJ = -1;
+                                            } else {
+                                                startI = location.x + getStructureSize(itemID).x - 1, startJ = location.y + getStructureSize(itemID).y - 1, incI = -1, incJ = -1;
+                                            }
 
-                        case Structure_Barracks:
-                        case Structure_LightFactory:
-                        case Structure_WOR: {
-                            if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
-                                builder->buildRandom();
-                            }
-                        } break;
-
-                        case Structure_ConstructionYard: {
-                            if(bConstructionYardChecked == false) {
-                                bConstructionYardChecked = true;
-                                if(getHouse()->getCredits() > 100) {
-                                    if((builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
-                                        Uint32 itemID = NONE;
-                                        if(getHouse()->getProducedPower() < 50 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if(getHouse()->getNumItems(Structure_Refinery) < 2 && builder->isAvailableToBuild(Structure_Refinery)) {
-                                            itemID = Structure_Refinery;
-                                        } else if(getHouse()->getProducedPower() < 150 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->hasRadar() == false) && (currentGame->techLevel >= 2) && builder->isAvailableToBuild(Structure_Radar)) {
-                                            itemID = Structure_Radar;
-                                        } else if((getHouse()->getNumItems(Structure_WOR) <= 0) && (currentGame->techLevel >= 2) && builder->isAvailableToBuild(Structure_WOR)) {
-                                            itemID = Structure_WOR;
-                                        } else if((getHouse()->getNumItems(Structure_RocketTurret) < 2) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_RocketTurret)) {
-                                            itemID = Structure_RocketTurret;
-                                        } else if(getHouse()->getProducedPower() < 250 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->hasLightFactory() == false) && (currentGame->techLevel >= 3) && builder->isAvailableToBuild(Structure_LightFactory)) {
-                                            itemID = Structure_LightFactory;
-                                        } else if(getHouse()->getNumItems(Structure_Refinery) < 3 && builder->isAvailableToBuild(Structure_Refinery)) {
-                                            itemID = Structure_Refinery;
-                                        } else if((getHouse()->getNumItems(Structure_RocketTurret) < 4) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_RocketTurret)) {
-                                            itemID = Structure_RocketTurret;
-                                        } else if((getHouse()->getNumItems(Structure_HeavyFactory) <= 0) && (currentGame->techLevel >= 4) && builder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                            itemID = Structure_HeavyFactory;
-                                        } else if(getHouse()->getProducedPower() < 350 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->getNumItems(Structure_HighTechFactory) <= 0) && (currentGame->techLevel >= 5) && builder->isAvailableToBuild(Structure_HighTechFactory)) {
-                                            itemID = Structure_HighTechFactory;
-                                        } else if((getHouse()->getNumItems(Structure_RocketTurret) < 6) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_RocketTurret)) {
-                                            itemID = Structure_RocketTurret;
-                                        } else if((getHouse()->getNumItems(Structure_RepairYard) <= 0) && (currentGame->techLevel >= 5) && builder->isAvailableToBuild(Structure_RepairYard)) {
-                                            itemID = Structure_RepairYard;
-                                        } else if(getHouse()->getProducedPower() < 450 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->getNumItems(Structure_StarPort) <= 0) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_StarPort)) {
-                                            itemID = Structure_StarPort;
-                                        } else if((getHouse()->getNumItems(Structure_IX) <= 0) && (currentGame->techLevel >= 7) && builder->isAvailableToBuild(Structure_IX)) {
-                                            itemID = Structure_IX;
-                                        } else if((getHouse()->getNumItems(Structure_Palace) <= 0) && (currentGame->techLevel >= 8) && builder->isAvailableToBuild(Structure_Palace)) {
-                                            itemID = Structure_Palace;
-                                        } else if((getHouse()->getNumItems(Structure_RocketTurret) < 10) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_RocketTurret)) {
-                                            itemID = Structure_RocketTurret;
-                                        } else if(getHouse()->getProducedPower() < 550 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->getNumItems(Structure_WOR) < 2) && (currentGame->techLevel >= 2) && builder->isAvailableToBuild(Structure_WOR)) {
-                                            itemID = Structure_WOR;
-                                        } else if((getHouse()->getNumItems(Structure_LightFactory) < 2) && (currentGame->techLevel >= 3) && builder->isAvailableToBuild(Structure_LightFactory)) {
-                                            itemID = Structure_LightFactory;
-                                        } else if((getHouse()->getNumItems(Structure_HeavyFactory) < 2) && (currentGame->techLevel >= 4) && builder->isAvailableToBuild(Structure_HeavyFactory)) {
-                                            itemID = Structure_HeavyFactory;
-                                        } else if((getHouse()->getNumItems(Structure_Palace) < 2) && (currentGame->techLevel >= 8) && builder->isAvailableToBuild(Structure_Palace)) {
-                                            itemID = Structure_Palace;
-                                        } else if(getHouse()->getProducedPower() < 650 && builder->isAvailableToBuild(Structure_WindTrap)) {
-                                            itemID = Structure_WindTrap;
-                                        } else if((getHouse()->getNumItems(Structure_RocketTurret) < 20) && (currentGame->techLevel >= 6) && builder->isAvailableToBuild(Structure_RocketTurret)) {
-                                            itemID = Structure_RocketTurret;
-                                        }
+                                            for(i = startI; abs(i - startI) < getStructureSize(itemID).x; i += incI) {
+                                                for(j = startJ; abs(j - startJ) < getStructureSize(itemID).y; j += incJ) {
+                                                    TerrainClass *tmpCell = currentGameMap->getCell(i, j);
 
-                                        if(itemID != NONE) {
-                                            Coord	placeLocation, location;
-                                            location = findPlaceLocation(itemID);
-
-                                            if(location.x >= 0) {
-                                                placeLocation = location;
-                                                if(currentGame->getGameInitSettings().isConcreteRequired()) {
-                                                    int i, j,
-                                                        incI, incJ,
-                                                        startI, startJ;
-
-                                                    if(currentGameMap->isWithinBuildRange(location.x, location.y, getHouse())) {
-                                                        startI = location.x, startJ = location.y, incI = 1, incJ = 1;
-                                                    } else if(currentGameMap->isWithinBuildRange(location.x + getStructureSize(itemID).x - 1, location.y, getHouse())) {
-                                                        startI = location.x + getStructureSize(itemID).x - 1, startJ = location.y, incI = -1, incJ = 1;
-                                                    } else if(currentGameMap->isWithinBuildRange(location.x, location.y + getStructureSize(itemID).y - 1, getHouse())) {
-                                                        startI = location.x, startJ = location.y + getStructureSize(itemID).y - 1, incI = 1, incJ = -1;
-                                                    } else {
-                                                        startI = location.x + getStructureSize(itemID).x - 1, startJ = location.y + getStructureSize(itemID).y - 1, incI = -1, incJ = -1;
+                                                    if(tmpCell == NULL) {
+                                                        fprintf(stderr,"%s - Line %d:getCell(%d,%d) returned NULL\n", __FILE__, __LINE__,i,j);
+                                                        fflush(stderr);
                                                     }
 
-                                                    for(i = startI; abs(i - startI) < getStructureSize(itemID).x; i += incI) {
-                                                        for(j = startJ; abs(j - startJ) < getStructureSize(itemID).y; j += incJ) {
-                                                            TerrainClass *tmpCell = currentGameMap->getCell(i, j);
-
-                                                            if(tmpCell == NULL) {
-                                                                fprintf(stderr,"%s - Line %d:getCell(%d,%d) returned NULL\n", __FILE__, __LINE__,i,j);
-                                                                fflush(stderr);
-                                                            }
-
-                                                            if(tmpCell->getType() != Terrain_Slab) {
-                                                                placeLocations.push_back(Coord(i,j));
-                                                                builder->DoProduceItem(Structure_Slab1);
-                                                            }
-                                                        }
+                                                    if(tmpCell->getType() != Terrain_Slab) {
+                                                        placeLocations.push_back(Coord(i,j));
+                                                        builder->DoProduceItem(Structure_Slab1);
                                                     }
                                                 }
-
-                                                placeLocations.push_back(placeLocation);
-                                                builder->DoProduceItem(itemID);
                                             }
                                         }
+
+                                        placeLocations.push_back(placeLocation);
+                                        builder->DoProduceItem(itemID);
                                     }
                                 }
                             }
+                        }
+                    }
 
-                            if(builder->IsWaitingToPlace()) {
-                                //find total region of possible placement and place in random ok position
-                                int ItemID = builder->GetCurrentProducedItem();
-                                Coord itemsize = getStructureSize(ItemID);
-
-                                //see if there is already a spot to put it stored
-                                if(!placeLocations.empty()) {
-                                    Coord location = placeLocations.front();
-
-                                    if(currentGameMap->okayToPlaceStructure(location.x, location.y, itemsize.x, itemsize.y, false, builder->getOwner())) {
-                                        builder->getOwner()->placeStructure(builder->getObjectID(), ItemID, location.x, location.y);
-                                        placeLocations.pop_front();
-                                    } else if(ItemID == Structure_Slab1) {
-                                        builder->DoCancelItem(Structure_Slab1);	//forget about concrete
-                                        placeLocations.pop_front();
-                                    } else {
-                                        //cancel item
-                                        builder->DoCancelItem(ItemID);
-                                        placeLocations.pop_front();
-                                    }
-                                }
+                    if(builder->IsWaitingToPlace()) {
+                        //find total region of possible placement and place in random ok position
+                        int ItemID = builder->GetCurrentProducedItem();
+                        Coord itemsize = getStructureSize(ItemID);
+
+                        //see if there is already a spot to put it stored
+                        if(!placeLocations.empty()) {
+                            Coord location = placeLocations.front();
+
+                            if(currentGameMap->okayToPlaceStructure(location.x, location.y, itemsize.x, itemsize.y, false, builder->getOwner())) {
+                                builder->getOwner()->placeStructure(builder->getObjectID(), ItemID, location.x, location.y);
+                                placeLocations.pop_front();
+                            } else if(ItemID == Structure_Slab1) {
+                                builder->DoCancelItem(Structure_Slab1);	//forget about concrete
+                                placeLocations.pop_front();
+                            } else {
+                                //cancel item
+                                builder->DoCancelItem(ItemID);
+                                placeLocations.pop_front();
                             }
-                        } break;
+                        }
+                    }
+                } break;
 
-                        case Structure_HeavyFactory: {
-                            if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
+                case Structure_HeavyFactory: {
+                    if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1) && (builder->getNumSelections() > 0)) {
 
-                                if(getHouse()->getNumItems(Unit_Harvester) < 2*getHouse()->getNumItems(Structure_Refinery)) {
-                                    builder->DoProduceItem(Unit_Harvester);
-                                } else {
-                                    builder->buildRandom();
-                                }
-                            }
-                        } break;
+                        if(getHouse()->getNumItems(Unit_Harvester) < 2*getHouse()->getNumItems(Structure_Refinery)) {
+                            builder->DoProduceItem(Unit_Harvester);
+                        } else {
+                            builder->buildRandom();
+                        }
+                    }
+                } break;
 
-                        case Structure_HighTechFactory: {
-                            if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1)) {
+                case Structure_HighTechFactory: {
+                    if((getHouse()->getCredits() > 100) && (builder->getNumItemsToBuild() < 1)) {
 
-                                if(getHouse()->getNumItems(Unit_Carryall) < getHouse()->getNumItems(Unit_Harvester)) {
-                                    builder->DoProduceItem(Unit_Carryall);
-                                } else {
-                                    builder->DoProduceItem(Unit_Ornithopter);
-                                }
-                            }
-                        } break;
-
-                        case Structure_StarPort: {
-                            if(((StarPortClass*)builder)->okToOrder())	{
-                                // order max 6 units
-                                int num = 6;
-                                while((num > 0) && (getHouse()->getCredits() > 2000)) {
-                                    builder->buildRandom();
-                                    num--;
-                                }
-                                ((StarPortClass*)builder)->DoPlaceOrder();
-                            }
-                        } break;
+                        if(getHouse()->getNumItems(Unit_Carryall) < getHouse()->getNumItems(Unit_Harvester)) {
+                            builder->DoProduceItem(Unit_Carryall);
+                        } else {
+                            builder->DoProduceItem(Unit_Ornithopter);
+                        }
+                    }
+                } break;
 
-                        default: {
-                            break;
+                case Structure_StarPort: {
+                    if(((StarPortClass*)builder)->okToOrder())	{
+                        // order max 6 units
+                        int num = 6;
+                        while((num > 0) && (getHouse()->getCredits() > 2000)) {
+                            builder->buildRandom();
+                            num--;
                         }
+                        ((StarPortClass*)builder)->DoPlaceOrder();
                     }
+                } break;
+
+                default: {
+                    break;
                 }
             }
-
 		}
 
 		buildTimer = ((2-difficulty) * MILLI2CYCLES(1000)) + currentGame->RandomGen.rand(300, 400) * (  getHouse()->getNumItems(Structure_HeavyFactory)
@@ -298,9 +280,9 @@ void AIPlayer::update() {
 	if(attackTimer > 0) {
 	    attackTimer--;
 	} else {
-        double speedCap = -1.0;
+        FixPoint speedCap = -1;
 
-	    RobustList<UnitClass*>::const_iterator iter;
+	    IntrusiveList<UnitClass>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
             UnitClass *tempUnit = *iter;
 
@@ -313,7 +295,7 @@ void AIPlayer::update() {
                 && (tempUnit->getItemID() != Unit_Carryall)
                 && (tempUnit->getItemID() != Unit_Saboteur)) {
                 //find slowest speed of all units
-                if ((speedCap < 0.0) || (tempUnit->getMaxSpeed() < speedCap))
+                if ((speedCap < 0) || (tempUnit->getMaxSpeed() < speedCap))
                     speedCap = tempUnit->getMaxSpeed();
             }
         }
@@ -366,15 +348,22 @@ void AIPlayer::update() {
 	}
 }
 
-void AIPlayer::onIncrementStructures(int itemID) {
+void AIPlayer::onIncrementStructures(int itemID, StructureClass* pStructure) {
+	structures.push_back(pStructure);
+	if(pStructure->isABuilder()) {
+		builders.push_back(pStructure);
+	}
 }
 
-void AIPlayer::onDecrementStructures(int itemID, const Coord& location) {
+void AIPlayer::onDecrementStructures(int itemID, const Coord& location, StructureClass* pStructure) {
+	structures.remove(pStructure);
+	builders.remove(pStructure);
+
 	/* // no good idea to rebuild everything
 	//rebuild the structure if its the original gameType
 
 	if (((currentGame->gameType == GAMETYPE_CAMPAIGN) || (currentGame->gameType == GAMETYPE_SKIRMISH)) && !structureList.empty()) {
-		RobustList<StructureClass*>::const_iterator iter;
+		IntrusiveList<StructureClass>::const_iterator iter;
 		for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 			StructureClass* structure = *iter;
 			if ((structure->getItemID() == Structure_ConstructionYard) && (structure->getOwner() == this)) {
@@ -430,7 +419,7 @@ void AIPlayer::onDamage(ObjectClass* pObject, const Coord& location) {
 	if((itemID == Unit_Harvester) || isStructure(itemID)) {
 	    //scramble some free units to defend
 
-	    RobustList<UnitClass*>::const_iterator iter;
+	    IntrusiveList<UnitClass>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 		    UnitClass* tempUnit = *iter;
 			if (tempUnit->isRespondable()
@@ -451,7 +440,7 @@ void AIPlayer::onDamage(ObjectClass* pObject, const Coord& location) {
 	} else if(pObject->isAUnit() && ((UnitClass*)pObject)->isAttacking()) {
 	    //if one of attack force is shot, unrestrict the speeds of others as to catch up
 
-	    RobustList<UnitClass*>::const_iterator iter;
+	    IntrusiveList<UnitClass>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 			UnitClass* tempUnit = *iter;
 			if (tempUnit->isRespondable()
@@ -461,7 +450,7 @@ void AIPlayer::onDamage(ObjectClass* pObject, const Coord& location) {
 				&& (tempUnit->getItemID() != Unit_MCV)
 				&& (tempUnit->getItemID() != Unit_Carryall)
 				&& (tempUnit->getItemID() != Unit_Saboteur)) {
-				tempUnit->setSpeedCap(NONE);
+				tempUnit->setSpeedCap(-1);
 			}
 		}
 	}
@@ -482,6 +471,25 @@ void AIPlayer::setAttackTimer(int newAttackTimer) {
 		attackTimer = newAttackTimer;
 }
 
+Uint32 AIPlayer::chooseStructureToBuild(BuilderClass* pConstructionYard) const {
+	for(size_t i = 0; i < sizeof(buildOrder)/sizeof(buildOrder[0]); i++) {
+		const BuildOrderStep& step = buildOrder[i];
+
+		bool bNeeded;
+		if(step.itemID == Structure_WindTrap) {
+			bNeeded = (getHouse()->getProducedPower() < step.limit);
+		} else {
+			bNeeded = (getHouse()->getNumItems(step.itemID) < step.limit) && (currentGame->techLevel >= step.minTechLevel);
+		}
+
+		if(bNeeded && pConstructionYard->isAvailableToBuild(step.itemID)) {
+			return step.itemID;
+		}
+	}
+
+	return NONE;
+}
+
 Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
     int structureSizeX = getStructureSize(itemID).x;
     int structureSizeY = getStructureSize(itemID).y;
@@ -493,18 +501,26 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
     int minY = currentGameMap->sizeY;
     int maxY = -1;
 
-    RobustList<StructureClass*>::const_iterator iter;
-    for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    std::list<StructureClass*>::const_iterator iter;
+    for(iter = structures.begin(); iter != structures.end(); ++iter) {
 		StructureClass* structure = *iter;
-		if (structure->getOwner() == getHouse()) {
-			if (structure->getX() < minX)
-				minX = structure->getX();
-			if (structure->getX() > maxX)
-				maxX = structure->getX();
-			if (structure->getY() < minY)
-				minY = structure->getY();
-			if (structure->getY() > maxY)
-				maxY = structure->getY();
+		if (structure->getX() < minX)
+			minX = structure->getX();
+		if (structure->getX() > maxX)
+			maxX = structure->getX();
+		if (structure->getY() < minY)
+			minY = structure->getY();
+		if (structure->getY() > maxY)
+			maxY = structure->getY();
+	}
+
+	// the enemy structures do not change while searching
+	std::vector<Coord> enemyLocations;
+	IntrusiveList<StructureClass>::const_iterator iter2;
+	for(iter2 = structureList.begin(); iter2 != structureList.end(); ++iter2) {
+		StructureClass* pStructure = *iter2;
+		if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
+			enemyLocations.push_back(pStructure->getLocation());
 		}
 	}
 
@@ -531,7 +547,7 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place near spice
                     Coord spicePos;
                     if(currentGameMap->findSpice(&spicePos, &pos)) {
-                        rating = 10000000 - blockDistance(pos, spicePos);
+                        rating = 10000000 - blockDistance(pos, spicePos).toDouble();
                     } else {
                         rating = 10000000;
                     }
@@ -544,24 +560,8 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                 case Structure_RepairYard:
                 case Structure_StarPort:
                 case Structure_WOR: {
-                    // place near sand
-
-                    double nearestSand = 10000000;
-
-                    for(int y = 0 ; y < currentGameMap->sizeY; y++) {
-                        for(int x = 0; x < currentGameMap->sizeX; x++) {
-                            int type = currentGameMap->getCell(x,y)->getType();
-
-                            if(type != Terrain_Rock || type != Terrain_Slab || type != Terrain_Mountain) {
-                                double tmp = blockDistance(pos, Coord(x,y));
-                                if(tmp < nearestSand) {
-                                    nearestSand = tmp;
-                                }
-                            }
-                        }
-                    }
-
-                    rating = 10000000 - nearestSand;
+                    // place near sand; the distance to the sand is not rated yet, so every position is equally good
+                    rating = 10000000;
                 } break;
 
                 case Structure_Wall:
@@ -570,15 +570,11 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place towards enemy
                     double nearestEnemy = 10000000;
 
-                    RobustList<StructureClass*>::const_iterator iter2;
-                    for(iter2 = structureList.begin(); iter2 != structureList.end(); ++iter2) {
-                        StructureClass* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            double tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter3;
+                    for(iter3 = enemyLocations.begin(); iter3 != enemyLocations.end(); ++iter3) {
+                        double tmp = blockDistance(pos, *iter3).toDouble();
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
@@ -595,15 +591,11 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place at a save place
                     double nearestEnemy = 10000000;
 
-                    RobustList<StructureClass*>::const_iterator iter2;
-                    for(iter2 = structureList.begin(); iter2 != structureList.end(); ++iter2) {
-                        StructureClass* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            double tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter3;
+                    for(iter3 = enemyLocations.begin(); iter3 != enemyLocations.end(); ++iter3) {
+                        double tmp = blockDistance(pos, *iter3).toDouble();
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
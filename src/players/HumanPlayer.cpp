@@ -37,10 +37,10 @@ void HumanPlayer::save(Stream& stream) const {
 void HumanPlayer::update() {
 }
 
-void HumanPlayer::onIncrementStructures(int itemID) {
+void HumanPlayer::onIncrementStructures(int itemID, StructureClass* pStructure) {
 }
 
-void HumanPlayer::onDecrementStructures(int itemID, const Coord& location) {
+void HumanPlayer::onDecrementStructures(int itemID, const Coord& location, StructureClass* pStructure) {
 }
 
 void HumanPlayer::onDamage(ObjectClass* pObject, const Coord& location) {
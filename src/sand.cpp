@@ -21,6 +21,8 @@
 
 #include <FileClasses/GFXManager.h>
 #include <FileClasses/TextManager.h>
+#include <FileClasses/FileManager.h>
+#include <FileClasses/adl/sound_adlib.h>
 
 #include <Menu/BriefingMenu.h>
 #include <Menu/GameStatsMenu.h>
@@ -30,9 +32,16 @@
 
 #include <Game.h>
 #include <GameInitSettings.h>
+#include <MapClass.h>
+#include <AStarSearch.h>
 #include <data.h>
 
 #include <misc/string_util.h>
+#include <misc/Random.h>
+#include <misc/RobustList.h>
+#include <misc/IntrusiveList.h>
+
+#include <units/UnitClass.h>
 
 #include <algorithm>
 
@@ -329,20 +338,27 @@ ATTACKMODE getAttackModeByName(std::string name)
 }
 
 /**
-	Starts a game replay
+	Starts a game replay. If the user seeks inside the replay it is restarted at the new position.
 	\param	filename	the filename of the replay file
 */
 void startReplay(std::string filename) {
-    printf("Initing Replay:\n");
-    currentGame = new Game();
-    currentGame->initReplay(filename);
+    Uint32 startCycle = 0;
+    bool bContinue = true;
+    while(bContinue == true) {
+        printf("Initing Replay:\n");
+        currentGame = new Game();
+        currentGame->initReplay(filename, startCycle);
 
-    printf("Initialization finished!\n");
-    fflush(stdout);
+        printf("Initialization finished!\n");
+        fflush(stdout);
 
-    currentGame->runMainLoop();
+        currentGame->runMainLoop();
 
-    delete currentGame;
+        bContinue = (currentGame->whatNext() == GAME_REPLAY_SEEK);
+        startCycle = currentGame->getReplaySeekCycle();
+
+        delete currentGame;
+    }
 }
 
 
@@ -442,3 +458,290 @@ void startSinglePlayerGame(const GameInitSettings& init)
 
 	}
 }
+
+
+/**
+	Loads every campaign mission of the original game and measures how many path searches per second can be performed
+	on it. Every ground unit on the map searches paths to a number of fixed pseudo random destinations. The results are
+	printed to stdout.
+*/
+void runPathfindingBenchmark()
+{
+    const int SEARCHES_PER_UNIT = 16;
+
+    static const HOUSETYPE houses[] = { HOUSE_ATREIDES, HOUSE_ORDOS, HOUSE_HARKONNEN };
+
+    Uint32 totalSearches = 0;
+    Uint32 totalTime = 0;
+
+    printf("Pathfinding benchmark:\n");
+
+    for(int h = 0; h < 3; h++) {
+        for(int mission = 1; mission <= 22; mission++) {
+            GameInitSettings init(houses[h], mission, false, false);
+
+            currentGame = new Game();
+            try {
+                currentGame->initGame(init, false);
+            } catch(std::exception& e) {
+                fprintf(stderr, "%s: Cannot load map: %s\n", init.getFilename().c_str(), e.what());
+                delete currentGame;
+                currentGame = NULL;
+                continue;
+            }
+
+            // use always the same destinations to make the results comparable
+            Random benchmarkRandom(mission);
+
+            Uint32 numSearches = 0;
+            Uint32 numUnits = 0;
+            Uint32 startTime = SDL_GetTicks();
+            for(IntrusiveList<UnitClass>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+                UnitClass* pUnit = *iter;
+
+                if(pUnit->isAFlyingUnit()) {
+                    continue;
+                }
+
+                numUnits++;
+                for(int i = 0; i < SEARCHES_PER_UNIT; i++) {
+                    Coord destination(benchmarkRandom.rand(0, currentGameMap->sizeX - 1), benchmarkRandom.rand(0, currentGameMap->sizeY - 1));
+                    AStarSearch pathfinder(currentGameMap, pUnit, pUnit->getLocation(), destination);
+                    pathfinder.getFoundPath();
+                    numSearches++;
+                }
+            }
+            Uint32 time = SDL_GetTicks() - startTime;
+
+            printf("%s: %dx%d map, %d units, %d searches in %d ms (%.1f searches/s)\n",
+                    init.getFilename().c_str(), currentGameMap->sizeX, currentGameMap->sizeY, numUnits, numSearches, time,
+                    (time == 0) ? 0.0 : (1000.0 * numSearches) / time);
+            fflush(stdout);
+
+            totalSearches += numSearches;
+            totalTime += time;
+
+            delete currentGame;
+            currentGame = NULL;
+        }
+    }
+
+    printf("Total: %d searches in %d ms (%.1f searches/s)\n", totalSearches, totalTime, (totalTime == 0) ? 0.0 : (1000.0 * totalSearches) / totalTime);
+    fflush(stdout);
+}
+
+
+/**
+	Renders some of the AdLib music tracks with both OPL emulator cores (MAME and DOSBox) and measures how many
+	samples per second can be produced. The music is rendered in the format of the opened audio device, so the format
+	conversion is measured as well. The results are printed to stdout.
+*/
+void runMusicBenchmark()
+{
+    const int SECONDS_PER_TRACK = 60;
+    const int SAMPLES_PER_CALLBACK = 1024;
+
+    static const char* const filenames[] = { "DUNE1.ADL", "DUNE2.ADL", "DUNE7.ADL", "DUNE10.ADL" };
+    static const int tracks[] = { 2, 6, 2, 7 };
+    static const int numTracks = sizeof(tracks)/sizeof(tracks[0]);
+
+    int frequency;
+    Uint16 format;
+    int channels;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    int bytesPerSample = channels * (((format == AUDIO_U8) || (format == AUDIO_S8)) ? 1 : 2);
+
+    std::vector<Uint8> buffer(SAMPLES_PER_CALLBACK*bytesPerSample);
+
+    printf("Music benchmark (%d Hz, %d channels):\n", frequency, channels);
+
+    for(int core = 0; core < 2; core++) {
+        bool bMAME = (core == 0);
+        const char* coreName = bMAME ? "MAME" : "DOSBox";
+
+        Uint32 totalSamples = 0;
+        Uint32 totalTime = 0;
+
+        for(int i = 0; i < numTracks; i++) {
+            SDL_RWops* rwop = pFileManager->OpenFile(filenames[i]);
+            if(rwop == NULL) {
+                fprintf(stderr, "Cannot open %s!\n", filenames[i]);
+                continue;
+            }
+
+            SoundAdlibPC* pSoundAdlibPC = new SoundAdlibPC(rwop, bMAME);
+            SDL_RWclose(rwop);
+            pSoundAdlibPC->playTrack(tracks[i]);
+
+            Uint32 numSamples = 0;
+            Uint32 startTime = SDL_GetTicks();
+            while(numSamples < (Uint32) (SECONDS_PER_TRACK*frequency)) {
+                SoundAdlibPC::callback(pSoundAdlibPC, &buffer[0], buffer.size());
+                numSamples += SAMPLES_PER_CALLBACK;
+            }
+            Uint32 time = SDL_GetTicks() - startTime;
+
+            delete pSoundAdlibPC;
+
+            printf("%s core, %s/%d: %d samples in %d ms (%.0f samples/s, %.1fx realtime)\n",
+                    coreName, filenames[i], tracks[i], numSamples, time,
+                    (time == 0) ? 0.0 : (1000.0 * numSamples) / time,
+                    (time == 0) ? 0.0 : (1000.0 * numSamples) / time / frequency);
+            fflush(stdout);
+
+            totalSamples += numSamples;
+            totalTime += time;
+        }
+
+        printf("%s core total: %d samples in %d ms (%.0f samples/s)\n", coreName, totalSamples, totalTime,
+                (totalTime == 0) ? 0.0 : (1000.0 * totalSamples) / totalTime);
+        fflush(stdout);
+    }
+}
+
+namespace {
+
+    /// An element of the lists compared by runListBenchmark()
+    class BenchmarkElement : public IntrusiveListHook {
+    public:
+        BenchmarkElement() : value(0) { }
+
+        int value;
+    };
+
+    /**
+        Runs the three list benchmarks on an empty list of type ListType and prints the results.
+        \param	listName	the name of the list to print
+        \param	elements	the elements to store in the list
+        \param	repetitions	how often each benchmark is repeated
+    */
+    template<class ListType>
+    void benchmarkList(const char* listName, std::vector<BenchmarkElement>& elements, int repetitions)
+    {
+        ListType list;
+        int numElements = elements.size();
+        int checksum = 0;
+
+        // traversal of a list of units, structures or bullets as done several times per game cycle
+        for(int i = 0; i < numElements; i++) {
+            list.push_back(&elements[i]);
+        }
+
+        Uint32 startTime = SDL_GetTicks();
+        for(int r = 0; r < repetitions; r++) {
+            for(typename ListType::iterator iter = list.begin(); iter != list.end(); ++iter) {
+                checksum += (*iter)->value;
+            }
+        }
+        Uint32 traversalTime = SDL_GetTicks() - startTime;
+
+        // objects removing themselves while the list is iterated over (e.g. destroyed units)
+        startTime = SDL_GetTicks();
+        for(int r = 0; r < repetitions; r++) {
+            for(typename ListType::iterator iter = list.begin(); iter != list.end(); ++iter) {
+                BenchmarkElement* pElement = *iter;
+                if(pElement->value % 2 == r % 2) {
+                    list.remove(pElement);
+                }
+            }
+
+            for(int i = 0; i < numElements; i++) {
+                if(elements[i].value % 2 == r % 2) {
+                    list.push_back(&elements[i]);
+                }
+            }
+        }
+        Uint32 removalTime = SDL_GetTicks() - startTime;
+
+        list.clear();
+
+        // short-living objects that are added and removed again (e.g. bullets and explosions)
+        startTime = SDL_GetTicks();
+        for(int r = 0; r < repetitions; r++) {
+            for(int i = 0; i < numElements; i++) {
+                list.push_back(&elements[i]);
+            }
+            for(int i = 0; i < numElements; i++) {
+                list.remove(&elements[i]);
+            }
+        }
+        Uint32 churnTime = SDL_GetTicks() - startTime;
+
+        printf("%s: traversal %d ms, removal while iterating %d ms, add/remove %d ms (checksum %d)\n",
+                listName, traversalTime, removalTime, churnTime, checksum);
+        fflush(stdout);
+    }
+}
+
+/**
+	Compares the old RobustList with the IntrusiveList used for units, structures, bullets and explosions. Both lists
+	are traversed, modified while iterating over them and filled and emptied repeatedly. The results are printed to stdout.
+*/
+void runListBenchmark()
+{
+    const int NUM_ELEMENTS = 1000;
+    const int REPETITIONS = 5000;
+
+    std::vector<BenchmarkElement> elements(NUM_ELEMENTS);
+    for(int i = 0; i < NUM_ELEMENTS; i++) {
+        elements[i].value = i;
+    }
+
+    printf("List benchmark (%d elements, %d repetitions):\n", NUM_ELEMENTS, REPETITIONS);
+
+    benchmarkList<RobustList<BenchmarkElement*> >("RobustList", elements, REPETITIONS);
+    benchmarkList<IntrusiveList<BenchmarkElement> >("IntrusiveList", elements, REPETITIONS);
+}
+
+/**
+	Runs a replay or a scenario without drawing anything and measures how many game cycles per second can be simulated.
+	The simulation stops when the game is won or lost or after maxCycles game cycles. The results are printed to stdout.
+	\param	filename	the replay file or the scenario INI file to run
+	\param	bReplay		true if filename is a replay, false if it is a scenario
+	\param	maxCycles	the maximum number of game cycles to simulate
+*/
+void runHeadlessSimulation(const std::string& filename, bool bReplay, Uint32 maxCycles)
+{
+    static const char* subsystemNames[Game::NUM_SUBSYSTEMS] = { "Commands", "Houses", "Triggers", "Objects" };
+
+    printf("Headless simulation of %s:\n", filename.c_str());
+
+    currentGame = new Game();
+    try {
+        if(bReplay == true) {
+            currentGame->initReplay(filename);
+        } else {
+            // use always the same random seed to make the results comparable
+            srand(0);
+            GameInitSettings init(filename, settings.General.ConcreteRequired, settings.General.FogOfWar);
+            currentGame->initGame(init, false);
+        }
+    } catch(std::exception& e) {
+        fprintf(stderr, "%s: Cannot load map: %s\n", filename.c_str(), e.what());
+        delete currentGame;
+        currentGame = NULL;
+        return;
+    }
+
+    clock_t subsystemTimes[Game::NUM_SUBSYSTEMS];
+    for(int i = 0; i < Game::NUM_SUBSYSTEMS; i++) {
+        subsystemTimes[i] = 0;
+    }
+
+    clock_t startTime = clock();
+    Uint32 numCycles = currentGame->runHeadless(maxCycles, subsystemTimes);
+    double totalTime = (1000.0 * (clock() - startTime)) / CLOCKS_PER_SEC;
+
+    printf("%d game cycles in %.1f ms (%.1f cycles/s)\n", numCycles, totalTime, (totalTime == 0.0) ? 0.0 : (1000.0 * numCycles) / totalTime);
+    for(int i = 0; i < Game::NUM_SUBSYSTEMS; i++) {
+        double time = (1000.0 * subsystemTimes[i]) / CLOCKS_PER_SEC;
+        printf("  %-10s %10.1f ms (%5.1f%%)\n", subsystemNames[i], time, (totalTime == 0.0) ? 0.0 : (100.0 * time) / totalTime);
+    }
+
+    const char* result = (currentGame->isFinished() == false) ? "not finished" : (currentGame->isWon() ? "won" : "lost");
+    printf("Result: %s after game cycle %d, random seed %u\n", result, currentGame->GetGameCycleCount(), currentGame->RandomGen.getSeed());
+    fflush(stdout);
+
+    delete currentGame;
+    currentGame = NULL;
+}
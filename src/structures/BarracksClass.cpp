@@ -37,7 +37,7 @@ BarracksClass::BarracksClass(Stream& stream) : BuilderClass(stream)
 void BarracksClass::init()
 {
     itemID = Structure_Barracks;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
@@ -45,12 +45,12 @@ BuilderClass::BuilderClass(Stream& stream) : StructureClass(stream) {
     BuilderClass::init();
 
 	upgrading = stream.readBool();
-	upgradeProgress = stream.readDouble();
+	upgradeProgress = stream.readFixPoint();
     curUpgradeLev = stream.readUint8();
 
 	CurrentItemOnHold = stream.readBool();
 	CurrentProducedItem = stream.readUint32();
-	ProductionProgress = stream.readDouble();
+	ProductionProgress = stream.readFixPoint();
 	deployTimer = stream.readUint32();
 
 	int numProductionQueueItem = stream.readUint32();
@@ -80,12 +80,12 @@ void BuilderClass::save(Stream& stream) const {
 	StructureClass::save(stream);
 
     stream.writeBool(upgrading);
-    stream.writeDouble(upgradeProgress);
+    stream.writeFixPoint(upgradeProgress);
 	stream.writeUint8(curUpgradeLev);
 
 	stream.writeBool(CurrentItemOnHold);
 	stream.writeUint32(CurrentProducedItem);
-	stream.writeDouble(ProductionProgress);
+	stream.writeFixPoint(ProductionProgress);
 	stream.writeUint32(deployTimer);
 
 	stream.writeUint32(CurrentProductionList.size());
@@ -183,7 +183,7 @@ void BuilderClass::RemoveItem(std::list<BuildItem>& List, std::list<BuildItem>::
             // is this item currently produced?
             if(CurrentProducedItem == itemID) {
                 owner->returnCredits(ProductionProgress);
-                ProductionProgress = 0.0;
+                ProductionProgress = 0;
                 CurrentProducedItem = ItemID_Invalid;
             }
 
@@ -218,7 +218,7 @@ bool BuilderClass::IsWaitingToPlace() const {
 	if(tmp == NULL) {
 		return false;
 	} else {
-		return (ProductionProgress >= tmp->price);
+		return (ProductionProgress >= (int) tmp->price);
 	}
 }
 
@@ -227,14 +227,14 @@ void BuilderClass::buildUpdate() {
     if(CurrentProducedItem != ItemID_Invalid) {
         BuildItem* tmp = GetBuildItem(CurrentProducedItem);
 
-        if((ProductionProgress < tmp->price) && (IsOnHold() == false) && (owner->getCredits() > 0)) {
+        if((ProductionProgress < (int) tmp->price) && (IsOnHold() == false) && (owner->getCredits() > 0)) {
 
-            double buildSpeed = getHealth() / (double) getMaxHealth();
-            double totalBuildCosts = currentGame->objectData.data[CurrentProducedItem].price;
-            double totalBuildGameTicks = currentGame->objectData.data[CurrentProducedItem].buildtime*15.0;
-            double buildCosts = totalBuildCosts / totalBuildGameTicks;
+            FixPoint buildSpeed = getHealth() / getMaxHealth();
+            int totalBuildCosts = currentGame->objectData.data[CurrentProducedItem].price;
+            int totalBuildGameTicks = currentGame->objectData.data[CurrentProducedItem].buildtime*15;
+            FixPoint buildCosts = FixPoint::fromFraction(totalBuildCosts, totalBuildGameTicks);
 
-            double oldProgress = ProductionProgress;
+            FixPoint oldProgress = ProductionProgress;
 
             ProductionProgress += owner->takeCredits(buildCosts*buildSpeed);
 
@@ -250,7 +250,7 @@ void BuilderClass::buildUpdate() {
                 currentGame->AddToNewsTicker(pTextManager->getLocalized("Not enough money"));
             }
 
-            if(ProductionProgress >= tmp->price) {
+            if(ProductionProgress >= (int) tmp->price) {
                 setWaitingToPlace();
             }
         }
@@ -276,7 +276,7 @@ void BuilderClass::ProduceNextAvailableItem() {
 		CurrentProducedItem = CurrentProductionList.front().ItemID;
 	}
 
-	ProductionProgress = 0.0;
+	ProductionProgress = 0;
 	CurrentItemOnHold = false;
 }
 
@@ -300,7 +300,7 @@ void BuilderClass::setWaitingToPlace() {
 }
 
 void BuilderClass::unSetWaitingToPlace() {
-	ProductionProgress = 0.0;
+	ProductionProgress = 0;
 	DoCancelItem(CurrentProducedItem);
 }
 
@@ -313,11 +313,11 @@ bool BuilderClass::update() {
         return false;
 	}
 
-	if(isUnit(CurrentProducedItem) && (ProductionProgress >= GetBuildItem(CurrentProducedItem)->price)) {
+	if(isUnit(CurrentProducedItem) && (ProductionProgress >= (int) GetBuildItem(CurrentProducedItem)->price)) {
         deployTimer--;
         if(deployTimer == 0) {
             int FinishedItemID = CurrentProducedItem;
-			ProductionProgress = 0.0;
+			ProductionProgress = 0;
 			DoCancelItem(CurrentProducedItem);
 
 			UnitClass* newUnit = getOwner()->createUnit(FinishedItemID);
@@ -336,16 +336,16 @@ bool BuilderClass::update() {
 				if (destination.x != INVALID_POS) {
 					newUnit->setGuardPoint(destination);
 					newUnit->setDestination(destination);
-					newUnit->setAngle(lround(8.0/256.0*dest_angle(newUnit->getLocation(), newUnit->getDestination())));
+					newUnit->setAngle((dest_angle(newUnit->getLocation(), newUnit->getDestination())/32).roundToInt());
 				}
 			}
         }
 	}
 
 	if(upgrading == true) {
-	    double totalUpgradePrice = GetUpgradeCost();
-	    double totalUpgradeGameTicks = 30.0 * 100.0 / 5.0;
-		upgradeProgress += owner->takeCredits(totalUpgradePrice / totalUpgradeGameTicks);
+	    int totalUpgradePrice = GetUpgradeCost();
+	    int totalUpgradeGameTicks = 30 * 100 / 5;
+		upgradeProgress += owner->takeCredits(FixPoint::fromFraction(totalUpgradePrice, totalUpgradeGameTicks));
 
 		if(upgradeProgress >= totalUpgradePrice) {
 			upgrading = false;
@@ -381,7 +381,7 @@ void BuilderClass::HandleSetOnHoldClick(bool OnHold) {
 void BuilderClass::DoUpgrade() {
 	if(owner->getCredits() >= GetUpgradeCost()) {
 		upgrading = true;
-		upgradeProgress = 0.0;
+		upgradeProgress = 0;
 	}
 }
 
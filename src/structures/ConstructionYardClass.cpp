@@ -38,7 +38,7 @@ ConstructionYardClass::ConstructionYardClass(Stream& stream) : BuilderClass(stre
 void ConstructionYardClass::init()
 {
     itemID = Structure_ConstructionYard;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
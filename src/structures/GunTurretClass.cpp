@@ -37,7 +37,7 @@ GunTurretClass::GunTurretClass(Stream& stream) : TurretClass(stream)
 
 void GunTurretClass::init() {
     itemID = Structure_GunTurret;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	attackSound = Sound_Gun;
 	bulletType = Bullet_Shell;
@@ -38,7 +38,7 @@ HeavyFactoryClass::HeavyFactoryClass(Stream& stream) : BuilderClass(stream)
 void HeavyFactoryClass::init()
 {
    	itemID = Structure_HeavyFactory;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 2;
@@ -38,7 +38,7 @@ HighTechFactoryClass::HighTechFactoryClass(Stream& stream) : BuilderClass(stream
 void HighTechFactoryClass::init()
 {
     itemID = Structure_HighTechFactory;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 2;
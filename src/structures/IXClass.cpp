@@ -37,7 +37,7 @@ IXClass::IXClass(Stream& stream) : StructureClass(stream)
 void IXClass::init()
 {
 	itemID = Structure_IX;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
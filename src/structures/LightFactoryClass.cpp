@@ -38,7 +38,7 @@ LightFactoryClass::LightFactoryClass(Stream& stream) : BuilderClass(stream)
 void LightFactoryClass::init()
 {
     itemID = Structure_LightFactory;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
@@ -52,7 +52,7 @@ PalaceClass::PalaceClass(Stream& stream) : StructureClass(stream)
 void PalaceClass::init()
 {
     itemID = Structure_Palace;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 3;
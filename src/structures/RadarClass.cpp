@@ -37,7 +37,7 @@ RadarClass::RadarClass(Stream& stream) : StructureClass(stream)
 void RadarClass::init()
 {
     itemID = Structure_Radar;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
@@ -68,7 +68,7 @@ RefineryClass::RefineryClass(Stream& stream) : StructureClass(stream)
 void RefineryClass::init()
 {
     itemID = Structure_Refinery;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 2;
@@ -170,13 +170,13 @@ void RefineryClass::doSpecificStuff()
 	if(extractingSpice) {
 	    HarvesterClass* pHarvester = (HarvesterClass*) harvester.getObjPointer();
 
-		if(pHarvester->getAmountOfSpice() > 0.0) {
+		if(pHarvester->getAmountOfSpice() > 0) {
 			owner->addCredits(pHarvester->extractSpice(), true);
 		} else if(pHarvester->isAwaitingPickup() == false) {
 		    // find carryall
 		    Carryall* pCarryall = NULL;
             if((pHarvester->getGuardPoint().x != INVALID_POS) && getOwner()->hasCarryalls())	{
-                RobustList<UnitClass*>::const_iterator iter;
+                IntrusiveList<UnitClass>::const_iterator iter;
                 for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
                     UnitClass* unit = *iter;
                     if ((unit->getOwner() == owner) && (unit->getItemID() == Unit_Carryall)) {
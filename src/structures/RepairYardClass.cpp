@@ -50,7 +50,7 @@ RepairYardClass::RepairYardClass(Stream& stream) : StructureClass(stream)
 void RepairYardClass::init()
 {
     itemID = Structure_RepairYard;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 2;
@@ -134,7 +134,7 @@ void RepairYardClass::doSpecificStuff()
 	if(repairing == true) {
 	    UnitClass* pRepairUnit = repairUnit.getUnitPointer();
 
-		if (pRepairUnit->getHealth()*100/pRepairUnit->getMaxHealth() < 100) {
+		if (pRepairUnit->getHealth() < pRepairUnit->getMaxHealth()) {
 			if (owner->takeCredits(UNIT_REPAIRCOST) > 0) {
 				pRepairUnit->addHealth();
 			}
@@ -142,7 +142,7 @@ void RepairYardClass::doSpecificStuff()
 		    // find carryall
 		    Carryall* pCarryall = NULL;
             if((pRepairUnit->getGuardPoint().x != INVALID_POS) && getOwner()->hasCarryalls())	{
-                RobustList<UnitClass*>::const_iterator iter;
+                IntrusiveList<UnitClass>::const_iterator iter;
                 for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
                     UnitClass* unit = *iter;
                     if ((unit->getOwner() == owner) && (unit->getItemID() == Unit_Carryall)) {
@@ -38,7 +38,7 @@ RocketTurretClass::RocketTurretClass(Stream& stream) : TurretClass(stream)
 
 void RocketTurretClass::init() {
 	itemID = Structure_RocketTurret;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	attackSound = Sound_Rocket;
 	bulletType = Bullet_Rocket;
@@ -39,7 +39,7 @@ SiloClass::SiloClass(Stream& stream) : StructureClass(stream)
 void SiloClass::init()
 {
 	itemID = Structure_Silo;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
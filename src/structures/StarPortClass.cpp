@@ -60,7 +60,7 @@ StarPortClass::StarPortClass(Stream& stream) : BuilderClass(stream)
 void StarPortClass::init()
 {
 	itemID = Structure_StarPort;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 3;
 	structureSize.y = 3;
@@ -132,7 +132,7 @@ void StarPortClass::DoProduceItem(Uint32 ItemID, bool multipleMode) {
 				if((owner->getCredits() >= (int) iter->price)) {
                     iter->num++;
 					CurrentProductionList.push_back( ProductionQueueItem(ItemID,iter->price) );
-					owner->takeCredits(iter->price);
+					owner->takeCredits((int) iter->price);
 
 				    if(choam.setNumAvailable(ItemID, numAvailable - 1) == false) {
                         // sold out
@@ -179,7 +179,7 @@ void StarPortClass::DoCancelItem(Uint32 ItemID, bool multipleMode) {
 
 					// Cancel the best found item if any was found
 					if(iterMostExpensiveItem != CurrentProductionList.end()) {
-                        owner->returnCredits(iterMostExpensiveItem->price);
+                        owner->returnCredits((int) iterMostExpensiveItem->price);
                         CurrentProductionList.erase(iterMostExpensiveItem);
 					}
 				}
@@ -341,7 +341,7 @@ void StarPortClass::doSpecificStuff()
                     if (destination.x != INVALID_POS) {
                         newUnit->setGuardPoint(destination);
                         newUnit->setDestination(destination);
-                        newUnit->setAngle(lround(8.0/256.0*dest_angle(newUnit->getLocation(), newUnit->getDestination())));
+                        newUnit->setAngle((dest_angle(newUnit->getLocation(), newUnit->getDestination())/32).roundToInt());
                     }
                 }
 
@@ -78,9 +78,14 @@ void StructureClass::init() {
 
 StructureClass::~StructureClass() {
     currentGameMap->removeObjectFromMap(getObjectID());	//no map point will reference now
+    for(int i = location.x; i < location.x + structureSize.x; i++) {
+        for(int j = location.y; j < location.y + structureSize.y; j++) {
+            currentGameMap->onTileChanged(Coord(i,j));
+        }
+    }
 	currentGame->getObjectManager().RemoveObject(getObjectID());
 	structureList.remove(this);
-	owner->decrementStructures(itemID, location);
+	owner->decrementStructures(itemID, location, this);
 
     removeFromSelectionLists();
 }
@@ -110,14 +115,14 @@ void StructureClass::assignToMap(const Coord& pos)
 	for (int i = pos.x; i < pos.x + structureSize.x; i++) {
 		for (int j = pos.y; j < pos.y + structureSize.y; j++) {
 			if (currentGameMap->cellExists(i, j)) {
-				currentGameMap->cell[i][j].assignNonInfantryGroundObject(getObjectID());
+				currentGameMap->getCell(i, j)->assignNonInfantryGroundObject(getObjectID());
 				if((itemID != Structure_Wall) && (itemID != Structure_ConstructionYard)
-                     && !currentGameMap->cell[i][j].isConcrete() && currentGame->getGameInitSettings().isConcreteRequired()
+                     && !currentGameMap->getCell(i, j)->isConcrete() && currentGame->getGameInitSettings().isConcreteRequired()
                      && (currentGame->gameState != START)) {
-                    setHealth(getHealth() - (0.5*(double)getMaxHealth()/((double)(structureSize.x*structureSize.y))));
+                    setHealth(getHealth() - FixPoint::fromFraction(getMaxHealth(), 2*structureSize.x*structureSize.y));
 				}
-				currentGameMap->cell[i][j].setType(Terrain_Rock);
-				currentGameMap->cell[i][j].setOwner(getOwner()->getHouseID());
+				currentGameMap->getCell(i, j)->setType(Terrain_Rock);
+				currentGameMap->getCell(i, j)->setOwner(getOwner()->getHouseID());
 				currentGameMap->viewMap(getOwner()->getTeam(), Coord(i,j), getViewRange());
 
 				setVisible(VIS_ALL, true);
@@ -209,7 +214,7 @@ void StructureClass::drawSelectionBox()
 	}
 
 	// Draws two lines right below the upper part of the selection box.
-	drawrect(screen, dest.x+1, dest.y+1, dest.x + ((int)((getHealth()/(double)getMaxHealth())*(BLOCKSIZE*structureSize.x - 2))), dest.y+2, getHealthColor());
+	drawrect(screen, dest.x+1, dest.y+1, dest.x + ((int)((getHealth().toDouble()/getMaxHealth())*(BLOCKSIZE*structureSize.x - 2))), dest.y+2, getHealthColor());
 }
 
 /**
@@ -218,8 +223,8 @@ void StructureClass::drawSelectionBox()
 */
 Coord StructureClass::getCenterPoint() const
 {
-    return Coord( lround(realX + structureSize.x*BLOCKSIZE/2),
-                  lround(realY + structureSize.y*BLOCKSIZE/2));
+    return Coord( (realX + structureSize.x*BLOCKSIZE/2).roundToInt(),
+                  (realY + structureSize.y*BLOCKSIZE/2).roundToInt());
 }
 
 Coord StructureClass::getClosestCenterPoint(const Coord& objectLocation) const
@@ -229,12 +234,12 @@ Coord StructureClass::getClosestCenterPoint(const Coord& objectLocation) const
 
 int StructureClass::getDrawnX() const
 {
-	return screenborder->world2screenX(realX);
+	return screenborder->world2screenX(realX.toInt());
 }
 
 int StructureClass::getDrawnY() const
 {
-	return screenborder->world2screenY(realY);
+	return screenborder->world2screenY(realY.toInt());
 }
 
 void StructureClass::HandleActionClick(int xPos, int yPos)
@@ -299,7 +304,7 @@ bool StructureClass::update()
             }
 
             if(getHealth() > getMaxHealth() / 2) {
-                setHealth( getHealth() - ((damageMultiplyer * (double)getMaxHealth())/100));
+                setHealth( getHealth() - FixPoint::fromFraction(damageMultiplyer * getMaxHealth(), 100));
             }
         }
     }
@@ -316,12 +321,12 @@ bool StructureClass::update()
             // Original dune 2 is doing the repair calculation with fix-point math (multiply everything with 256).
             // It is calculating what fraction 2 hitpoints of the maximum health would be.
             int fraction = (2*256)/getMaxHealth();
-            double repairprice = (fraction * currentGame->objectData.data[itemID].price) / 256.0;
+            int repairprice = fraction * currentGame->objectData.data[itemID].price;
 
             // Original dune is always repairing 5 hitpoints (for the costs of 2) but we are only repairing 1/30th of that
-            owner->takeCredits(repairprice/30.0);
-            double newHealth = getHealth();
-            newHealth += 5.0/30.0;
+            owner->takeCredits(FixPoint::fromFraction(repairprice, 256*30));
+            FixPoint newHealth = getHealth();
+            newHealth += FixPoint::fromFraction(5, 30);
             if(newHealth >= getMaxHealth()) {
                 setHealth(getMaxHealth());
                 repairing = false;
@@ -331,7 +336,7 @@ bool StructureClass::update()
         } else {
             repairing = false;
         }
-    } else if(owner->isAI() && ((getHealth()/(double)getMaxHealth()) < 0.75)) {
+    } else if(owner->isAI() && ((getHealth()/getMaxHealth()) < FixPoint::fromFraction(3, 4))) {
         DoRepair();
     }
 
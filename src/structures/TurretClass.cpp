@@ -29,7 +29,7 @@ TurretClass::TurretClass(House* newOwner) : StructureClass(newOwner)
     TurretClass::init();
 
     angle = currentGame->RandomGen.rand(0, 7);
-	drawnAngle = lround(angle);
+	drawnAngle = angle.roundToInt();
 
 	findTargetTimer = 0;
 	weaponTimer = 0;
@@ -71,8 +71,8 @@ void TurretClass::doSpecificStuff()
 			setTarget(NULL);
 		} else if (targetInWeaponRange()) {
 			Coord closestPoint = target.getObjPointer()->getClosestPoint(location);
-			double destAngle = dest_angle(location, closestPoint);
-			int wantedAngle = lround(8.0/256.0*destAngle);
+			FixPoint destAngle = dest_angle(location, closestPoint);
+			int wantedAngle = (destAngle/32).roundToInt();
 
 			if(wantedAngle == 8) {
 				wantedAngle = 0;
@@ -80,12 +80,12 @@ void TurretClass::doSpecificStuff()
 
 			if(angle != wantedAngle) {
 				// turn
-                double  angleLeft = 0.0;
-                double  angleRight = 0.0;
+                FixPoint  angleLeft = 0;
+                FixPoint  angleRight = 0;
 
                 if(angle > wantedAngle) {
                     angleRight = angle - wantedAngle;
-                    angleLeft = fabs(8-angle)+wantedAngle;
+                    angleLeft = FixPoint::abs(8-angle)+wantedAngle;
                 }
                 else if (angle < wantedAngle) {
                     angleRight = abs(8-wantedAngle) + angle;
@@ -140,18 +140,18 @@ void TurretClass::DoAttackObject(Uint32 TargetObjectID) {
 void TurretClass::turnLeft()
 {
 	angle += currentGame->objectData.data[itemID].turnspeed;
-	if (angle >= 7.5)	//must keep drawnangle between 0 and 7
-		angle -= 8.0;
-	drawnAngle = lround(angle);
+	if (angle >= FixPoint::fromFraction(15,2))	//must keep drawnangle between 0 and 7
+		angle -= 8;
+	drawnAngle = angle.roundToInt();
 	curAnimFrame = FirstAnimFrame = LastAnimFrame = ((10-drawnAngle) % 8) + 2;
 }
 
 void TurretClass::turnRight()
 {
 	angle -= currentGame->objectData.data[itemID].turnspeed;
-	if (angle < -0.5)	//must keep drawnangle between 0 and 7
+	if (angle < -FixPoint::fromFraction(1,2))	//must keep drawnangle between 0 and 7
 		angle += 8;
-	drawnAngle = lround(angle);
+	drawnAngle = angle.roundToInt();
 	curAnimFrame = FirstAnimFrame = LastAnimFrame = ((10-drawnAngle) % 8) + 2;
 }
 
@@ -37,7 +37,7 @@ WORClass::WORClass(Stream& stream) : BuilderClass(stream)
 void WORClass::init()
 {
     itemID = Structure_WOR;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
@@ -51,7 +51,7 @@ WallClass::WallClass(Stream& stream) : StructureClass(stream)
 
 void WallClass::init() {
     itemID = Structure_Wall;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 1;
 	structureSize.y = 1;
@@ -180,17 +180,17 @@ void WallClass::fixWall() {
     int maketile = Wall_LeftRight;
 
     // Walls
-    bool up = (currentGameMap->cellExists(i, j-1) && (currentGameMap->cell[i][j-1].hasAGroundObject()
-                && (currentGameMap->cell[i][j-1].getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedUp;
+    bool up = (currentGameMap->cellExists(i, j-1) && (currentGameMap->getCell(i, j-1)->hasAGroundObject()
+                && (currentGameMap->getCell(i, j-1)->getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedUp;
 
-    bool right = (currentGameMap->cellExists(i+1, j) && (currentGameMap->cell[i+1][j].hasAGroundObject()
-                && (currentGameMap->cell[i+1][j].getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedRight;
+    bool right = (currentGameMap->cellExists(i+1, j) && (currentGameMap->getCell(i+1, j)->hasAGroundObject()
+                && (currentGameMap->getCell(i+1, j)->getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedRight;
 
-    bool down = (currentGameMap->cellExists(i, j+1) && (currentGameMap->cell[i][j+1].hasAGroundObject()
-                && (currentGameMap->cell[i][j+1].getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedDown;
+    bool down = (currentGameMap->cellExists(i, j+1) && (currentGameMap->getCell(i, j+1)->hasAGroundObject()
+                && (currentGameMap->getCell(i, j+1)->getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedDown;
 
-    bool left = (currentGameMap->cellExists(i-1, j) && (currentGameMap->cell[i-1][j].hasAGroundObject()
-                && (currentGameMap->cell[i-1][j].getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedLeft;
+    bool left = (currentGameMap->cellExists(i-1, j) && (currentGameMap->getCell(i-1, j)->hasAGroundObject()
+                && (currentGameMap->getCell(i-1, j)->getGroundObject()->getItemID() == Structure_Wall))) || bWallDestroyedLeft;
 
     // calculate destroyed tile index
     int destroyedTileIndex = 0;
@@ -37,7 +37,7 @@ WindTrapClass::WindTrapClass(Stream& stream) : StructureClass(stream) {
 
 void WindTrapClass::init() {
 	itemID = Structure_WindTrap;
-	owner->incrementStructures(itemID);
+	owner->incrementStructures(itemID, this);
 
 	structureSize.x = 2;
 	structureSize.y = 2;
@@ -62,7 +62,7 @@ ObjectInterface* WindTrapClass::GetInterfaceContainer() {
 	}
 }
 
-void WindTrapClass::setHealth(double newHealth) {
+void WindTrapClass::setHealth(FixPoint newHealth) {
     int producedPowerBefore = getProducedPower();
     StructureClass::setHealth(newHealth);
     int producedPowerAfterwards = getProducedPower();
@@ -74,6 +74,6 @@ int WindTrapClass::getProducedPower()
 {
     int windTrapProducedPower = abs(currentGame->objectData.data[Structure_WindTrap].power);
 
-    double ratio = getHealth() / ((double) getMaxHealth());
-    return lround(ratio * windTrapProducedPower);
+    FixPoint ratio = getHealth() / getMaxHealth();
+    return (ratio * windTrapProducedPower).roundToInt();
 }
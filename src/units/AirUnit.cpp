@@ -60,7 +60,7 @@ void AirUnit::save(Stream& stream) const
 void AirUnit::destroy()
 {
     if(isVisible()) {
-        Coord position((short) realX, (short) realY);
+        Coord position(realX.toInt(), realY.toInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_Medium2, position, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
@@ -73,7 +73,7 @@ void AirUnit::destroy()
 void AirUnit::assignToMap(const Coord& pos)
 {
 	if(currentGameMap->cellExists(pos)) {
-		currentGameMap->cell[pos.x][pos.y].assignAirUnit(getObjectID());
+		currentGameMap->getCell(pos.x, pos.y)->assignAirUnit(getObjectID());
 //		currentGameMap->viewMap(owner->getTeam(), location, getViewRange());
 	}
 }
@@ -90,7 +90,7 @@ void AirUnit::blitToScreen()
 	dest.w = source.w = imageW;
 	dest.h = source.h = imageH;
 
-    if( screenborder->isInsideScreen(Coord((int) getRealX() + 1, (int) getRealY() + 3),Coord(getImageW(), getImageH())) == true) {
+    if( screenborder->isInsideScreen(Coord(getRealX().toInt() + 1, getRealY().toInt() + 3),Coord(getImageW(), getImageH())) == true) {
 		// Not out of screen
         if(drawnAngle > 7) {
             fprintf(stderr,"Invalid drawnAngle(%d)\n", drawnAngle);
@@ -44,7 +44,7 @@ Carryall::Carryall(House* newOwner) : AirUnit(newOwner)
     droppedOffCargo = false;
     respondable = false;
 
-    currentMaxSpeed = 0.5;
+    currentMaxSpeed = FixPoint::fromFraction(1, 2);
 
 	curFlyPoint = 0;
 	for(int i=0; i < 8; i++) {
@@ -72,7 +72,7 @@ Carryall::Carryall(Stream& stream) : AirUnit(stream)
 	aDropOfferer = stream.readBool();
 	droppedOffCargo = stream.readBool();
 
-	currentMaxSpeed = stream.readDouble();
+	currentMaxSpeed = stream.readFixPoint();
 
 	curFlyPoint = stream.readUint8();
 	for(int i=0; i < 8; i++) {
@@ -117,7 +117,7 @@ void Carryall::save(Stream& stream) const
 	stream.writeBool(aDropOfferer);
 	stream.writeBool(droppedOffCargo);
 
-	stream.writeDouble(currentMaxSpeed);
+	stream.writeFixPoint(currentMaxSpeed);
 
 	stream.writeUint8(curFlyPoint);
 	for(int i=0; i < 8; i++) {
@@ -134,14 +134,14 @@ bool Carryall::update() {
         return false;
     }
 
-    double dist = distance_from(location.x*BLOCKSIZE + BLOCKSIZE/2, location.y*BLOCKSIZE + BLOCKSIZE/2,
+    FixPoint dist = distance_from(location.x*BLOCKSIZE + BLOCKSIZE/2, location.y*BLOCKSIZE + BLOCKSIZE/2,
                                 destination.x*BLOCKSIZE + BLOCKSIZE/2, destination.y*BLOCKSIZE + BLOCKSIZE/2);
 
-    if((target || hasCargo()) && dist < 64.0) {
-        currentMaxSpeed = (((0.5 - currentGame->objectData.data[itemID].maxspeed)/64.0) * (64.0 - dist)) + currentGame->objectData.data[itemID].maxspeed;
+    if((target || hasCargo()) && dist < 64) {
+        currentMaxSpeed = (((FixPoint::fromFraction(1, 2) - currentGame->objectData.data[itemID].maxspeed)/64) * (64 - dist)) + currentGame->objectData.data[itemID].maxspeed;
         setSpeeds();
     } else {
-        currentMaxSpeed = std::min(currentMaxSpeed + 0.05, currentGame->objectData.data[itemID].maxspeed);
+        currentMaxSpeed = std::min(currentMaxSpeed + FixPoint::fromFraction(1, 20), currentGame->objectData.data[itemID].maxspeed);
         setSpeeds();
     }
 
@@ -161,7 +161,7 @@ bool Carryall::update() {
 	return true;
 }
 
-double Carryall::getMaxSpeed() const {
+FixPoint Carryall::getMaxSpeed() const {
     return currentMaxSpeed;
 }
 
@@ -183,9 +183,9 @@ void Carryall::checkPos()
                 // find next place to drop
                 for(int i=8;i<18;i++) {
                     int r = currentGame->RandomGen.rand(3,i/2);
-                    double angle = 2*M_PI*currentGame->RandomGen.randDouble();
+                    FixPoint angle = FixPoint::fromRaw(currentGame->RandomGen.rand(0, 256*FixPoint::ONE - 1));
 
-                    Coord dropCoord = location + Coord( (int) (r*sin(angle)), (int) (-r*cos(angle)));
+                    Coord dropCoord = location + Coord( (r*FixPoint::sin(angle)).toInt(), (-r*FixPoint::cos(angle)).toInt());
                     if(currentGameMap->cellExists(dropCoord) && currentGameMap->getCell(dropCoord)->hasAGroundObject() == false) {
                         setDestination(dropCoord);
                         break;
@@ -256,7 +256,7 @@ void Carryall::deployUnit(Uint32 UnitID)
 		return;
 
 	if (found) {
-	    currentMaxSpeed = 0.0;
+	    currentMaxSpeed = 0;
 	    setSpeeds();
 
 	    if (currentGameMap->getCell(location)->hasANonInfantryGroundObject()) {
@@ -319,7 +319,7 @@ void Carryall::destroy()
 	// place wreck
     if(isVisible() && currentGameMap->cellExists(location)) {
         TerrainClass* pTerrain = currentGameMap->getCell(location);
-        pTerrain->assignDeadUnit(DeadUnit_Carrall, owner->getHouseID(), Coord((Sint32) realX, (Sint32) realY));
+        pTerrain->assignDeadUnit(DeadUnit_Carrall, owner->getHouseID(), Coord(realX.toInt(), realY.toInt()));
     }
 
 	AirUnit::destroy();
@@ -350,12 +350,12 @@ void Carryall::engageTarget()
             targetLocation = target.getObjPointer()->getClosestPoint(location);
 		}
 		Coord realLocation, realDestination;
-		realLocation.x = lround(realX);
-		realLocation.y = lround(realY);
+		realLocation.x = realX.roundToInt();
+		realLocation.y = realY.roundToInt();
 		realDestination.x = targetLocation.x * BLOCKSIZE + BLOCKSIZE/2;
 		realDestination.y = targetLocation.y * BLOCKSIZE + BLOCKSIZE/2;
 
-		targetAngle = lround((double)NUM_ANGLES*dest_angle(location, destination)/256.0);
+		targetAngle = (dest_angle(location, destination)*NUM_ANGLES/256).roundToInt();
 		if (targetAngle == 8) {
 			targetAngle = 0;
 		}
@@ -439,7 +439,7 @@ void Carryall::DoSetDeployStructure(Uint32 TargetObjectID) {
 
 void Carryall::pickupTarget()
 {
-    currentMaxSpeed = 0.0;
+    currentMaxSpeed = 0;
     setSpeeds();
 
 	if(target.getObjPointer()->isAGroundUnit()) {
@@ -529,14 +529,14 @@ void Carryall::turn()
 		if(wantedAngle != -1) {
 			if(justStoppedMoving) {
 				angle = wantedAngle;
-				drawnAngle = lround(angle);
+				drawnAngle = angle.roundToInt();
 			} else {
-				double	angleLeft = 0,
+				FixPoint	angleLeft = 0,
 						angleRight = 0;
 
 				if(angle > wantedAngle)	{
 					angleRight = angle - wantedAngle;
-					angleLeft = fabs(8-angle)+wantedAngle;
+					angleLeft = FixPoint::abs(8-angle)+wantedAngle;
 				} else if (angle < wantedAngle)	{
 					angleRight = abs(8-wantedAngle) + angle;
 					angleLeft = wantedAngle - angle;
@@ -561,14 +561,14 @@ void Carryall::findConstYard()
     double	closestYardDistance = 1000000;
     ConstructionYardClass* bestYard = NULL;
 
-    RobustList<StructureClass*>::const_iterator iter;
+    IntrusiveList<StructureClass>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureClass* tempStructure = *iter;
 
         if((tempStructure->getItemID() == Structure_ConstructionYard) && (tempStructure->getOwner() == owner)) {
             ConstructionYardClass* tempYard = ((ConstructionYardClass*) tempStructure);
             Coord closestPoint = tempYard->getClosestPoint(location);
-            double tempDistance = distance_from(location, closestPoint);
+            double tempDistance = distance_from(location, closestPoint).toDouble();
 
             if(tempDistance < closestYardDistance) {
                 closestYardDistance = tempDistance;
@@ -106,7 +106,7 @@ void DevastatorClass::blitToScreen()
     dest.y = getDrawnY() + devastatorTurretOffset[drawnAngle].y;
     SDL_BlitSurface(turretGraphic, &source, screen, &dest);	//blit turret
     if (isBadlyDamaged())
-        drawSmoke(screenborder->world2screenX(realX), screenborder->world2screenY(realY));
+        drawSmoke(screenborder->world2screenX(realX.toInt()), screenborder->world2screenY(realY.toInt()));
 }
 
 void DevastatorClass::HandleStartDevastateClick() {
@@ -124,7 +124,7 @@ void DevastatorClass::destroy()
     if(currentGameMap->cellExists(location) && isVisible()) {
         for(int i = 0; i < 3; i++) {
             for(int j = 0; j < 3; j++) {
-                Coord realPos((short)realX + (i - 1)*BLOCKSIZE, (short)realY + (j - 1)*BLOCKSIZE);
+                Coord realPos(realX.toInt() + (i - 1)*BLOCKSIZE, realY.toInt() + (j - 1)*BLOCKSIZE);
 
                 currentGameMap->damage(objectID, owner, realPos, itemID, 150, 16, false);
 
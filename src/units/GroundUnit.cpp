@@ -63,7 +63,7 @@ void GroundUnit::save(Stream& stream) const
 void GroundUnit::assignToMap(const Coord& pos)
 {
 	if (currentGameMap->cellExists(pos)) {
-		currentGameMap->cell[pos.x][pos.y].assignNonInfantryGroundObject(getObjectID());
+		currentGameMap->getCell(pos.x, pos.y)->assignNonInfantryGroundObject(getObjectID());
 		currentGameMap->viewMap(owner->getTeam(), location, getViewRange());
 	}
 }
@@ -81,7 +81,7 @@ void GroundUnit::checkPos()
 		//findTargetTimer = 0;	//allow a scan for new targets now
 
 		if(currentGameMap->getCell(location)->isSpiceBloom()) {
-		    setHealth(0.0);
+		    setHealth(0);
 			currentGameMap->getCell(location)->triggerSpiceBloom(getOwner());
 		} else if(currentGameMap->getCell(location)->isSpecialBloom()){
             currentGameMap->getCell(location)->triggerSpecialBloom(getOwner());
@@ -96,10 +96,10 @@ void GroundUnit::checkPos()
             pathList.clear();
 	    } else {
             Coord closestPoint = target.getObjPointer()->getClosestPoint(location);
-            if ((moving == false) && (blockDistance(location, closestPoint) <= 1.5)
+            if ((moving == false) && (blockDistance(location, closestPoint) <= FixPoint::fromFraction(3, 2))
                 && ((RepairYardClass*)target.getObjPointer())->isFree())
             {
-                if (getHealth()*100.0/getMaxHealth() < 100.0) {
+                if (getHealth() < getMaxHealth()) {
                     setGettingRepaired();
                 } else {
                     setTarget(NULL);
@@ -123,7 +123,7 @@ bool GroundUnit::requestCarryall()
 	if (getOwner()->hasCarryalls())	{
 		Carryall* carryall = NULL;
 
-        RobustList<UnitClass*>::const_iterator iter;
+        IntrusiveList<UnitClass>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 			UnitClass* unit = *iter;
 			if ((unit->getOwner() == owner) && (unit->getItemID() == Unit_Carryall)) {
@@ -190,7 +190,7 @@ void GroundUnit::DoRepair()
 		double	closestLeastBookedRepairYardDistance = 1000000;
         RepairYardClass* bestRepairYard = NULL;
 
-        RobustList<StructureClass*>::const_iterator iter;
+        IntrusiveList<StructureClass>::const_iterator iter;
         for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
             StructureClass* tempStructure = *iter;
 
@@ -198,7 +198,7 @@ void GroundUnit::DoRepair()
                 RepairYardClass* tempRepairYard = ((RepairYardClass*)tempStructure);
 
                 if(tempRepairYard->getNumBookings() == 0) {
-                    double tempDistance = distance_from(location, tempRepairYard->getClosestPoint(location));
+                    double tempDistance = distance_from(location, tempRepairYard->getClosestPoint(location)).toDouble();
 					if(tempDistance < closestLeastBookedRepairYardDistance) {
                         closestLeastBookedRepairYardDistance = tempDistance;
                         bestRepairYard = tempRepairYard;
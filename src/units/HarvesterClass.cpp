@@ -38,7 +38,7 @@
 #define RANDOMHARVESTMOVE 500
 
 /* how fast is spice extracted */
-#define HARVESTEREXTRACTSPEED 0.5
+#define HARVESTEREXTRACTSPEED FixPoint::fromFraction(1, 2)
 
 Coord	harvesterSandOffset[] =
 {
@@ -72,7 +72,7 @@ HarvesterClass::HarvesterClass(Stream& stream) : TrackedUnit(stream)
 
 	harvestingMode = stream.readBool();
 	returningToRefinery = stream.readBool();
-    spice = stream.readDouble();
+    spice = stream.readFixPoint();
     spiceCheckCounter = stream.readUint32();
 }
 
@@ -100,7 +100,7 @@ void HarvesterClass::save(Stream& stream) const
 	TrackedUnit::save(stream);
 	stream.writeBool(harvestingMode);
 	stream.writeBool(returningToRefinery);
-    stream.writeDouble(spice);
+    stream.writeFixPoint(spice);
     stream.writeUint32(spiceCheckCounter);
 }
 
@@ -139,7 +139,7 @@ void HarvesterClass::blitToScreen()
     }
 
     if(isBadlyDamaged())
-        drawSmoke(screenborder->world2screenX(realX), screenborder->world2screenY(realY));
+        drawSmoke(screenborder->world2screenX(realX.toInt()), screenborder->world2screenY(realY.toInt()));
 }
 
 void HarvesterClass::checkPos()
@@ -155,7 +155,7 @@ void HarvesterClass::checkPos()
 			if (target && (target.getObjPointer() != NULL) && (target.getObjPointer()->getItemID() == Structure_Refinery)) {
 				//find a refinery to return to
 				Coord closestPoint = target.getObjPointer()->getClosestPoint(location);
-				if(moving == false && blockDistance(location, closestPoint) <= 1.5)	{
+				if(moving == false && blockDistance(location, closestPoint) <= FixPoint::fromFraction(3, 2))	{
 					awaitingPickup = false;
 					if (((RefineryClass*)target.getObjPointer())->isFree())
 						setReturned();
@@ -167,14 +167,14 @@ void HarvesterClass::checkPos()
 				double	closestLeastBookedRefineryDistance = 1000000;
 				RefineryClass	*bestRefinery = NULL;
 
-                RobustList<StructureClass*>::const_iterator iter;
+                IntrusiveList<StructureClass>::const_iterator iter;
                 for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 					StructureClass* tempStructure = *iter;
 
 					if((tempStructure->getItemID() == Structure_Refinery) && (tempStructure->getOwner() == owner)) {
 						RefineryClass* tempRefinery = static_cast<RefineryClass*>(tempStructure);
 						Coord closestPoint = tempRefinery->getClosestPoint(location);
-						double tempDistance = distance_from(location, closestPoint);
+						double tempDistance = distance_from(location, closestPoint).toDouble();
 						int tempNumBookings = tempRefinery->getNumBookings();
 
 						if (tempNumBookings < leastNumBookings)	{
@@ -196,7 +196,7 @@ void HarvesterClass::checkPos()
 					bestRefinery->startAnimate();
 				}
 			}
-		} else if (harvestingMode && !hasBookedCarrier() && (blockDistance(location, destination) > 10.0)) {
+		} else if (harvestingMode && !hasBookedCarrier() && (blockDistance(location, destination) > 10)) {
 			requestCarryall();
         } else if(respondable && !harvestingMode && attackMode != STOP) {
             if(spiceCheckCounter == 0) {
@@ -236,7 +236,7 @@ void HarvesterClass::destroy()
         int ypos = location.y;
 
         if(currentGameMap->cellExists(xpos,ypos)) {
-            double spiceSpreaded = 0.75 * spice;
+            FixPoint spiceSpreaded = spice * 3 / 4;
             int availableSandPos = 0;
 
             /* how many regions have sand */
@@ -270,7 +270,7 @@ void HarvesterClass::destroy()
 
         setTarget(NULL);
 
-        Coord realPos((short)realX, (short)realY);
+        Coord realPos(realX.toInt(), realY.toInt());
         Uint32 explosionID = currentGame->RandomGen.getRandOf(2,Explosion_Medium1, Explosion_Medium2);
         currentGame->getExplosionList().push_back(new Explosion(explosionID, realPos, owner->getHouseID()));
 
@@ -296,13 +296,13 @@ void HarvesterClass::drawSelectionBox()
 	dest.x = getDrawnX() + imageW/2 - selectionBox->w/2;
 	dest.y = getDrawnY() + imageH/2 - selectionBox->h/2;
 
-	drawhline(screen, dest.x+1, dest.y-1, dest.x+1 + ((int)((getHealth()/(double)getMaxHealth())*(selectionBox->w-3))), getHealthColor());
+	drawhline(screen, dest.x+1, dest.y-1, dest.x+1 + ((int)((getHealth().toDouble()/getMaxHealth())*(selectionBox->w-3))), getHealthColor());
 
-	if ((getOwner() == pLocalHouse) && (spice > 0.0))
+	if ((getOwner() == pLocalHouse) && (spice > 0))
 	{
 		dest.x = getDrawnX() + imageW/2 - selectionBox->w/2;
 		dest.y = getDrawnY() + imageH/2 - selectionBox->h/2;
-		drawhline(screen, dest.x+1, dest.y-2, dest.x+1 + ((int)((((double)spice)/HARVESTERMAXSPICE)*(selectionBox->w-3))), COLOR_ORANGE);
+		drawhline(screen, dest.x+1, dest.y-2, dest.x+1 + ((int)((spice.toDouble()/HARVESTERMAXSPICE)*(selectionBox->w-3))), COLOR_ORANGE);
 
 		//want it to start in one from edges		finish one from right edge
 	}
@@ -325,7 +325,7 @@ void HarvesterClass::harvesterReturn()
 	harvestingMode = false;
 }
 
-void HarvesterClass::setAmountOfSpice(double newSpice)
+void HarvesterClass::setAmountOfSpice(FixPoint newSpice)
 {
 	if ((newSpice >=0) && (newSpice <= HARVESTERMAXSPICE))
 		spice = newSpice;
@@ -335,7 +335,7 @@ void HarvesterClass::setDestination(int newX, int newY)
 {
 	ObjectClass::setDestination(newX, newY);
 
-	harvestingMode =  (attackMode != STOP) && (currentGameMap->cellExists(newX, newY) && currentGameMap->cell[newX][newY].hasSpice());
+	harvestingMode =  (attackMode != STOP) && (currentGameMap->cellExists(newX, newY) && currentGameMap->getCell(newX, newY)->hasSpice());
 }
 
 void HarvesterClass::setTarget(ObjectClass* newTarget)
@@ -384,17 +384,17 @@ void HarvesterClass::move()
 	if(active && !moving) {
 		if(harvestingMode) {
 			//every now and then move around whilst harvesting
-			if(!forced && currentGameMap->cell[location.x][location.y].hasSpice() && (currentGame->RandomGen.rand(0, RANDOMHARVESTMOVE) == 0)) {
+			if(!forced && currentGameMap->getCell(location.x, location.y)->hasSpice() && (currentGame->RandomGen.rand(0, RANDOMHARVESTMOVE) == 0)) {
 				currentGameMap->findSpice(&destination, &location);
 				DoMove2Pos(destination, false);
 			}
 
 			if(location == destination) {
 				if(spice < HARVESTERMAXSPICE) {
-					if(currentGameMap->cell[location.x][location.y].hasSpice()) {
-						spice += currentGameMap->cell[location.x][location.y].harvestSpice();
+					if(currentGameMap->getCell(location.x, location.y)->hasSpice()) {
+						spice += currentGameMap->getCell(location.x, location.y)->harvestSpice();
 
-						if(!currentGameMap->cell[location.x][location.y].hasSpice()) {
+						if(!currentGameMap->getCell(location.x, location.y)->hasSpice()) {
 							currentGameMap->removeSpice(location);
 						}
 					} else if (!currentGameMap->findSpice(&destination, &location)) {
@@ -411,7 +411,7 @@ void HarvesterClass::move()
 }
 
 bool HarvesterClass::isHarvesting() const {
-    return harvestingMode && (blockDistance(location, destination) <= DIAGONALCOST) && currentGameMap->cellExists(location) && currentGameMap->getCell(location)->hasSpice();
+    return harvestingMode && (blockDistance(location, destination) <= FIX_DIAGONALCOST) && currentGameMap->cellExists(location) && currentGameMap->getCell(location)->hasSpice();
 }
 
 bool HarvesterClass::canAttack(const ObjectClass* object) const
@@ -422,9 +422,9 @@ bool HarvesterClass::canAttack(const ObjectClass* object) const
 			&& object->isVisible(getOwner()->getTeam()));
 }
 
-double HarvesterClass::extractSpice()
+FixPoint HarvesterClass::extractSpice()
 {
-	double oldSpice = spice;
+	FixPoint oldSpice = spice;
 
 	if((spice - HARVESTEREXTRACTSPEED) >= 0) {
 		spice -= HARVESTEREXTRACTSPEED;
@@ -22,6 +22,7 @@
 #include <House.h>
 #include <Game.h>
 #include <MapClass.h>
+#include <ObjectGrid.h>
 #include <SoundPlayer.h>
 
 #include <structures/StructureClass.h>
@@ -70,9 +71,9 @@ void InfantryClass::save(Stream& stream) const
 void InfantryClass::HandleCaptureClick(int xPos, int yPos) {
 	if(respondable && ((getItemID() == Unit_Fremen) || (getItemID() == Unit_Sardaukar) || (getItemID() == Unit_Soldier) || (getItemID() == Unit_Trooper))) {
 		if (currentGameMap->cellExists(xPos, yPos)) {
-			if (currentGameMap->cell[xPos][yPos].hasAnObject()) {
+			if (currentGameMap->getCell(xPos, yPos)->hasAnObject()) {
 				// capture structure
-				ObjectClass* tempTarget = currentGameMap->cell[xPos][yPos].getObject();
+				ObjectClass* tempTarget = currentGameMap->getCell(xPos, yPos)->getObject();
 
 				currentGame->GetCommandManager().addCommand(Command(CMD_INFANTRY_CAPTURE,objectID,tempTarget->getObjectID()));
 			}
@@ -97,7 +98,7 @@ void InfantryClass::assignToMap(const Coord& pos)
 {
 	if(currentGameMap->cellExists(pos)) {
 		oldCellPosition = cellPosition;
-		cellPosition = currentGameMap->cell[pos.x][pos.y].assignInfantry(getObjectID());
+		cellPosition = currentGameMap->getCell(pos.x, pos.y)->assignInfantry(getObjectID());
 	}
 }
 
@@ -193,7 +194,7 @@ void InfantryClass::checkPos()
 
             closestPoint = target.getObjPointer()->getClosestPoint(location);
 
-            if(blockDistance(location, closestPoint) <= 0.5) {
+            if(blockDistance(location, closestPoint) <= FixPoint::fromFraction(1, 2)) {
                 StructureClass* pCapturedStructure = target.getStructurePointer();
                 if(pCapturedStructure->getHealthColor() == COLOR_RED) {
                     House* pOwner = pCapturedStructure->getOwner();
@@ -201,17 +202,17 @@ void InfantryClass::checkPos()
                     int posX = pCapturedStructure->getX();
                     int posY = pCapturedStructure->getY();
                     int origHouse = pCapturedStructure->getOriginalHouse();
-                    int oldHealth = pCapturedStructure->getHealth();
+                    FixPoint oldHealth = pCapturedStructure->getHealth();
                     bool isSelected = pCapturedStructure->isSelected();
 
-                    double capturedSpice = 0.0;
+                    FixPoint capturedSpice = 0;
 
                     UnitClass* pContainedUnit = NULL;
 
                     if(pCapturedStructure->getItemID() == Structure_Silo) {
-                        capturedSpice = currentGame->objectData.data[Structure_Silo].capacity * (pOwner->getStoredCredits() / pOwner->getCapacity());
+                        capturedSpice = FixPoint::fromFraction(currentGame->objectData.data[Structure_Silo].capacity * lround(pOwner->getStoredCredits()), pOwner->getCapacity());
                     } else if(pCapturedStructure->getItemID() == Structure_Refinery) {
-                        capturedSpice = currentGame->objectData.data[Structure_Silo].capacity * (pOwner->getStoredCredits() / pOwner->getCapacity());
+                        capturedSpice = FixPoint::fromFraction(currentGame->objectData.data[Structure_Silo].capacity * lround(pOwner->getStoredCredits()), pOwner->getCapacity());
                         RefineryClass* pRefinery = dynamic_cast<RefineryClass*>(pCapturedStructure);
                         if(pRefinery->isFree() == false) {
                             pContainedUnit = pRefinery->getHarvester();
@@ -224,8 +225,8 @@ void InfantryClass::checkPos()
                     }
 
                     Uint32 containedUnitID = NONE;
-                    double containedUnitHealth = 0.0;
-                    double containedHarvesterSpice = 0.0;
+                    FixPoint containedUnitHealth = 0;
+                    FixPoint containedHarvesterSpice = 0;
                     if(pContainedUnit != NULL) {
                         containedUnitID = pContainedUnit->getItemID();
                         containedUnitHealth = pContainedUnit->getHealth();
@@ -302,17 +303,17 @@ void InfantryClass::checkPos()
                 }
                 // destroy unit indirectly
                 setTarget(NULL);
-                setHealth(0.0);
+                setHealth(0);
                 return;
             }
         } else if(target.getObjPointer() != NULL && target.getObjPointer()->isAStructure())	{
             Coord	closestPoint;
             closestPoint = target.getObjPointer()->getClosestPoint(location);
 
-            if(blockDistance(location, closestPoint) <= 0.5) {
+            if(blockDistance(location, closestPoint) <= FixPoint::fromFraction(1, 2)) {
                 // destroy unit indirectly
                 setTarget(NULL);
-                setHealth(0.0);
+                setHealth(0);
                 return;
             }
         }
@@ -329,7 +330,7 @@ void InfantryClass::destroy()
                 // squashed
                 pTerrain->assignDeadUnit( currentGame->RandomGen.randBool() ? DeadUnit_Infantry_Squashed1 : DeadUnit_Infantry_Squashed2,
                                             owner->getHouseID(),
-                                            Coord((Sint32) realX, (Sint32) realY) );
+                                            Coord(realX.toInt(), realY.toInt()) );
 
                 if(isVisible(getOwner()->getTeam())) {
                     soundPlayer->playSoundAt(Sound_Squashed,location);
@@ -342,7 +343,7 @@ void InfantryClass::destroy()
             // "normal" dead
             pTerrain->assignDeadUnit( DeadUnit_Infantry,
                                         owner->getHouseID(),
-                                        Coord((Sint32) realX, (Sint32) realY));
+                                        Coord(realX.toInt(), realY.toInt()));
 
             if(isVisible(getOwner()->getTeam()))
                 soundPlayer->playSoundAt((Sound_enum) getRandomOf(5,Sound_Scream1,Sound_Scream2,Sound_Scream3,Sound_Scream4,Sound_Scream5),location);
@@ -396,16 +397,17 @@ void InfantryClass::move()
         // check if vehicle is on the first half of the way
 		if(location != nextSpot) {
 		    // check if vehicle is half way out of old cell
-            if ((abs(location.x*BLOCKSIZE - (int)realX + BLOCKSIZE/2) >= BLOCKSIZE/2)
-                || (abs(location.y*BLOCKSIZE - (int)realY + BLOCKSIZE/2) >= BLOCKSIZE/2))
+            if ((abs(location.x*BLOCKSIZE - realX.toInt() + BLOCKSIZE/2) >= BLOCKSIZE/2)
+                || (abs(location.y*BLOCKSIZE - realY.toInt() + BLOCKSIZE/2) >= BLOCKSIZE/2))
             {
                 unassignFromMap(location);	//let something else go in
                 oldLocation = location;
                 location = nextSpot;
+                currentGameMap->getObjectGrid()->update(this);
 		    }
 		}
 
-		if((fabs((double)wantedReal.x - realX) <= 0.2) && (fabs((double)wantedReal.y - realY) <= 0.2)) {
+		if((FixPoint::abs(wantedReal.x - realX) <= FixPoint::fromFraction(1, 5)) && (FixPoint::abs(wantedReal.y - realY) <= FixPoint::fromFraction(1, 5))) {
 			realX = wantedReal.x;
 			realY = wantedReal.y;
 
@@ -499,9 +501,15 @@ void InfantryClass::setSpeeds()
 		dx -= sx;
 		dy -= sy;
 
-		double scale = currentGame->objectData.data[itemID].maxspeed/sqrt((double)(dx*dx + dy*dy));
-		xSpeed = dx*scale;
-		ySpeed = dy*scale;
+		FixPoint length = FixPoint::hypot(dx, dy);
+		if(length > 0) {
+			FixPoint scale = currentGame->objectData.data[itemID].maxspeed/length;
+			xSpeed = dx*scale;
+			ySpeed = dy*scale;
+		} else {
+			xSpeed = 0;
+			ySpeed = 0;
+		}
 	}
 }
 
@@ -89,12 +89,12 @@ void LauncherClass::blitToScreen()
     dest.y = getDrawnY() + TurretOffset[drawnAngle].y;
     SDL_BlitSurface(turretGraphic, &source, screen, &dest);	//blit turret
     if(isBadlyDamaged())
-        drawSmoke(screenborder->world2screenX(realX), screenborder->world2screenY(realY));
+        drawSmoke(screenborder->world2screenX(realX.toInt()), screenborder->world2screenY(realY.toInt()));
 }
 
 void LauncherClass::destroy() {
     if(currentGameMap->cellExists(location) && isVisible()) {
-        Coord realPos((short)realX, (short)realY);
+        Coord realPos(realX.toInt(), realY.toInt());
         Uint32 explosionID = currentGame->RandomGen.getRandOf(3,Explosion_Medium1, Explosion_Medium2,Explosion_Flames);
         currentGame->getExplosionList().push_back(new Explosion(explosionID, realPos, owner->getHouseID()));
 
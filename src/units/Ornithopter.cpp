@@ -82,7 +82,7 @@ void Ornithopter::destroy()
 	// place wreck
     if(currentGameMap->cellExists(location)) {
         TerrainClass* pTerrain = currentGameMap->getCell(location);
-        pTerrain->assignDeadUnit(DeadUnit_Ornithopter, owner->getHouseID(), Coord((Sint32) realX, (Sint32) realY));
+        pTerrain->assignDeadUnit(DeadUnit_Ornithopter, owner->getHouseID(), Coord(realX.toInt(), realY.toInt()));
     }
 
 	AirUnit::destroy();
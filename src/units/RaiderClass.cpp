@@ -60,7 +60,7 @@ RaiderClass::~RaiderClass()
 
 void RaiderClass::destroy() {
     if(currentGameMap->cellExists(location) && isVisible()) {
-        Coord realPos((short)realX, (short)realY);
+        Coord realPos(realX.toInt(), realY.toInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_SmallUnit, realPos, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
@@ -97,7 +97,7 @@ bool Saboteur::update() {
 				closestPoint = target.getObjPointer()->getClosestPoint(location);
 
 
-				if(blockDistance(location, closestPoint) <= 1.5)	{
+				if(blockDistance(location, closestPoint) <= FixPoint::fromFraction(3, 2))	{
 				    ObjectClass* pObject = target.getObjPointer();
 				    destroy();
 					pObject->destroy();
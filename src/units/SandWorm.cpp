@@ -98,7 +98,7 @@ void Sandworm::save(Stream& stream) const
 void Sandworm::assignToMap(const Coord& pos)
 {
 	if(currentGameMap->cellExists(pos)) {
-		currentGameMap->cell[pos.x][pos.y].assignUndergroundUnit(getObjectID());
+		currentGameMap->getCell(pos.x, pos.y)->assignUndergroundUnit(getObjectID());
 		// do not unhide map cause this would give fremen players an advantage
 		// currentGameMap->viewMap(owner->getTeam(), location, getViewRange());
 	}
@@ -221,13 +221,13 @@ void Sandworm::blitToScreen()
 void Sandworm::checkPos()
 {
 	if(moving) {
-		if((abs((short)realX - lastLocs[0].x) >= 1) || (abs((short)realY - lastLocs[0].y) >= 1)) {
+		if((abs(realX.toInt() - lastLocs[0].x) >= 1) || (abs(realY.toInt() - lastLocs[0].y) >= 1)) {
 			for(int i = (SANDWORM_LENGTH-1); i > 0 ; i--) {
 				lastLocs[i] = lastLocs[i-1];
 			}
 
-			lastLocs[0].x = (short)realX;
-			lastLocs[0].y = (short)realY;
+			lastLocs[0].x = realX.toInt();
+			lastLocs[0].y = realY.toInt();
 		}
 	}
 
@@ -297,7 +297,7 @@ void Sandworm::engageTarget()
 			}
 
 			if(target && (target.getObjPointer() != NULL)) {
-				targetAngle = lround(8.0/256.0*dest_angle(location, targetLocation));
+				targetAngle = (dest_angle(location, targetLocation)/32).roundToInt();
 
 				if(targetAngle == 8)
 					targetAngle = 0;
@@ -318,8 +318,8 @@ void Sandworm::setLocation(int xPos, int yPos)
 		UnitClass::setLocation(xPos, yPos);
 
 		for(int i = 0; i < SANDWORM_LENGTH; i++) {
-			lastLocs[i].x = (short)realX;
-			lastLocs[i].y = (short)realY;
+			lastLocs[i].x = realX.toInt();
+			lastLocs[i].y = realY.toInt();
 		}
 	}
 }
@@ -364,7 +364,7 @@ bool Sandworm::update()
                     if(drawnFrame == 1) {
                         //the close mouth bit of graphic
                         bool wasAlive = ( target && target.getObjPointer()->isVisible(getOwner()->getTeam()));	//see if was alive before attack
-                        Coord realPos = Coord((short)realX, (short)realY);
+                        Coord realPos = Coord(realX.toInt(), realY.toInt());
                         currentGameMap->getCell(location)->damageCell(objectID, getOwner(), realPos, Bullet_Sandworm, 5000, NONE, false);
 
                         if(wasAlive && (target.getObjPointer()->isVisible(getOwner()->getTeam()) == false)) {
@@ -438,13 +438,13 @@ ObjectClass* Sandworm::findTarget()
 	if(attackMode == HUNT) {
 	    double closestDistance = 1000000.0;
 
-        RobustList<UnitClass*>::const_iterator iter;
+        IntrusiveList<UnitClass>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 			UnitClass* tempUnit = *iter;
             if (canAttack(tempUnit)
-				&& (blockDistance(location, tempUnit->getLocation()) < closestDistance)) {
+				&& (blockDistance(location, tempUnit->getLocation()).toDouble() < closestDistance)) {
                 closestTarget = tempUnit;
-                closestDistance = blockDistance(location, tempUnit->getLocation());
+                closestDistance = blockDistance(location, tempUnit->getLocation()).toDouble();
             }
 		}
 	} else {
@@ -92,12 +92,12 @@ void SonicTankClass::blitToScreen()
     dest.y = getDrawnY() + sonicTankTurretOffset[drawnAngle].y;
     SDL_BlitSurface(turretGraphic, &source, screen, &dest);	//blit turret
     if(isBadlyDamaged())
-        drawSmoke(screenborder->world2screenX(realX), screenborder->world2screenY(realY));
+        drawSmoke(screenborder->world2screenX(realX.toInt()), screenborder->world2screenY(realY.toInt()));
 }
 
 void SonicTankClass::destroy() {
     if(currentGameMap->cellExists(location) && isVisible()) {
-        Coord realPos((short)realX, (short)realY);
+        Coord realPos(realX.toInt(), realY.toInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_SmallUnit, realPos, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
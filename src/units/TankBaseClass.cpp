@@ -34,14 +34,14 @@ TankBaseClass::TankBaseClass(House* newOwner) : TrackedUnit(newOwner)
     TankBaseClass::init();
 
     drawnTurretAngle = currentGame->RandomGen.rand(0, 7);
-    turretAngle = (double) drawnTurretAngle;
+    turretAngle = drawnTurretAngle;
 }
 
 TankBaseClass::TankBaseClass(Stream& stream) : TrackedUnit(stream)
 {
     TankBaseClass::init();
 
-	turretAngle = stream.readDouble();
+	turretAngle = stream.readFixPoint();
     drawnTurretAngle = stream.readSint8();
 
 	closeTarget.load(stream);
@@ -50,7 +50,7 @@ TankBaseClass::TankBaseClass(Stream& stream) : TrackedUnit(stream)
 void TankBaseClass::init()
 {
 	turreted = true;
-	turretTurnSpeed = 0.0625;
+	turretTurnSpeed = FixPoint::fromFraction(1, 16);
 	GunGraphicID = -1;
 	turretGraphic = NULL;
 }
@@ -63,7 +63,7 @@ void TankBaseClass::save(Stream& stream) const
 {
 	TrackedUnit::save(stream);
 
-	stream.writeDouble(turretAngle);
+	stream.writeFixPoint(turretAngle);
 	stream.writeSint8(drawnTurretAngle);
 
 	closeTarget.save(stream);
@@ -77,7 +77,7 @@ void TankBaseClass::navigate()
 {
 	if(moving)//change the turret angle so it faces the direction we are moving in
 	{
-		targetAngle = lround(8.0/256.0*dest_angle(location, destination));
+		targetAngle = (dest_angle(location, destination)/32).roundToInt();
 
 		if (targetAngle == 8)
 			targetAngle = 0;
@@ -161,7 +161,7 @@ void TankBaseClass::engageTarget()
 			}
 
 			if(closeTarget) {
-				targetAngle = lround(8.0/256.0*dest_angle(location, targetLocation));
+				targetAngle = (dest_angle(location, targetLocation)/32).roundToInt();
 				if (targetAngle == 8) {
 					targetAngle = 0;
 				}
@@ -188,7 +188,7 @@ void TankBaseClass::targeting()
 				DoAttackObject(target.getObjPointer());
 				pathList.clear();
 				nextSpotFound = false;
-				speedCap = -1.0;
+				speedCap = -1;
 			} else {
 				target.PointTo(NONE);
 
@@ -220,14 +220,14 @@ void TankBaseClass::targeting()
 
 void TankBaseClass::turn()
 {
-	double	angleLeft = 0,
+	FixPoint	angleLeft = 0,
 			angleRight = 0;
 
 	if(!moving) {
 		if(nextSpotAngle != -1) {
 			if(angle > nextSpotAngle) {
 				angleRight = angle - nextSpotAngle;
-				angleLeft = fabs(8-angle) + nextSpotAngle;
+				angleLeft = FixPoint::abs(8-angle) + nextSpotAngle;
 			} else if (angle < nextSpotAngle) {
 				angleRight = abs(8-nextSpotAngle) + angle;
 				angleLeft = nextSpotAngle - angle;
@@ -244,7 +244,7 @@ void TankBaseClass::turn()
 	if(targetAngle != INVALID) {
 		if(turretAngle > targetAngle) {
 			angleRight = turretAngle - targetAngle;
-			angleLeft = fabs(8-turretAngle) + targetAngle;
+			angleLeft = FixPoint::abs(8-turretAngle) + targetAngle;
 		} else if (turretAngle < targetAngle) {
 			angleRight = abs(8-targetAngle) + turretAngle;
 			angleLeft = targetAngle - turretAngle;
@@ -261,21 +261,21 @@ void TankBaseClass::turn()
 void TankBaseClass::turnTurretLeft()
 {
 	turretAngle += turretTurnSpeed;
-	if(turretAngle >= 7.5) {
-	    drawnTurretAngle = lround(turretAngle) - 8;
-        turretAngle -= 8.0;
+	if(turretAngle >= FixPoint::fromFraction(15,2)) {
+	    drawnTurretAngle = turretAngle.roundToInt() - 8;
+        turretAngle -= 8;
 	} else {
-        drawnTurretAngle = lround(turretAngle);
+        drawnTurretAngle = turretAngle.roundToInt();
 	}
 }
 
 void TankBaseClass::turnTurretRight()
 {
 	turretAngle -= turretTurnSpeed;
-	if(turretAngle <= -0.5) {
-	    drawnTurretAngle = lround(turretAngle) + 8;
-		turretAngle += 8.0;
+	if(turretAngle <= -FixPoint::fromFraction(1,2)) {
+	    drawnTurretAngle = turretAngle.roundToInt() + 8;
+		turretAngle += 8;
 	} else {
-	    drawnTurretAngle = lround(turretAngle);
+	    drawnTurretAngle = turretAngle.roundToInt();
 	}
 }
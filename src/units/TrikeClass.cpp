@@ -60,7 +60,7 @@ TrikeClass::~TrikeClass()
 
 void TrikeClass::destroy() {
     if(currentGameMap->cellExists(location) && isVisible()) {
-        Coord realPos((short)realX, (short)realY);
+        Coord realPos(realX.toInt(), realY.toInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_SmallUnit, realPos, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
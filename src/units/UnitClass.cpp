@@ -30,6 +30,9 @@
 #include <misc/draw_util.h>
 
 #include <AStarSearch.h>
+#include <ClusterGraph.h>
+#include <ReachabilityIndex.h>
+#include <ObjectGrid.h>
 
 #include <GUI/ObjectInterfaces/UnitInterface.h>
 
@@ -56,11 +59,11 @@ UnitClass::UnitClass(House* newOwner) : ObjectClass(newOwner)
     moving = false;
     turning = false;
     justStoppedMoving = false;
-	speedCap = -1.0;
-    xSpeed = 0.0;
-    ySpeed = 0.0;
+	speedCap = -1;
+    xSpeed = 0;
+    ySpeed = 0;
 
-    targetDistance = 0.0;
+    targetDistance = 0;
 	targetAngle = INVALID;
 
 	noCloserPointCount = 0;
@@ -93,11 +96,11 @@ UnitClass::UnitClass(Stream& stream) : ObjectClass(stream)
 	moving = stream.readBool();
 	turning = stream.readBool();
 	justStoppedMoving = stream.readBool();
-	speedCap = stream.readDouble();
-	xSpeed = stream.readDouble();
-	ySpeed = stream.readDouble();
+	speedCap = stream.readFixPoint();
+	xSpeed = stream.readFixPoint();
+	ySpeed = stream.readFixPoint();
 
-	targetDistance = stream.readDouble();
+	targetDistance = stream.readFixPoint();
 	targetAngle = stream.readSint8();
 
 	noCloserPointCount = stream.readUint8();
@@ -143,6 +146,7 @@ UnitClass::~UnitClass()
 {
 	pathList.clear();
 	removeFromSelectionLists();
+	unitList.remove(this);
 
 	currentGame->getObjectManager().RemoveObject(objectID);
 }
@@ -161,11 +165,11 @@ void UnitClass::save(Stream& stream) const
 	stream.writeBool(moving);
 	stream.writeBool(turning);
 	stream.writeBool(justStoppedMoving);
-	stream.writeDouble(speedCap);
-	stream.writeDouble(xSpeed);
-	stream.writeDouble(ySpeed);
+	stream.writeFixPoint(speedCap);
+	stream.writeFixPoint(xSpeed);
+	stream.writeFixPoint(ySpeed);
 
-	stream.writeDouble(targetDistance);
+	stream.writeFixPoint(targetDistance);
 	stream.writeSint8(targetAngle);
 
 	stream.writeUint8(noCloserPointCount);
@@ -216,7 +220,7 @@ void UnitClass::attack()
 			if(bAttackPos && getItemID() != Unit_SonicTank && currentGameMap->getCell(destination)->isSpiceBloom()) {
                 setDestination(location);
                 forced = false;
-				speedCap = -1.0;
+				speedCap = -1;
 				bAttackPos = false;
 			}
 		}
@@ -230,7 +234,7 @@ void UnitClass::attack()
             if(bAttackPos && getItemID() != Unit_SonicTank && currentGameMap->getCell(destination)->isSpiceBloom()) {
                 setDestination(location);
                 forced = false;
-				speedCap = -1.0;
+				speedCap = -1;
 				bAttackPos = false;
 			}
 		}
@@ -245,7 +249,7 @@ void UnitClass::blitToScreen()
 	dest.w = source.w = imageW;
 	dest.h = source.h = imageH;
 
-    if( screenborder->isInsideScreen(Coord((int) getRealX(), (int) getRealY()),Coord(getImageW(), getImageH())) == false) {
+    if( screenborder->isInsideScreen(Coord(getRealX().toInt(), getRealY().toInt()),Coord(getImageW(), getImageH())) == false) {
 		// Out of screen
 		return;
 	}
@@ -259,7 +263,7 @@ void UnitClass::blitToScreen()
 
 	SDL_BlitSurface(graphic, &source, screen, &dest);
 	if(isBadlyDamaged()) {
-		drawSmoke(screenborder->world2screenX(realX), screenborder->world2screenY(realY));
+		drawSmoke(screenborder->world2screenX(realX.toInt()), screenborder->world2screenY(realY.toInt()));
 	}
 }
 
@@ -315,6 +319,8 @@ void UnitClass::deviate(House* newOwner)
         nextSpotFound = false;
         DoSetAttackMode(AREAGUARD);
         owner = newOwner;
+        currentGameMap->getObjectGrid()->update(this);
+        currentGameMap->journalRadarChange(location);
 
         graphic = pGFXManager->getObjPic(GraphicID,getOwner()->getHouseID());
         deviationTimer = DEVIATIONTIME;
@@ -334,7 +340,7 @@ void UnitClass::drawSelectionBox()
 
 	dest.x = getDrawnX() + imageW/2 - selectionBox->w/2;
 	dest.y = getDrawnY() + imageH/2 - selectionBox->h/2;
-	drawhline(screen, dest.x+1, dest.y-1, dest.x+1 + ((int)((getHealth()/(double)getMaxHealth())*(selectionBox->w-3))), getHealthColor());
+	drawhline(screen, dest.x+1, dest.y-1, dest.x+1 + ((int)((getHealth().toDouble()/getMaxHealth())*(selectionBox->w-3))), getHealthColor());
 
 }	//want it to start in one from edges		finish one from right edge
 
@@ -382,7 +388,7 @@ void UnitClass::engageTarget()
 
 		targetDistance = blockDistance(location, targetLocation);
 
-		targetAngle = lround(8.0/256.0*dest_angle(location, targetLocation));
+		targetAngle = (dest_angle(location, targetLocation)/32).roundToInt();
 		if (targetAngle == 8)
 			targetAngle = 0;
 
@@ -427,17 +433,18 @@ void UnitClass::move()
 		// check if vehicle is on the first half of the way
 		if(location != nextSpot) {
 		    // check if vehicle is half way out of old cell
-            if ((abs(location.x*BLOCKSIZE - (int)realX + BLOCKSIZE/2) >= BLOCKSIZE/2)
-                || (abs(location.y*BLOCKSIZE - (int)realY + BLOCKSIZE/2) >= BLOCKSIZE/2))
+            if ((abs(location.x*BLOCKSIZE - realX.toInt() + BLOCKSIZE/2) >= BLOCKSIZE/2)
+                || (abs(location.y*BLOCKSIZE - realY.toInt() + BLOCKSIZE/2) >= BLOCKSIZE/2))
             {
                 unassignFromMap(location);	//let something else go in
                 oldLocation = location;
                 location = nextSpot;
+                currentGameMap->getObjectGrid()->update(this);
 		    }
 		} else {
 			// if vehicle is out of old cell
-			if ((abs(oldLocation.x*BLOCKSIZE - (int)realX + BLOCKSIZE/2) >= BLOCKSIZE)
-			|| (abs(oldLocation.y*BLOCKSIZE - (int)realY + BLOCKSIZE/2) >= BLOCKSIZE)) {
+			if ((abs(oldLocation.x*BLOCKSIZE - realX.toInt() + BLOCKSIZE/2) >= BLOCKSIZE)
+			|| (abs(oldLocation.y*BLOCKSIZE - realY.toInt() + BLOCKSIZE/2) >= BLOCKSIZE)) {
 			    //location = nextSpot;
 			    //realX = location.x*BLOCKSIZE + BLOCKSIZE/2;
 			    //realY = location.y*BLOCKSIZE + BLOCKSIZE/2;
@@ -483,7 +490,7 @@ void UnitClass::navigate()
 							}
 							setDestination(location);	//can't get any closer, give up
 							forced = false;
-							speedCap = -1.0;
+							speedCap = -1;
 						}
 					}
 
@@ -528,9 +535,9 @@ void UnitClass::HandleActionClick(int xPos, int yPos)
 {
 	if(respondable) {
 		if (currentGameMap->cellExists(xPos, yPos)) {
-			if (currentGameMap->cell[xPos][yPos].hasAnObject()) {
+			if (currentGameMap->getCell(xPos, yPos)->hasAnObject()) {
  				// attack unit/structure or move to structure
-				ObjectClass* tempTarget = currentGameMap->cell[xPos][yPos].getObject();
+				ObjectClass* tempTarget = currentGameMap->getCell(xPos, yPos)->getObject();
 
 				if(tempTarget->getOwner() != getOwner()) {
 					// attack
@@ -550,9 +557,9 @@ void UnitClass::HandleActionClick(int xPos, int yPos)
 void UnitClass::HandleAttackClick(int xPos, int yPos) {
 	if(respondable) {
 		if (currentGameMap->cellExists(xPos, yPos)) {
-			if (currentGameMap->cell[xPos][yPos].hasAnObject()) {
+			if (currentGameMap->getCell(xPos, yPos)->hasAnObject()) {
 				// attack unit/structure or move to structure
-				ObjectClass* tempTarget = currentGameMap->cell[xPos][yPos].getObject();
+				ObjectClass* tempTarget = currentGameMap->getCell(xPos, yPos)->getObject();
 
 				currentGame->GetCommandManager().addCommand(Command(CMD_UNIT_ATTACKOBJECT,objectID,tempTarget->getObjectID()));
 			} else {
@@ -832,32 +839,32 @@ void UnitClass::setPickedUp(UnitClass* newCarrier)
 	setVisible(VIS_ALL, false);
 }
 
-double UnitClass::getMaxSpeed() const {
+FixPoint UnitClass::getMaxSpeed() const {
     return currentGame->objectData.data[itemID].maxspeed;
 }
 
 void UnitClass::setSpeeds()
 {
-	double speed = getMaxSpeed();
+	FixPoint speed = getMaxSpeed();
 
 	if (!isAFlyingUnit()) {
-		speed += speed*(1.0 - currentGameMap->getCell(location)->getDifficulty());
+		speed += speed*(1 - currentGameMap->getCell(location)->getDifficulty());
 		speed *= HEAVILYDAMAGEDSPEEDMULTIPLIER;
 	}
 
-	if ((speedCap > 0.0) && (speedCap < speed))
+	if ((speedCap > 0) && (speedCap < speed))
 		speed = speedCap;
 
 	switch (drawnAngle)
 	{
 	case (LEFT): xSpeed = -speed; ySpeed = 0; break;
-	case (LEFTUP): xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = xSpeed; break;
+	case (LEFTUP): xSpeed = -speed*FIX_DIAGONALSPEEDCONST; ySpeed = xSpeed; break;
 	case (UP): xSpeed = 0; ySpeed = -speed; break;
-	case (RIGHTUP): xSpeed = speed*DIAGONALSPEEDCONST; ySpeed = -xSpeed; break;
+	case (RIGHTUP): xSpeed = speed*FIX_DIAGONALSPEEDCONST; ySpeed = -xSpeed; break;
 	case (RIGHT): xSpeed = speed; ySpeed = 0; break;
-	case (RIGHTDOWN): xSpeed = speed*DIAGONALSPEEDCONST; ySpeed = xSpeed; break;
+	case (RIGHTDOWN): xSpeed = speed*FIX_DIAGONALSPEEDCONST; ySpeed = xSpeed; break;
 	case (DOWN): xSpeed = 0; ySpeed = speed; break;
-	case (LEFTDOWN): xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = -xSpeed;
+	case (LEFTDOWN): xSpeed = -speed*FIX_DIAGONALSPEEDCONST; ySpeed = -xSpeed;
 	}
 }
 
@@ -892,7 +899,7 @@ void UnitClass::targeting()
 			DoAttackObject(target.getObjPointer());
 			pathList.clear();
 			nextSpotFound = false;
-			speedCap = -1.0;
+			speedCap = -1;
 		} else {
 			target.PointTo(NONE);
 
@@ -921,7 +928,7 @@ void UnitClass::turn()
 	if(!moving) {
 		int wantedAngle;
 		if( (target || bAttackPos)
-		      && (!targetFriendly || forced || (targetDistance < 1.0))
+		      && (!targetFriendly || forced || (targetDistance < 1))
 		      && (targetDistance <= currentGame->objectData.data[itemID].weaponrange)
 		      && (attackMode != CAPTURE) && (goingToRepairYard == false) )
         {
@@ -933,14 +940,14 @@ void UnitClass::turn()
 		if(wantedAngle != -1) {
 			if(justStoppedMoving) {
 				angle = wantedAngle;
-				drawnAngle = lround(angle);
+				drawnAngle = angle.roundToInt();
 			} else {
-				double	angleLeft = 0,
+				FixPoint	angleLeft = 0,
 						angleRight = 0;
 
  				if(angle > wantedAngle) {
 					angleRight = angle - wantedAngle;
-					angleLeft = fabs(8-angle)+wantedAngle;
+					angleLeft = FixPoint::abs(8-angle)+wantedAngle;
 				} else if (angle < wantedAngle) {
 					angleRight = abs(8-wantedAngle) + angle;
 					angleLeft = wantedAngle - angle;
@@ -959,22 +966,22 @@ void UnitClass::turn()
 void UnitClass::turnLeft()
 {
 	angle += currentGame->objectData.data[itemID].turnspeed;
-	if(angle >= 7.5) {
-	    drawnAngle = lround(angle) - 8;
-        angle -= 8.0;
+	if(angle >= FixPoint::fromFraction(15,2)) {
+	    drawnAngle = angle.roundToInt() - 8;
+        angle -= 8;
 	} else {
-        drawnAngle = lround(angle);
+        drawnAngle = angle.roundToInt();
 	}
 }
 
 void UnitClass::turnRight()
 {
 	angle -= currentGame->objectData.data[itemID].turnspeed;
-	if(angle <= -0.5) {
-	    drawnAngle = lround(angle) + 8;
-		angle += 8.0;
+	if(angle <= -FixPoint::fromFraction(1,2)) {
+	    drawnAngle = angle.roundToInt() + 8;
+		angle += 8;
 	} else {
-	    drawnAngle = lround(angle);
+	    drawnAngle = angle.roundToInt();
 	}
 }
 
@@ -986,6 +993,8 @@ void UnitClass::quitDeviation() {
         setGuardPoint(location);
         setDestination(location);
         owner = realOwner;
+        currentGameMap->getObjectGrid()->update(this);
+        currentGameMap->journalRadarChange(location);
         graphic = pGFXManager->getObjPic(GraphicID,getOwner()->getHouseID());
         deviationTimer = INVALID;
     }
@@ -1004,7 +1013,7 @@ bool UnitClass::update()
         }
     }
 
-    if(getHealth() <= 0.0) {
+    if(getHealth() <= 0) {
         destroy();
         return false;
     }
@@ -1033,14 +1042,29 @@ bool UnitClass::canPass(int xPos, int yPos) const
 	return (currentGameMap->cellExists(xPos, yPos) && !currentGameMap->getCell(xPos, yPos)->hasAGroundObject() && !currentGameMap->getCell(xPos, yPos)->isMountain());
 }
 
+MOVEMENTCLASS UnitClass::getMovementClass() const
+{
+    if(isAFlyingUnit()) {
+        return MOVEMENTCLASS_AIR;
+    } else if(itemID == Unit_Sandworm) {
+        return MOVEMENTCLASS_SANDWORM;
+    } else if(isInfantry()) {
+        return MOVEMENTCLASS_INFANTRY;
+    } else if(isTracked()) {
+        return MOVEMENTCLASS_TRACKED;
+    } else {
+        return MOVEMENTCLASS_WHEELED;
+    }
+}
+
 int UnitClass::getDrawnX() const
 {
-	return screenborder->world2screenX(realX) - imageW/2;
+	return screenborder->world2screenX(realX.toInt()) - imageW/2;
 }
 
 int UnitClass::getDrawnY() const
 {
-	return screenborder->world2screenY(realY) - imageH/2;
+	return screenborder->world2screenY(realY.toInt()) - imageH/2;
 }
 
 bool UnitClass::SearchPathWithAStar()
@@ -1059,7 +1083,23 @@ bool UnitClass::SearchPathWithAStar()
 		destinationCoord = destination;
 	}
 
-	AStarSearch pathfinder(currentGameMap, this, location, destinationCoord);
+	MOVEMENTCLASS movementClass = getMovementClass();
+
+	ReachabilityIndex* pReachabilityIndex = currentGameMap->getReachabilityIndex();
+	if(pReachabilityIndex->isReachable(movementClass, location, destinationCoord) == false) {
+	    // there is no path at all => move as close as possible instead of letting the search explore everything
+	    destinationCoord = pReachabilityIndex->findClosestReachableTile(movementClass, location, destinationCoord);
+	    if(destinationCoord == location) {
+	        pathList.clear();
+	        nextSpotFound = false;
+	        return false;
+	    }
+	}
+
+	// for long distances only the path to the next cluster is searched
+	Coord waypoint = currentGameMap->getClusterGraph()->getNextWaypoint(movementClass, location, destinationCoord);
+
+	AStarSearch pathfinder(currentGameMap, this, location, waypoint);
 	pathList = pathfinder.getFoundPath();
 
 	if(pathList.empty() == true) {